@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
 #include <numeric>
@@ -178,6 +179,317 @@ void outputResults( std::ostream& stream, const std::string& data_point_name,
 }
 #endif
 
+//---------------------------------------------------------------------------//
+// Summary statistics of one timer data point.
+struct TimerStatistics
+{
+    // Minimum time (microseconds).
+    double min;
+    // Maximum time (microseconds).
+    double max;
+    // Sample mean (microseconds).
+    double mean;
+    // Sample standard deviation (microseconds).
+    double std_dev;
+    // Half-width of the 95% confidence interval of the mean (microseconds).
+    double ci95;
+    // Number of samples kept after warmup discard and outlier rejection.
+    int num_sample;
+};
+
+//---------------------------------------------------------------------------//
+// Compute summary statistics for a set of timing samples: discard warmup
+// iterations, reject samples more than three standard deviations above the
+// mean once (JIT hiccups, OS noise), and report mean, deviation, and the
+// 95% confidence interval of the mean.
+inline TimerStatistics
+computeStatistics( const std::vector<double>& samples,
+                   const std::size_t num_warmup = 1 )
+{
+    std::vector<double> kept(
+        samples.begin() +
+            std::min( num_warmup, samples.size() > 0 ? samples.size() - 1
+                                                     : std::size_t( 0 ) ),
+        samples.end() );
+
+    auto summarize = [&]( const std::vector<double>& values )
+    {
+        TimerStatistics stats{};
+        stats.num_sample = values.size();
+        stats.min = *std::min_element( values.begin(), values.end() );
+        stats.max = *std::max_element( values.begin(), values.end() );
+        stats.mean = std::accumulate( values.begin(), values.end(), 0.0 ) /
+                     values.size();
+        double sum_sqr = 0.0;
+        for ( auto value : values )
+            sum_sqr += ( value - stats.mean ) * ( value - stats.mean );
+        stats.std_dev = ( values.size() > 1 )
+                            ? std::sqrt( sum_sqr / ( values.size() - 1 ) )
+                            : 0.0;
+        stats.ci95 = 1.96 * stats.std_dev / std::sqrt( (double)values.size() );
+        return stats;
+    };
+
+    auto stats = summarize( kept );
+
+    // One round of high-side outlier rejection.
+    std::vector<double> filtered;
+    for ( auto value : kept )
+        if ( value <= stats.mean + 3.0 * stats.std_dev )
+            filtered.push_back( value );
+    if ( filtered.size() < kept.size() && !filtered.empty() )
+        stats = summarize( filtered );
+
+    return stats;
+}
+
+//---------------------------------------------------------------------------//
+// Run an operation into a timer data point with explicit warmup control.
+// The warmup iterations execute but are not recorded, so the recorded
+// samples reflect steady state.
+template <class Functor>
+void runTimed( Timer& timer, const int data_point, Functor&& op,
+               const int num_warmup, const int num_run )
+{
+    for ( int w = 0; w < num_warmup; ++w )
+        op();
+    for ( int r = 0; r < num_run; ++r )
+    {
+        timer.start( data_point );
+        op();
+        timer.stop( data_point );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Capture the machine and build state alongside benchmark results so A/B
+// comparisons across code versions know what they ran on.
+inline std::string machineState()
+{
+    std::string state;
+    state += "execution_space: ";
+    state += Kokkos::DefaultExecutionSpace().name();
+    state += "\nhost_execution_space: ";
+    state += Kokkos::DefaultHostExecutionSpace().name();
+    state += "\nconcurrency: ";
+    state += std::to_string( Kokkos::DefaultExecutionSpace().concurrency() );
+    const char* host = std::getenv( "HOSTNAME" );
+    if ( host )
+    {
+        state += "\nhostname: ";
+        state += host;
+    }
+#ifdef NDEBUG
+    state += "\nbuild: release";
+#else
+    state += "\nbuild: debug";
+#endif
+    state += "\n";
+    return state;
+}
+
+//---------------------------------------------------------------------------//
+// Write timer results with full statistics: warmup-discarded mean, standard
+// deviation, and the 95% confidence interval per data point.
+template <class Scalar>
+void outputStatistics( std::ostream& stream,
+                       const std::string& data_point_name,
+                       const std::vector<Scalar>& data_point_vals,
+                       const Timer& timer, const std::size_t num_warmup = 1 )
+{
+    stream << "\n";
+    stream << timer._name << "\n";
+    stream << data_point_name << " min max mean std_dev ci95 samples"
+           << "\n";
+
+    for ( std::size_t n = 0; n < timer._data.size(); ++n )
+    {
+        if ( !timer._is_stopped[n] )
+            throw std::logic_error(
+                "attempted to output from a running timer" );
+
+        auto stats = computeStatistics( timer._data[n], num_warmup );
+        stream << data_point_vals[n] << " " << stats.min << " " << stats.max
+               << " " << stats.mean << " " << stats.std_dev << " "
+               << stats.ci95 << " " << stats.num_sample << "\n";
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Write timer results as a JSON object so performance tracking across
+// commits is scriptable instead of scraped from ad-hoc text.
+template <class Scalar>
+void outputJson( std::ostream& stream, const std::string& data_point_name,
+                 const std::vector<Scalar>& data_point_vals,
+                 const Timer& timer, const std::size_t num_warmup = 1 )
+{
+    stream << "{\n";
+    stream << "  \"name\": \"" << timer._name << "\",\n";
+    stream << "  \"data_point\": \"" << data_point_name << "\",\n";
+    stream << "  \"results\": [\n";
+    for ( std::size_t n = 0; n < timer._data.size(); ++n )
+    {
+        if ( !timer._is_stopped[n] )
+            throw std::logic_error(
+                "attempted to output from a running timer" );
+
+        auto stats = computeStatistics( timer._data[n], num_warmup );
+        stream << "    { \"value\": " << data_point_vals[n]
+               << ", \"min\": " << stats.min << ", \"max\": " << stats.max
+               << ", \"mean\": " << stats.mean
+               << ", \"std_dev\": " << stats.std_dev
+               << ", \"ci95\": " << stats.ci95
+               << ", \"samples\": " << stats.num_sample << " }";
+        stream << ( n + 1 < timer._data.size() ? ",\n" : "\n" );
+    }
+    stream << "  ]\n";
+    stream << "}\n";
+}
+
+//---------------------------------------------------------------------------//
+// Write timer results as CSV rows (one per data point).
+template <class Scalar>
+void outputCsv( std::ostream& stream, const std::string& data_point_name,
+                const std::vector<Scalar>& data_point_vals,
+                const Timer& timer, const std::size_t num_warmup = 1 )
+{
+    stream << "name," << data_point_name
+           << ",min,max,mean,std_dev,ci95,samples\n";
+    for ( std::size_t n = 0; n < timer._data.size(); ++n )
+    {
+        if ( !timer._is_stopped[n] )
+            throw std::logic_error(
+                "attempted to output from a running timer" );
+
+        auto stats = computeStatistics( timer._data[n], num_warmup );
+        stream << timer._name << "," << data_point_vals[n] << "," << stats.min
+               << "," << stats.max << "," << stats.mean << ","
+               << stats.std_dev << "," << stats.ci95 << ","
+               << stats.num_sample << "\n";
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Result of comparing one data point between two benchmark runs.
+struct ComparisonResult
+{
+    // Mean of the baseline run (microseconds).
+    double baseline_mean;
+    // Mean of the current run (microseconds).
+    double current_mean;
+    // current / baseline.
+    double ratio;
+    // Whether the difference exceeds the combined confidence intervals.
+    bool significant;
+    // False only for a statistically significant regression beyond the
+    // threshold.
+    bool pass;
+};
+
+//---------------------------------------------------------------------------//
+// Compare two result sets with statistical significance and a regression
+// threshold: a data point fails only when the current mean is more than
+// threshold (fractional) above the baseline AND the gap exceeds the
+// combined 95% confidence intervals, so noisy runs do not flip the verdict.
+inline ComparisonResult compareStatistics( const TimerStatistics& baseline,
+                                           const TimerStatistics& current,
+                                           const double threshold = 0.05 )
+{
+    ComparisonResult result;
+    result.baseline_mean = baseline.mean;
+    result.current_mean = current.mean;
+    result.ratio =
+        ( baseline.mean > 0.0 ) ? current.mean / baseline.mean : 0.0;
+    result.significant = std::abs( current.mean - baseline.mean ) >
+                         ( baseline.ci95 + current.ci95 );
+    result.pass = !( result.significant &&
+                     result.ratio > 1.0 + threshold );
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// Compare two timers data point by data point and report pass/fail per
+// point. Returns false if any point regressed.
+inline bool compareResults( std::ostream& stream, const Timer& baseline,
+                            const Timer& current,
+                            const double threshold = 0.05,
+                            const std::size_t num_warmup = 1 )
+{
+    if ( baseline._data.size() != current._data.size() )
+        throw std::logic_error(
+            "attempted to compare timers of different sweeps" );
+
+    stream << "\n";
+    stream << current._name << " vs baseline (threshold "
+           << threshold * 100.0 << "%)\n";
+    stream << "point baseline_mean current_mean ratio significant pass\n";
+
+    bool all_pass = true;
+    for ( std::size_t n = 0; n < baseline._data.size(); ++n )
+    {
+        auto comparison = compareStatistics(
+            computeStatistics( baseline._data[n], num_warmup ),
+            computeStatistics( current._data[n], num_warmup ), threshold );
+        stream << n << " " << comparison.baseline_mean << " "
+               << comparison.current_mean << " " << comparison.ratio << " "
+               << comparison.significant << " " << comparison.pass << "\n";
+        all_pass = all_pass && comparison.pass;
+    }
+    return all_pass;
+}
+
+//---------------------------------------------------------------------------//
+// Latency/bandwidth (alpha-beta) model of a communication path fit from a
+// message size sweep.
+struct LatencyBandwidthModel
+{
+    // Fixed per-message latency (microseconds).
+    double latency;
+    // Inverse bandwidth (microseconds per byte).
+    double inv_bandwidth;
+
+    // Effective bandwidth in GB/s.
+    double bandwidth() const
+    {
+        return ( inv_bandwidth > 0.0 ) ? 1.0e-3 / inv_bandwidth : 0.0;
+    }
+
+    // Predict the time (microseconds) to move a message of a given size.
+    double predict( const std::size_t bytes ) const
+    {
+        return latency + inv_bandwidth * bytes;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Least-squares fit of t = alpha + beta * bytes over a message size sweep,
+// using the mean time of each data point. Lets migration cost be predicted
+// for unmeasured sizes and paths compared by their fitted latency and
+// bandwidth rather than individual noisy samples.
+inline LatencyBandwidthModel
+fitLatencyBandwidth( const std::vector<std::size_t>& bytes,
+                     const Timer& timer, const std::size_t num_warmup = 1 )
+{
+    const std::size_t n = bytes.size();
+    double sum_x = 0.0, sum_y = 0.0, sum_xx = 0.0, sum_xy = 0.0;
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        const double x = static_cast<double>( bytes[i] );
+        const double y = computeStatistics( timer._data[i], num_warmup ).mean;
+        sum_x += x;
+        sum_y += y;
+        sum_xx += x * x;
+        sum_xy += x * y;
+    }
+    LatencyBandwidthModel model;
+    const double denominator = n * sum_xx - sum_x * sum_x;
+    model.inv_bandwidth =
+        ( denominator != 0.0 ) ? ( n * sum_xy - sum_x * sum_y ) / denominator
+                               : 0.0;
+    model.latency = ( sum_y - model.inv_bandwidth * sum_x ) / n;
+    return model;
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Benchmark
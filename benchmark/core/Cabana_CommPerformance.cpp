@@ -121,6 +121,8 @@ void performanceTest( std::ostream& stream, const std::size_t num_particle,
         test_prefix + "distributor_aosoa_migrate", num_fraction );
     Cabana::Benchmark::Timer distributor_slice_migrate(
         test_prefix + "distributor_slice_migrate", num_fraction );
+    Cabana::Benchmark::Timer distributor_aosoa_migrate_staged(
+        test_prefix + "distributor_aosoa_migrate_staged", num_fraction );
 
     // Loop over comm fractions.
     for ( int fraction = 0; fraction < num_fraction; ++fraction )
@@ -193,6 +195,21 @@ void performanceTest( std::ostream& stream, const std::size_t num_particle,
             Cabana::deep_copy( dst_particles, comm_dst_particles );
             distributor_aosoa_migrate.stop( fraction );
 
+            // Migrate again with the host-staged path forced so GPU-aware
+            // and staged exchanges can be compared directly on the same
+            // distribution.
+            setenv( "CABANA_GPU_AWARE_MPI", "0", 1 );
+            distributor_aosoa_migrate_staged.start( fraction );
+            comm_src_particles = Cabana::create_mirror_view_and_copy(
+                comm_memory_space(), src_particles );
+            comm_dst_particles = Cabana::create_mirror_view(
+                comm_memory_space(), dst_particles );
+            Cabana::migrate( distributor_fast, comm_src_particles,
+                             comm_dst_particles );
+            Cabana::deep_copy( dst_particles, comm_dst_particles );
+            distributor_aosoa_migrate_staged.stop( fraction );
+            unsetenv( "CABANA_GPU_AWARE_MPI" );
+
             // Migrate the aosoa using individual slices. Do host/device
             // copies as needed.
             distributor_slice_migrate.start( fraction );
@@ -233,6 +250,26 @@ void performanceTest( std::ostream& stream, const std::size_t num_particle,
                    comm );
     outputResults( stream, "send_bytes", comm_bytes, distributor_slice_migrate,
                    comm );
+    outputResults( stream, "send_bytes", comm_bytes,
+                   distributor_aosoa_migrate_staged, comm );
+
+    // Fit a latency/bandwidth model to each migration path over the size
+    // sweep so costs can be predicted for unmeasured sizes.
+    int model_rank;
+    MPI_Comm_rank( comm, &model_rank );
+    if ( 0 == model_rank )
+    {
+        auto direct_model = Cabana::Benchmark::fitLatencyBandwidth(
+            comm_bytes, distributor_aosoa_migrate );
+        auto staged_model = Cabana::Benchmark::fitLatencyBandwidth(
+            comm_bytes, distributor_aosoa_migrate_staged );
+        stream << "\nmigrate model (direct): latency_us "
+               << direct_model.latency << " bandwidth_GB/s "
+               << direct_model.bandwidth() << "\n";
+        stream << "migrate model (staged): latency_us "
+               << staged_model.latency << " bandwidth_GB/s "
+               << staged_model.bandwidth() << "\n";
+    }
 
     // HALO
     // ----
@@ -0,0 +1,185 @@
+/****************************************************************************
+ * Copyright (c) 2018-2023 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include "../Cabana_BenchmarkUtils.hpp"
+
+#include <Cabana_Core.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+//---------------------------------------------------------------------------//
+// Layout exploration: stream a saxpy-like update and an indexed
+// gather-scatter over the same particle data expressed as AoS (vector
+// length 1), full SoA (vector length = problem size rounding), and AoSoA at
+// several vector lengths. Generalizes the x86-only peakflops test to every
+// enabled backend through the benchmark harness.
+//---------------------------------------------------------------------------//
+template <class Device, int VectorLength>
+void layoutTest( std::ostream& stream, const std::string& test_prefix,
+                 const std::vector<int>& problem_sizes, const int num_run )
+{
+    using exec_space = typename Device::execution_space;
+    using memory_space = typename Device::memory_space;
+
+    // Mixed member types typical of MD particles.
+    using member_types = Cabana::MemberTypes<double[3], double[3], float, int>;
+    using aosoa_type =
+        Cabana::AoSoA<member_types, memory_space, VectorLength>;
+
+    const int num_problem_size = problem_sizes.size();
+    Cabana::Benchmark::Timer stream_timer(
+        test_prefix + "stream_vl" + std::to_string( VectorLength ),
+        num_problem_size );
+    Cabana::Benchmark::Timer gather_timer(
+        test_prefix + "gather_scatter_vl" + std::to_string( VectorLength ),
+        num_problem_size );
+
+    for ( int p = 0; p < num_problem_size; ++p )
+    {
+        const int num_particle = problem_sizes[p];
+        aosoa_type aosoa( "layout", num_particle );
+        auto x = Cabana::slice<0>( aosoa );
+        auto v = Cabana::slice<1>( aosoa );
+        auto m = Cabana::slice<2>( aosoa );
+        auto id = Cabana::slice<3>( aosoa );
+
+        // Initialize and build a scrambled index map for the
+        // gather-scatter pattern.
+        Kokkos::View<int*, memory_space> indices(
+            Kokkos::ViewAllocateWithoutInitializing( "indices" ),
+            num_particle );
+        Kokkos::parallel_for(
+            "init", Kokkos::RangePolicy<exec_space>( 0, num_particle ),
+            KOKKOS_LAMBDA( const int i ) {
+                for ( int d = 0; d < 3; ++d )
+                {
+                    x( i, d ) = 0.1 * i + d;
+                    v( i, d ) = 0.01 * i - d;
+                }
+                m( i ) = 1.0f + 0.001f * i;
+                id( i ) = i;
+                indices( i ) = ( i * 92837111 ) % num_particle;
+            } );
+        Kokkos::fence();
+
+        // Streaming access: position update from velocity.
+        auto stream_op = [&]()
+        {
+            Kokkos::parallel_for(
+                "stream_update",
+                Kokkos::RangePolicy<exec_space>( 0, num_particle ),
+                KOKKOS_LAMBDA( const int i ) {
+                    for ( int d = 0; d < 3; ++d )
+                        x( i, d ) += 0.005 * v( i, d ) * m( i );
+                } );
+            Kokkos::fence();
+        };
+        Cabana::Benchmark::runTimed( stream_timer, p, stream_op, 2, num_run );
+
+        // Gather-scatter access through the scrambled index map.
+        auto gather_op = [&]()
+        {
+            Kokkos::parallel_for(
+                "gather_scatter",
+                Kokkos::RangePolicy<exec_space>( 0, num_particle ),
+                KOKKOS_LAMBDA( const int i ) {
+                    const int j = indices( i );
+                    for ( int d = 0; d < 3; ++d )
+                        v( i, d ) += 0.001 * x( j, d );
+                } );
+            Kokkos::fence();
+        };
+        Cabana::Benchmark::runTimed( gather_timer, p, gather_op, 2, num_run );
+    }
+
+    // Output results with full statistics and achieved bandwidth context.
+    Cabana::Benchmark::outputStatistics( stream, "num_particle",
+                                         problem_sizes, stream_timer );
+    Cabana::Benchmark::outputStatistics( stream, "num_particle",
+                                         problem_sizes, gather_timer );
+}
+
+//---------------------------------------------------------------------------//
+template <class Device>
+void layoutSweep( std::ostream& stream, const std::string& test_prefix,
+                  const std::vector<int>& problem_sizes, const int num_run )
+{
+    // AoS limit, small and large AoSoA blocks, and a wide SoA-like block.
+    layoutTest<Device, 1>( stream, test_prefix, problem_sizes, num_run );
+    layoutTest<Device, 8>( stream, test_prefix, problem_sizes, num_run );
+    layoutTest<Device, 16>( stream, test_prefix, problem_sizes, num_run );
+    layoutTest<Device, 32>( stream, test_prefix, problem_sizes, num_run );
+    layoutTest<Device, 64>( stream, test_prefix, problem_sizes, num_run );
+    layoutTest<Device, 256>( stream, test_prefix, problem_sizes, num_run );
+}
+
+//---------------------------------------------------------------------------//
+int main( int argc, char* argv[] )
+{
+    // Check arguments.
+    if ( argc < 2 )
+        throw std::runtime_error( "Incorrect number of arguments. \n \
+             First argument - file name for output \n \
+             Optional second argument - run size (small or large) \n \
+             \n \
+             Example: \n \
+             $/: ./LayoutPerformance test_results.txt\n" );
+
+    // Get the name of the output file.
+    std::string filename = argv[1];
+
+    // Define run sizes.
+    std::string run_type = "";
+    if ( argc > 2 )
+        run_type = argv[2];
+    std::vector<int> problem_sizes = { 1000, 100000 };
+    int num_run = 10;
+    if ( run_type == "large" )
+    {
+        problem_sizes = { 1000, 100000, 10000000 };
+        num_run = 20;
+    }
+
+    Kokkos::initialize( argc, argv );
+    {
+        // Open the output file.
+        std::fstream file;
+        file.open( filename, std::fstream::out );
+
+        // Capture the machine state alongside the results.
+        file << Cabana::Benchmark::machineState();
+
+        // Do everything on the default CPU.
+        using host_exec_space = Kokkos::DefaultHostExecutionSpace;
+        using host_device_type = host_exec_space::device_type;
+        // Do everything on the default device with default memory.
+        using exec_space = Kokkos::DefaultExecutionSpace;
+        using device_type = exec_space::device_type;
+
+        // Don't run twice on the CPU if only host enabled.
+        if ( !std::is_same<device_type, host_device_type>{} )
+            layoutSweep<device_type>( file, "device_", problem_sizes,
+                                      num_run );
+        layoutSweep<host_device_type>( file, "host_", problem_sizes, num_run );
+
+        file.close();
+    }
+    Kokkos::finalize();
+
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
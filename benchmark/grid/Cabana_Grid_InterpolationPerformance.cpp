@@ -175,7 +175,7 @@ void g2p2g( const ScalarValueP2GType& scalar_p2g, const Coordinates& points,
 
 //---------------------------------------------------------------------------//
 // Performance test.
-template <class Device>
+template <class Device, int SplineOrder = 1>
 void performanceTest( std::ostream& stream, const std::string& test_prefix,
                       std::vector<int> cells_per_dim_per_rank,
                       std::vector<int> particles_per_cell,
@@ -412,35 +412,35 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix,
                 // P2G scalar value
                 auto scalar_value_p2g = createScalarValueP2G( scalar, -0.5 );
                 p2g_scalar_value_timer.start( n );
-                p2g( scalar_value_p2g, position, position.size(), Spline<1>(),
+                p2g( scalar_value_p2g, position, position.size(), Spline<SplineOrder>(),
                      *scalar_halo, *scalar_grid_field );
                 p2g_scalar_value_timer.stop( n );
 
                 // P2G vector value
                 auto vector_value_p2g = createVectorValueP2G( vector, -0.5 );
                 p2g_vector_value_timer.start( n );
-                p2g( vector_value_p2g, position, position.size(), Spline<1>(),
+                p2g( vector_value_p2g, position, position.size(), Spline<SplineOrder>(),
                      *vector_halo, *vector_grid_field );
                 p2g_vector_value_timer.stop( n );
 
                 // P2G scalar gradient
                 auto scalar_grad_p2g = createScalarGradientP2G( scalar, -0.5 );
                 p2g_scalar_gradient_timer.start( n );
-                p2g( scalar_grad_p2g, position, position.size(), Spline<1>(),
+                p2g( scalar_grad_p2g, position, position.size(), Spline<SplineOrder>(),
                      *vector_halo, *vector_grid_field );
                 p2g_scalar_gradient_timer.stop( n );
 
                 // P2G vector divergence
                 auto vector_div_p2g = createVectorDivergenceP2G( vector, -0.5 );
                 p2g_vector_divergence_timer.start( n );
-                p2g( vector_div_p2g, position, position.size(), Spline<1>(),
+                p2g( vector_div_p2g, position, position.size(), Spline<SplineOrder>(),
                      *scalar_halo, *scalar_grid_field );
                 p2g_vector_divergence_timer.stop( n );
 
                 // P2G tensor divergence
                 auto tensor_div_p2g = createTensorDivergenceP2G( tensor, -0.5 );
                 p2g_tensor_divergence_timer.start( n );
-                p2g( tensor_div_p2g, position, position.size(), Spline<1>(),
+                p2g( tensor_div_p2g, position, position.size(), Spline<SplineOrder>(),
                      *vector_halo, *vector_grid_field );
                 p2g_tensor_divergence_timer.stop( n );
 
@@ -448,14 +448,14 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix,
                 auto scalar_value_g2p = createScalarValueG2P( scalar, -0.5 );
                 g2p_scalar_value_timer.start( n );
                 g2p( *scalar_grid_field, *scalar_halo, position,
-                     position.size(), Spline<1>(), scalar_value_g2p );
+                     position.size(), Spline<SplineOrder>(), scalar_value_g2p );
                 g2p_scalar_value_timer.stop( n );
 
                 // G2P vector value
                 auto vector_value_g2p = createVectorValueG2P( vector, -0.5 );
                 g2p_vector_value_timer.start( n );
                 g2p( *vector_grid_field, *vector_halo, position,
-                     position.size(), Spline<1>(), vector_value_g2p );
+                     position.size(), Spline<SplineOrder>(), vector_value_g2p );
                 g2p_vector_value_timer.stop( n );
 
                 // G2P scalar gradient
@@ -463,7 +463,7 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix,
                     createScalarGradientG2P( vector, -0.5 );
                 g2p_scalar_gradient_timer.start( n );
                 g2p( *scalar_grid_field, *scalar_halo, position,
-                     position.size(), Spline<1>(), scalar_gradient_g2p );
+                     position.size(), Spline<SplineOrder>(), scalar_gradient_g2p );
                 g2p_scalar_gradient_timer.stop( n );
 
                 // G2P vector gradient
@@ -471,14 +471,14 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix,
                     createVectorGradientG2P( tensor, -0.5 );
                 g2p_vector_gradient_timer.start( n );
                 g2p( *vector_grid_field, *vector_halo, position,
-                     position.size(), Spline<1>(), vector_gradient_g2p );
+                     position.size(), Spline<SplineOrder>(), vector_gradient_g2p );
                 g2p_vector_gradient_timer.stop( n );
 
                 // G2P vector divergence
                 auto vector_div_g2p = createVectorDivergenceG2P( scalar, -0.5 );
                 g2p_vector_divergence_timer.start( n );
                 g2p( *vector_grid_field, *vector_halo, position,
-                     position.size(), Spline<1>(), vector_div_g2p );
+                     position.size(), Spline<SplineOrder>(), vector_div_g2p );
                 g2p_vector_divergence_timer.stop( n );
 
                 // All P2G
@@ -614,15 +614,53 @@ int main( int argc, char* argv[] )
     using device_type = exec_space::device_type;
 
     // Don't run twice on the CPU if only host enabled.
+    // Annotate the sweep with peak numbers for roofline placement when the
+    // user provides them (GB/s and GFLOP/s of the device).
+    if ( 0 == comm_rank )
+    {
+        const char* peak_bw = std::getenv( "CABANA_PEAK_BANDWIDTH_GBS" );
+        const char* peak_flops = std::getenv( "CABANA_PEAK_GFLOPS" );
+        if ( peak_bw )
+            file << "roofline peak_bandwidth_GB/s " << peak_bw << "\n";
+        if ( peak_flops )
+            file << "roofline peak_GFLOP/s " << peak_flops << "\n";
+    }
+
+    // Sweep the spline order. Each deposition moves the same particle bytes
+    // but touches (order+1)^3 grid values per particle, so the sweep spans
+    // arithmetic intensities from bandwidth-bound (linear) to deeply
+    // stencil-bound (quintic).
     if ( !std::is_same<device_type, host_device_type>{} )
     {
-        performanceTest<device_type>( file, "device_", cells_per_dim_per_rank,
-                                      particles_per_cell, partitioner,
-                                      MPI_COMM_WORLD );
+        performanceTest<device_type, 1>( file, "device_linear_",
+                                         cells_per_dim_per_rank,
+                                         particles_per_cell, partitioner,
+                                         MPI_COMM_WORLD );
+        performanceTest<device_type, 2>( file, "device_quadratic_",
+                                         cells_per_dim_per_rank,
+                                         particles_per_cell, partitioner,
+                                         MPI_COMM_WORLD );
+        performanceTest<device_type, 3>( file, "device_cubic_",
+                                         cells_per_dim_per_rank,
+                                         particles_per_cell, partitioner,
+                                         MPI_COMM_WORLD );
+        performanceTest<device_type, 4>( file, "device_quartic_",
+                                         cells_per_dim_per_rank,
+                                         particles_per_cell, partitioner,
+                                         MPI_COMM_WORLD );
+        performanceTest<device_type, 5>( file, "device_quintic_",
+                                         cells_per_dim_per_rank,
+                                         particles_per_cell, partitioner,
+                                         MPI_COMM_WORLD );
     }
-    performanceTest<host_device_type>( file, "host_", cells_per_dim_per_rank,
-                                       particles_per_cell, partitioner,
-                                       MPI_COMM_WORLD );
+    performanceTest<host_device_type, 1>( file, "host_linear_",
+                                          cells_per_dim_per_rank,
+                                          particles_per_cell, partitioner,
+                                          MPI_COMM_WORLD );
+    performanceTest<host_device_type, 3>( file, "host_cubic_",
+                                          cells_per_dim_per_rank,
+                                          particles_per_cell, partitioner,
+                                          MPI_COMM_WORLD );
 
     // Close the output file on rank 0.
     file.close();
@@ -0,0 +1,276 @@
+/****************************************************************************
+ * Copyright (c) 2018-2023 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_Algorithms.hpp
+  \brief Stream compaction primitives: select, compact, and partition.
+*/
+#ifndef CABANA_ALGORITHMS_HPP
+#define CABANA_ALGORITHMS_HPP
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_Slice.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <utility>
+
+namespace Cabana
+{
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+// Copy all components of one slice element to a different index in another
+// slice.
+template <class DstSlice, class SrcSlice>
+KOKKOS_INLINE_FUNCTION void gatherSliceElement( const DstSlice& dst,
+                                                const std::size_t j,
+                                                const SrcSlice& src,
+                                                const std::size_t i )
+{
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < dst.viewRank(); ++d )
+        num_comp *= dst.extent( d );
+
+    auto dst_s = DstSlice::index_type::s( j );
+    auto dst_a = DstSlice::index_type::a( j );
+    std::size_t dst_offset = dst_s * dst.stride( 0 ) + dst_a;
+    auto src_s = SrcSlice::index_type::s( i );
+    auto src_a = SrcSlice::index_type::a( i );
+    std::size_t src_offset = src_s * src.stride( 0 ) + src_a;
+
+    auto dst_data = dst.data();
+    auto src_data = src.data();
+    for ( std::size_t n = 0; n < num_comp; ++n )
+        dst_data[dst_offset + DstSlice::vector_length * n] =
+            src_data[src_offset + SrcSlice::vector_length * n];
+}
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Count the elements selected by a predicate.
+
+  \param exec_space Kokkos execution space.
+  \param predicate Device-callable predicate: predicate(i) is true for
+  selected elements.
+  \param num_elements Number of elements to evaluate.
+  \return Number of selected elements.
+*/
+template <class ExecutionSpace, class Predicate>
+int countSelected( ExecutionSpace exec_space, const Predicate& predicate,
+                   const std::size_t num_elements )
+{
+    int count = 0;
+    Kokkos::parallel_reduce(
+        "Cabana::countSelected",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, num_elements ),
+        KOKKOS_LAMBDA( const int i, int& update ) {
+            if ( predicate( i ) )
+                ++update;
+        },
+        count );
+    Kokkos::fence();
+    return count;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Collect the indices of the elements selected by a predicate,
+  preserving order.
+
+  \param exec_space Kokkos execution space.
+  \param predicate Device-callable predicate: predicate(i) is true for
+  selected elements.
+  \param num_elements Number of elements to evaluate.
+  \return View of selected indices, sized exactly.
+
+  The same scan+fill implementation backs removal, Verlet CSR builds, and
+  communication plan construction; the warp-aggregated output variant from
+  the literature has no portable Kokkos expression, and the ordered scan
+  additionally keeps the output deterministic.
+*/
+template <class MemorySpace, class ExecutionSpace, class Predicate>
+Kokkos::View<int*, MemorySpace>
+selectIndices( ExecutionSpace exec_space, const Predicate& predicate,
+               const std::size_t num_elements )
+{
+    int num_selected =
+        countSelected( exec_space, predicate, num_elements );
+    Kokkos::View<int*, MemorySpace> indices(
+        Kokkos::ViewAllocateWithoutInitializing( "selected_indices" ),
+        num_selected );
+    if ( 0 == num_selected )
+        return indices;
+
+    Kokkos::parallel_scan(
+        "Cabana::selectIndices",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, num_elements ),
+        KOKKOS_LAMBDA( const int i, int& count, const bool final_pass ) {
+            if ( predicate( i ) )
+            {
+                if ( final_pass )
+                    indices( count ) = i;
+                ++count;
+            }
+        } );
+    Kokkos::fence();
+    return indices;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Stable partition of element indices by a predicate.
+
+  \param exec_space Kokkos execution space.
+  \param predicate Device-callable predicate.
+  \param num_elements Number of elements to evaluate.
+  \return Pair of the index view (selected indices first, in order,
+  followed by the unselected indices, in order) and the partition point.
+*/
+template <class MemorySpace, class ExecutionSpace, class Predicate>
+std::pair<Kokkos::View<int*, MemorySpace>, int>
+partitionIndices( ExecutionSpace exec_space, const Predicate& predicate,
+                  const std::size_t num_elements )
+{
+    int num_selected =
+        countSelected( exec_space, predicate, num_elements );
+    Kokkos::View<int*, MemorySpace> indices(
+        Kokkos::ViewAllocateWithoutInitializing( "partitioned_indices" ),
+        num_elements );
+
+    Kokkos::parallel_scan(
+        "Cabana::partitionIndices",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, num_elements ),
+        KOKKOS_LAMBDA( const int i, int& count, const bool final_pass ) {
+            if ( predicate( i ) )
+            {
+                if ( final_pass )
+                    indices( count ) = i;
+                ++count;
+            }
+            else if ( final_pass )
+            {
+                // i - count unselected elements precede this one.
+                indices( num_selected + i - count ) = i;
+            }
+        } );
+    Kokkos::fence();
+    return std::make_pair( indices, num_selected );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Gather slice elements at the given indices into the front of a
+  destination slice.
+
+  \param exec_space Kokkos execution space.
+  \param dst Destination slice. Element j receives all components of
+  source element indices(j). Must not alias the source.
+  \param src Source slice.
+  \param indices Indices of the source elements to gather, e.g. from
+  selectIndices().
+*/
+template <class ExecutionSpace, class DstSlice, class SrcSlice,
+          class IndexView>
+void compactSlice( ExecutionSpace exec_space, DstSlice& dst,
+                   const SrcSlice& src, const IndexView& indices )
+{
+    static_assert( is_slice<DstSlice>::value && is_slice<SrcSlice>::value,
+                   "compactSlice requires slice arguments" );
+    Kokkos::parallel_for(
+        "Cabana::compactSlice",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0,
+                                             indices.extent( 0 ) ),
+        KOKKOS_LAMBDA( const int j ) {
+            Impl::gatherSliceElement( dst, j, src, indices( j ) );
+        } );
+    Kokkos::fence();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Compact the selected elements of an AoSoA to the front and resize
+  to the selected count.
+
+  \param exec_space Kokkos execution space.
+  \param predicate Device-callable predicate: predicate(i) is true for
+  elements to keep.
+  \param aosoa The AoSoA to compact in place.
+  \param shrink_to_fit Whether to remove additional AoSoA capacity.
+  \return Number of elements kept.
+
+  Unselected positions in the front section are filled from selected
+  positions in the tail section, as in remove(): the two sections are
+  disjoint so the move pass is safe in place, at the cost of element
+  order.
+*/
+template <class ExecutionSpace, class Predicate, class AoSoA_t>
+int compact( ExecutionSpace exec_space, const Predicate& predicate,
+             AoSoA_t& aosoa, const bool shrink_to_fit = false )
+{
+    using memory_space = typename AoSoA_t::memory_space;
+    const int num_particles = aosoa.size();
+    const int num_selected =
+        countSelected( exec_space, predicate, num_particles );
+
+    if ( num_selected > 0 && num_selected < num_particles )
+    {
+        // Unselected positions in the front section are the holes to fill.
+        Kokkos::View<int*, memory_space> holes(
+            Kokkos::ViewAllocateWithoutInitializing( "compact_holes" ),
+            num_particles - num_selected );
+        Kokkos::parallel_scan(
+            "Cabana::compact::findHoles",
+            Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0,
+                                                 num_selected ),
+            KOKKOS_LAMBDA( const int i, int& count, const bool final_pass ) {
+                if ( !predicate( i ) )
+                {
+                    if ( final_pass )
+                        holes( count ) = i;
+                    ++count;
+                }
+            } );
+        Kokkos::fence();
+
+        // Move selected tail elements into the holes. Sources and
+        // destinations live in disjoint sections.
+        auto aosoa_copy = aosoa;
+        Kokkos::parallel_scan(
+            "Cabana::compact::fillHoles",
+            Kokkos::RangePolicy<ExecutionSpace>( exec_space, num_selected,
+                                                 num_particles ),
+            KOKKOS_LAMBDA( const int i, int& count, const bool final_pass ) {
+                if ( predicate( i ) )
+                {
+                    if ( final_pass )
+                        aosoa_copy.setTuple( holes( count ),
+                                             aosoa_copy.getTuple( i ) );
+                    ++count;
+                }
+            } );
+        Kokkos::fence();
+    }
+
+    aosoa.resize( num_selected );
+    if ( shrink_to_fit )
+        aosoa.shrinkToFit();
+    return num_selected;
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_ALGORITHMS_HPP
@@ -17,6 +17,7 @@
 #define CABANA_AOSOA_HPP
 
 #include <Cabana_MemberTypes.hpp>
+#include <Cabana_MemoryTracker.hpp>
 #include <Cabana_Slice.hpp>
 #include <Cabana_SoA.hpp>
 #include <Cabana_Tuple.hpp>
@@ -27,8 +28,10 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <array>
 #include <cmath>
 #include <cstdlib>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 
@@ -159,6 +162,15 @@ class AoSoA
 
     //! SoA type.
     using soa_type = SoA<member_types, vector_length>;
+    // Whole-struct and whole-tuple moves (block deep copies, buffer packs,
+    // SoA assignment in sort scatters) lower to bulk word copies precisely
+    // because these types are trivially copyable - enforce the guarantee so
+    // a member type regression cannot silently fall back to element-wise
+    // copies. Per-member transfers at a fixed array index are strided by
+    // the vector length and therefore have no contiguous fast path by
+    // construction.
+    static_assert( std::is_trivially_copyable<soa_type>::value,
+                   "SoA type must be trivially copyable" );
 
     //! Managed data view.
     using soa_view = Kokkos::View<soa_type*, memory_space, memory_traits>;
@@ -174,6 +186,8 @@ class AoSoA
 
     //! Tuple type.
     using tuple_type = Tuple<member_types>;
+    static_assert( std::is_trivially_copyable<tuple_type>::value,
+                   "Tuple type must be trivially copyable" );
 
     //! Member data type at a given index M. Note this is the user-defined
     //! member data type - not the potentially transformed type actually stored
@@ -326,8 +340,10 @@ class AoSoA
         static_assert( !memory_traits::is_unmanaged,
                        "Cannot resize unmanaged memory" );
 
-        // Reserve memory if needed.
-        reserve( n );
+        // Reserve memory if needed. If growth requires a new allocation,
+        // overallocate to amortize the cost of repeated growth.
+        if ( n > _capacity )
+            reserve( n * _overallocation );
 
         // Update the sizes of the data. This is potentially different than
         // the amount of allocated data.
@@ -335,6 +351,35 @@ class AoSoA
         _num_soa = std::ceil( static_cast<double>( n ) / vector_length );
     }
 
+    /*!
+      \brief Resize the container from a device-resident count.
+
+      \param n A rank-0 device view holding the new size, e.g. the result of
+      a device-side scan or reduction.
+
+      Device-side pipelines that compute particle counts on device (removal
+      scans, injection counters) can hand the count directly to the
+      container: the single device-to-host copy happens here, giving exactly
+      one synchronization point per resize instead of a staged copy and
+      fence at every call site. Kernel ranges and communication plan
+      construction consume host counts by nature, so this is the one
+      unavoidable round trip.
+    */
+    template <class CountView>
+    typename std::enable_if<Kokkos::is_view<CountView>::value, void>::type
+    resize( const CountView& n )
+    {
+        static_assert( 0 == CountView::rank,
+                       "Device count must be a rank-0 view" );
+        static_assert(
+            std::is_integral<typename CountView::non_const_value_type>::value,
+            "Device count must be an integer" );
+
+        typename CountView::non_const_value_type host_n;
+        Kokkos::deep_copy( host_n, n );
+        resize( static_cast<size_type>( host_n ) );
+    }
+
     /*!
       \brief Requests that the container capacity be at least enough to contain
       n tuples.
@@ -377,6 +422,10 @@ class AoSoA
 
         // We need more SoA objects so allocate a new view and copy the
         // existing data.
+        MemoryTracker::instance().deallocate(
+            "AoSoA", _data.size() * sizeof( soa_type ) );
+        MemoryTracker::instance().allocate(
+            "AoSoA", num_soa_alloc * sizeof( soa_type ) );
         soa_view resized_data(
             Kokkos::ViewAllocateWithoutInitializing( _data.label() ),
             num_soa_alloc );
@@ -415,6 +464,10 @@ class AoSoA
 
         // We need fewer SoA objects so allocate a new view and copy the
         // existing data.
+        MemoryTracker::instance().deallocate(
+            "AoSoA", _data.size() * sizeof( soa_type ) );
+        MemoryTracker::instance().allocate( "AoSoA",
+                                            _num_soa * sizeof( soa_type ) );
         soa_view resized_data(
             Kokkos::ViewAllocateWithoutInitializing( _data.label() ),
             _num_soa );
@@ -426,6 +479,36 @@ class AoSoA
         _data = resized_data;
     }
 
+    /*!
+      \brief Set the overallocation factor used when a resize grows the
+      container beyond its current capacity.
+
+      When a call to resize() requires a new allocation, the new capacity is
+      chosen to hold the requested size times this factor (rounded up to
+      whole SoAs). A factor greater than one leaves slack in the container so
+      that subsequent size fluctuations are serviced from the existing
+      allocation without any new device allocation, analogous to the
+      overallocation used by the communication buffers. The default factor of
+      one preserves exact allocation.
+
+      \param overallocation The growth factor. Must be at least 1.0.
+    */
+    void setOverallocation( const double overallocation )
+    {
+        if ( overallocation < 1.0 )
+            throw std::runtime_error(
+                "Cabana::AoSoA::setOverallocation: Cannot allocate with less "
+                "space than the data to store!" );
+        _overallocation = overallocation;
+    }
+
+    /*!
+      \brief Get the overallocation factor used when a resize grows the
+      container.
+      \return The overallocation factor.
+    */
+    double overallocation() const { return _overallocation; }
+
     /*!
       \brief Get the number of structs-of-arrays in the container.
       \return The number of structs-of-arrays in the container.
@@ -490,6 +573,29 @@ class AoSoA
     */
     soa_type* data() const { return _data.data(); }
 
+    /*!
+      \brief Mark a member as modified for incremental checkpointing.
+
+      The flags are purely user-driven bookkeeping: mark the members a
+      kernel writes and clear the flags after a checkpoint consumes them.
+    */
+    template <std::size_t M>
+    void markModified()
+    {
+        static_assert( M < number_of_members, "Invalid member index" );
+        _modified[M] = true;
+    }
+
+    //! Whether a member has been marked modified since the last clear.
+    bool modified( const std::size_t m ) const { return _modified[m]; }
+
+    //! Clear all member modification flags (e.g. after a checkpoint).
+    void clearModified()
+    {
+        for ( std::size_t m = 0; m < number_of_members; ++m )
+            _modified[m] = false;
+    }
+
   private:
     // Total number of tuples in the container.
     size_type _size;
@@ -500,6 +606,12 @@ class AoSoA
     // Number of structs-of-arrays in the array.
     size_type _num_soa;
 
+    // Capacity growth factor applied when a resize requires reallocation.
+    double _overallocation = 1.0;
+
+    // Per-member modification flags for incremental checkpointing.
+    std::array<bool, number_of_members> _modified = {};
+
     // Structs-of-Arrays managed data. This Kokkos View manages the block of
     // memory owned by this class such that the copy constructor and
     // assignment operator for this class perform a shallow and reference
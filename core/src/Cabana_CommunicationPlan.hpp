@@ -16,16 +16,24 @@
 #ifndef CABANA_COMMUNICATIONPLAN_HPP
 #define CABANA_COMMUNICATIONPLAN_HPP
 
+#include <Cabana_MemoryTracker.hpp>
 #include <Cabana_Utils.hpp>
 
 #include <Kokkos_Core.hpp>
 #include <Kokkos_ScatterView.hpp>
 
 #include <mpi.h>
+#if defined( OPEN_MPI )
+#include <mpi-ext.h>
+#endif
 
 #include <algorithm>
+#include <cstdlib>
 #include <exception>
 #include <memory>
+#include <cstring>
+#include <limits>
+#include <map>
 #include <numeric>
 #include <type_traits>
 #include <vector>
@@ -389,6 +397,38 @@ inline std::vector<int> getUniqueTopology( MPI_Comm comm,
     return topology;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Whether the MPI library can operate directly on GPU memory.
+
+  Queried at runtime where the MPI implementation exposes it
+  (MPIX_Query_cuda_support / MPIX_Query_rocm_support); otherwise GPU-aware
+  support is assumed, matching the previous behavior. The result can be
+  overridden in either direction with the CABANA_GPU_AWARE_MPI environment
+  variable (0 or 1), e.g. for MPI implementations that misreport support.
+*/
+inline bool gpuAwareMpiSupported()
+{
+    // Environment override.
+    const char* env = std::getenv( "CABANA_GPU_AWARE_MPI" );
+    if ( env )
+        return std::atoi( env ) != 0;
+
+#if defined( MPIX_CUDA_AWARE_SUPPORT )
+    return 1 == MPIX_Query_cuda_support();
+#elif defined( MPIX_ROCM_AWARE_SUPPORT )
+    return 1 == MPIX_Query_rocm_support();
+#else
+    return true;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+//! Tag selecting non-blocking consensus (NBX) neighbor discovery.
+class NbxDiscoveryTag
+{
+};
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Communication plan base class.
@@ -550,6 +590,126 @@ class CommunicationPlan
         return _export_steering;
     }
 
+    /*!
+      \brief Create a distributed graph communicator over the plan topology
+      for neighborhood collectives.
+
+      Builds an MPI_Dist_graph_create_adjacent communicator with the current
+      neighbor list as both sources and destinations, without reordering so
+      the collective neighbor order matches neighborRank(). When the topology
+      is static across many steps this moves the per-exchange MPI setup into
+      plan creation and lets the data movement use MPI_Neighbor_alltoallv
+      instead of fresh point-to-point request pairs.
+
+      \note Must be called again if the plan is recreated with a different
+      topology.
+    */
+    void createNeighborComm()
+    {
+        int num_n = _neighbors.size();
+        _neighbor_comm_ptr.reset(
+            [this, num_n]()
+            {
+                auto p = std::make_unique<MPI_Comm>();
+                MPI_Dist_graph_create_adjacent(
+                    comm(), num_n, _neighbors.data(), MPI_UNWEIGHTED, num_n,
+                    _neighbors.data(), MPI_UNWEIGHTED, MPI_INFO_NULL, 0,
+                    p.get() );
+                return p.release();
+            }(),
+            []( MPI_Comm* p )
+            {
+                MPI_Comm_free( p );
+                delete p;
+            } );
+    }
+
+    /*!
+      \brief Compute a topology-aware per-neighbor send schedule.
+
+      \return The local neighbor indices in the order sends should be
+      posted.
+
+      Node-local neighbors come first - their messages complete through
+      shared memory and free buffers early - and off-node neighbors are
+      rotated by this rank's position so simultaneous senders spread over
+      distinct destinations instead of converging on the same group and
+      congesting it (the dragonfly worst case). The schedule is a
+      permutation of local neighbor ids and leaves the plan's buffer layout
+      untouched, so exchanges only need to post messages in this order.
+    */
+    const std::vector<int>& createSendSchedule() const
+    {
+        // The schedule only depends on the neighbor list; reuse it until
+        // the plan is recreated.
+        if ( _send_schedule.size() == _neighbors.size() )
+            return _send_schedule;
+
+        const int num_n = _neighbors.size();
+
+        // Find which neighbors share this node.
+        MPI_Comm node_comm;
+        MPI_Comm_split_type( comm(), MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
+                             &node_comm );
+        MPI_Group world_group;
+        MPI_Comm_group( comm(), &world_group );
+        MPI_Group node_group;
+        MPI_Comm_group( node_comm, &node_group );
+        std::vector<int> node_ranks( num_n );
+        MPI_Group_translate_ranks( world_group,
+                                   num_n,
+                                   const_cast<int*>( _neighbors.data() ),
+                                   node_group, node_ranks.data() );
+        MPI_Group_free( &world_group );
+        MPI_Group_free( &node_group );
+        MPI_Comm_free( &node_comm );
+
+        std::vector<int> locals;
+        std::vector<int> remotes;
+        for ( int n = 0; n < num_n; ++n )
+        {
+            if ( MPI_UNDEFINED != node_ranks[n] )
+                locals.push_back( n );
+            else
+                remotes.push_back( n );
+        }
+
+        // Stagger the off-node sends by this rank's index.
+        int my_rank;
+        MPI_Comm_rank( comm(), &my_rank );
+        std::vector<int> schedule = locals;
+        if ( !remotes.empty() )
+        {
+            const std::size_t shift = my_rank % remotes.size();
+            for ( std::size_t n = 0; n < remotes.size(); ++n )
+                schedule.push_back(
+                    remotes[( n + shift ) % remotes.size()] );
+        }
+        _num_node_local = locals.size();
+        _send_schedule = schedule;
+        return _send_schedule;
+    }
+
+    /*!
+      \brief Get the number of node-local neighbors. These occupy the front
+      of the send schedule. Only valid after createSendSchedule().
+    */
+    std::size_t numNodeLocalNeighbors() const { return _num_node_local; }
+
+    /*!
+      \brief Whether a neighborhood collective communicator has been created.
+    */
+    bool hasNeighborComm() const
+    {
+        return static_cast<bool>( _neighbor_comm_ptr );
+    }
+
+    /*!
+      \brief Get the distributed graph communicator. Only valid after
+      createNeighborComm().
+    */
+    MPI_Comm neighborComm() const { return *_neighbor_comm_ptr; }
+
     // The functions in the public block below would normally be protected but
     // we make them public to allow using private class data in CUDA kernels
     // with lambda functions.
@@ -623,19 +783,37 @@ class CommunicationPlan
         _num_import.assign( num_n, 0 );
 
         // Count the number of sends this rank will do to other ranks. Keep
-        // track of which slot we get in our neighbor's send buffer.
+        // track of which slot we get in our neighbor's send buffer. The
+        // counting, steering-vector construction, and export reordering all
+        // stay on device.
         auto counts_and_ids = Impl::countSendsAndCreateSteering(
             exec_space, element_export_ranks, comm_size,
             typename Impl::CountSendsAndCreateSteeringAlgorithm<
                 ExecutionSpace>::type() );
 
-        // Copy the counts to the host.
+        // With the topology known only the neighbor counts are needed on
+        // the host - gather them on device so the transfer is num_neighbors
+        // integers instead of the full communicator-sized count array.
+        Kokkos::View<int*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+            neighbors_host( _neighbors.data(), num_n );
+        auto neighbors_device = Kokkos::create_mirror_view_and_copy(
+            memory_space(), neighbors_host );
+        Kokkos::View<int*, memory_space> neighbor_counts(
+            Kokkos::ViewAllocateWithoutInitializing( "neighbor_counts" ),
+            num_n );
+        auto counts = counts_and_ids.first;
+        Kokkos::parallel_for(
+            "Cabana::CommunicationPlan::gatherNeighborCounts",
+            Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, num_n ),
+            KOKKOS_LAMBDA( const int n ) {
+                neighbor_counts( n ) = counts( neighbors_device( n ) );
+            } );
         auto neighbor_counts_host = Kokkos::create_mirror_view_and_copy(
-            Kokkos::HostSpace(), counts_and_ids.first );
+            Kokkos::HostSpace(), neighbor_counts );
 
         // Get the export counts.
         for ( int n = 0; n < num_n; ++n )
-            _num_export[n] = neighbor_counts_host( _neighbors[n] );
+            _num_export[n] = neighbor_counts_host( n );
 
         // Post receives for the number of imports we will get.
         std::vector<MPI_Request> requests;
@@ -924,6 +1102,192 @@ class CommunicationPlan
         return createFromExportsOnly( execution_space{}, element_export_ranks );
     }
 
+    /*!
+      \brief Export rank creator using non-blocking consensus (NBX) neighbor
+      discovery.
+
+      Functionally identical to the dense createFromExportsOnly but the
+      import topology is discovered with the NBX algorithm (synchronous-mode
+      sends, probing, and MPI_Ibarrier) instead of a reduction over the whole
+      communicator. The cost then scales with the number of actual neighbors
+      rather than the communicator size, which matters when the topology is
+      sparse and the communicator is large.
+
+      \param exec_space Kokkos execution space.
+
+      \param element_export_ranks The destination rank in the target
+      decomposition of each locally owned element in the source
+      decomposition. An export rank of -1 will signal that this element is
+      *not* to be exported and will be ignored in the data migration.
+
+      \return The location of each export element in the send buffer for its
+      given neighbor.
+
+      \note Calling this function completely updates the state of this object
+      and invalidates the previous state.
+    */
+    template <class ExecutionSpace, class ViewType>
+    Kokkos::View<size_type*, memory_space>
+    createFromExportsOnly( ExecutionSpace exec_space,
+                           const ViewType& element_export_ranks,
+                           NbxDiscoveryTag )
+    {
+        static_assert( is_accessible_from<memory_space, ExecutionSpace>{}, "" );
+
+        // Store the number of export elements.
+        _num_export_element = element_export_ranks.size();
+
+        // Get the size of this communicator.
+        int comm_size = -1;
+        MPI_Comm_size( comm(), &comm_size );
+
+        // Get the MPI rank we are currently on.
+        int my_rank = -1;
+        MPI_Comm_rank( comm(), &my_rank );
+
+        // Pick an mpi tag for communication. This object has it's own
+        // communication space so any mpi tag will do.
+        const int mpi_tag = 1221;
+
+        // Count the number of sends this rank will do to other ranks. Keep
+        // track of which slot we get in our neighbor's send buffer.
+        auto counts_and_ids = Impl::countSendsAndCreateSteering(
+            exec_space, element_export_ranks, comm_size,
+            typename Impl::CountSendsAndCreateSteeringAlgorithm<
+                ExecutionSpace>::type() );
+
+        // Copy the counts to the host.
+        auto neighbor_counts_host = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), counts_and_ids.first );
+
+        // Extract the export ranks and number of exports.
+        _neighbors.clear();
+        _num_export.clear();
+        _total_num_export = 0;
+        for ( int r = 0; r < comm_size; ++r )
+            if ( neighbor_counts_host( r ) > 0 )
+            {
+                _neighbors.push_back( r );
+                _num_export.push_back( neighbor_counts_host( r ) );
+                _total_num_export += neighbor_counts_host( r );
+            }
+
+        // Get the number of export ranks and initially allocate the import
+        // sizes.
+        int num_export_rank = _neighbors.size();
+        _num_import.assign( num_export_rank, 0 );
+
+        // If we are sending to ourself put that one first in the neighbor
+        // list and assign the number of imports to be the number of exports.
+        bool self_send = false;
+        for ( int n = 0; n < num_export_rank; ++n )
+            if ( _neighbors[n] == my_rank )
+            {
+                std::swap( _neighbors[n], _neighbors[0] );
+                std::swap( _num_export[n], _num_export[0] );
+                _num_import[0] = _num_export[0];
+                self_send = true;
+                break;
+            }
+        int self_offset = ( self_send ) ? 1 : 0;
+
+        // Start synchronous-mode sends of our export counts. These only
+        // complete once they have been matched by a receive. The counts are
+        // snapshotted into stable storage because _num_export grows while
+        // import-only neighbors are discovered below.
+        std::vector<std::size_t> send_counts( _num_export.begin() +
+                                                  self_offset,
+                                              _num_export.end() );
+        std::vector<MPI_Request> send_requests( num_export_rank -
+                                                self_offset );
+        for ( int n = self_offset; n < num_export_rank; ++n )
+            MPI_Issend( &send_counts[n - self_offset], 1, MPI_UNSIGNED_LONG,
+                        _neighbors[n], mpi_tag, comm(),
+                        &send_requests[n - self_offset] );
+
+        // Probe for incoming counts until the consensus barrier completes.
+        // Once all of our sends have been matched we enter the barrier; once
+        // the barrier completes every rank's sends have been matched and no
+        // message remains in flight.
+        _total_num_import = ( self_send ) ? _num_import[0] : 0;
+        MPI_Request barrier_request = MPI_REQUEST_NULL;
+        bool barrier_active = false;
+        int done = 0;
+        while ( !done )
+        {
+            int flag = 0;
+            MPI_Status probe_status;
+            MPI_Iprobe( MPI_ANY_SOURCE, mpi_tag, comm(), &flag,
+                        &probe_status );
+            if ( flag )
+            {
+                const auto source = probe_status.MPI_SOURCE;
+                std::size_t import_size = 0;
+                MPI_Recv( &import_size, 1, MPI_UNSIGNED_LONG, source, mpi_tag,
+                          comm(), MPI_STATUS_IGNORE );
+                _total_num_import += import_size;
+
+                // See if the neighbor we received from was someone we also
+                // sent to, otherwise record a new import-only neighbor.
+                auto found_neighbor =
+                    std::find( _neighbors.begin(), _neighbors.end(), source );
+                if ( found_neighbor == std::end( _neighbors ) )
+                {
+                    _neighbors.push_back( source );
+                    _num_import.push_back( import_size );
+                    _num_export.push_back( 0 );
+                }
+                else
+                {
+                    auto n =
+                        std::distance( _neighbors.begin(), found_neighbor );
+                    _num_import[n] = import_size;
+                }
+            }
+
+            if ( barrier_active )
+            {
+                MPI_Test( &barrier_request, &done, MPI_STATUS_IGNORE );
+            }
+            else
+            {
+                int sends_matched = 0;
+                MPI_Testall( send_requests.size(), send_requests.data(),
+                             &sends_matched, MPI_STATUSES_IGNORE );
+                if ( sends_matched )
+                {
+                    MPI_Ibarrier( comm(), &barrier_request );
+                    barrier_active = true;
+                }
+            }
+        }
+
+        // Return the neighbor ids.
+        return counts_and_ids.second;
+    }
+
+    /*!
+      \brief Export rank creator using non-blocking consensus (NBX) neighbor
+      discovery.
+
+      \param element_export_ranks The destination rank in the target
+      decomposition of each locally owned element in the source
+      decomposition. An export rank of -1 will signal that this element is
+      *not* to be exported and will be ignored in the data migration.
+
+      \return The location of each export element in the send buffer for its
+      given neighbor.
+    */
+    template <class ViewType>
+    Kokkos::View<size_type*, memory_space>
+    createFromExportsOnly( const ViewType& element_export_ranks,
+                           NbxDiscoveryTag tag )
+    {
+        // Use the default execution space.
+        return createFromExportsOnly( execution_space{}, element_export_ranks,
+                                      tag );
+    }
+
     /*!
       \brief Create the export steering vector.
 
@@ -1041,7 +1405,10 @@ class CommunicationPlan
 
   private:
     std::shared_ptr<MPI_Comm> _comm_ptr;
+    std::shared_ptr<MPI_Comm> _neighbor_comm_ptr;
     std::vector<int> _neighbors;
+    mutable std::vector<int> _send_schedule;
+    mutable std::size_t _num_node_local = 0;
     std::size_t _total_num_export;
     std::size_t _total_num_import;
     std::vector<std::size_t> _num_export;
@@ -1081,15 +1448,25 @@ struct CommunicationDataAoSoA
             Kokkos::ViewAllocateWithoutInitializing( "recv_buffer" ), 0 );
     }
 
-    //! Resize the send buffer.
+    //! Resize the send buffer. The buffer contents are always overwritten by
+    //! a subsequent pack so initialization is skipped.
     void reallocateSend( const std::size_t num_send )
     {
-        Kokkos::realloc( _send_buffer, num_send );
+        MemoryTracker::instance().deallocate(
+            "CommunicationBuffer", _send_buffer.size() * sizeof( data_type ) );
+        MemoryTracker::instance().allocate( "CommunicationBuffer",
+                                            num_send * sizeof( data_type ) );
+        Kokkos::realloc( Kokkos::WithoutInitializing, _send_buffer, num_send );
     }
-    //! Resize the receive buffer.
+    //! Resize the receive buffer. The buffer contents are always overwritten
+    //! by a subsequent receive so initialization is skipped.
     void reallocateReceive( const std::size_t num_recv )
     {
-        Kokkos::realloc( _recv_buffer, num_recv );
+        MemoryTracker::instance().deallocate(
+            "CommunicationBuffer", _recv_buffer.size() * sizeof( data_type ) );
+        MemoryTracker::instance().allocate( "CommunicationBuffer",
+                                            num_recv * sizeof( data_type ) );
+        Kokkos::realloc( Kokkos::WithoutInitializing, _recv_buffer, num_recv );
     }
 
     //! Send buffer.
@@ -1135,15 +1512,19 @@ struct CommunicationDataSlice
             Kokkos::ViewAllocateWithoutInitializing( "recv_buffer" ), 0, 0 );
     }
 
-    //! Resize the send buffer.
+    //! Resize the send buffer. The buffer contents are always overwritten by
+    //! a subsequent pack so initialization is skipped.
     void reallocateSend( const std::size_t num_send )
     {
-        Kokkos::realloc( _send_buffer, num_send, _num_comp );
+        Kokkos::realloc( Kokkos::WithoutInitializing, _send_buffer, num_send,
+                         _num_comp );
     }
-    //! Resize the receive buffer.
+    //! Resize the receive buffer. The buffer contents are always overwritten
+    //! by a subsequent receive so initialization is skipped.
     void reallocateReceive( const std::size_t num_recv )
     {
-        Kokkos::realloc( _recv_buffer, num_recv, _num_comp );
+        Kokkos::realloc( Kokkos::WithoutInitializing, _recv_buffer, num_recv,
+                         _num_comp );
     }
 
     //! Get the total number of components in the slice.
@@ -1311,6 +1692,263 @@ class CommunicationData
     std::size_t _recv_size;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Exchange protocol choices for the self-tuning selector.
+
+  Automatic keeps the compiled-in heuristics; the explicit values force a
+  path so the selector can measure each candidate.
+*/
+enum class ExchangeProtocol
+{
+    //! Compiled-in heuristics (collective when a neighbor comm exists,
+    //! host staging when MPI cannot reach device memory).
+    Automatic,
+    //! Per-neighbor point-to-point messages.
+    PointToPoint,
+    //! Single neighborhood collective (requires a neighbor comm).
+    Collective,
+    //! Point-to-point staged through host copies.
+    HostStaged
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Runtime exchange protocol selector keyed by message size class.
+
+  The optimal exchange variant changes with per-neighbor message size. The
+  selector rotates through the candidate protocols for each power-of-two
+  size class, timing one exchange per candidate, then serves the measured
+  fastest for all subsequent exchanges in that class. Pass one selector per
+  recurring exchange (migration, gather) to the protocol-aware overloads.
+*/
+class ExchangeProtocolSelector
+{
+  public:
+    /*!
+      \brief Constructor.
+      \param candidates The protocols to rotate through and measure.
+    */
+    ExchangeProtocolSelector(
+        const std::vector<ExchangeProtocol>& candidates =
+            { ExchangeProtocol::PointToPoint, ExchangeProtocol::Collective,
+              ExchangeProtocol::HostStaged } )
+        : _candidates( candidates )
+    {
+    }
+
+    //! Power-of-two size class of a message size.
+    static int sizeClass( const std::size_t bytes )
+    {
+        int size_class = 0;
+        std::size_t b = bytes;
+        while ( b >>= 1 )
+            ++size_class;
+        return size_class;
+    }
+
+    //! Choose the protocol for the next exchange of the given size.
+    ExchangeProtocol select( const std::size_t bytes ) const
+    {
+        const auto& state = _classes[sizeClass( bytes )];
+        if ( state.trials < static_cast<int>( _candidates.size() ) )
+            return _candidates[state.trials];
+        return _candidates[state.best];
+    }
+
+    //! Record the measured time of an exchange.
+    void record( const std::size_t bytes, const ExchangeProtocol protocol,
+                 const double seconds )
+    {
+        auto& state = _classes[sizeClass( bytes )];
+        if ( state.trials < static_cast<int>( _candidates.size() ) )
+        {
+            if ( seconds < state.best_time )
+            {
+                state.best_time = seconds;
+                for ( std::size_t c = 0; c < _candidates.size(); ++c )
+                    if ( _candidates[c] == protocol )
+                        state.best = c;
+            }
+            ++state.trials;
+        }
+    }
+
+    //! Whether a size class has finished measuring.
+    bool tuned( const std::size_t bytes ) const
+    {
+        const auto& state = _classes[sizeClass( bytes )];
+        return state.trials >= static_cast<int>( _candidates.size() );
+    }
+
+  private:
+    struct ClassState
+    {
+        int trials = 0;
+        int best = 0;
+        double best_time = std::numeric_limits<double>::max();
+    };
+    std::vector<ExchangeProtocol> _candidates;
+    mutable std::map<int, ClassState> _classes;
+};
+
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+// Record header for a hop of the aggregated exchange: final destination,
+// original source, and payload byte count.
+struct AggregatedRecordHeader
+{
+    int destination;
+    int source;
+    int num_byte;
+};
+
+// Exchange per-partner byte buffers: counts via MPI_Alltoall, payloads via
+// point-to-point messages to the nonzero partners.
+inline std::vector<std::vector<char>>
+exchangeAggregatedBuffers( MPI_Comm comm,
+                           const std::vector<std::vector<char>>& send_buffers )
+{
+    int comm_size;
+    MPI_Comm_size( comm, &comm_size );
+
+    std::vector<int> send_counts( comm_size );
+    for ( int r = 0; r < comm_size; ++r )
+        send_counts[r] = send_buffers[r].size();
+    std::vector<int> recv_counts( comm_size );
+    MPI_Alltoall( send_counts.data(), 1, MPI_INT, recv_counts.data(), 1,
+                  MPI_INT, comm );
+
+    std::vector<std::vector<char>> recv_buffers( comm_size );
+    std::vector<MPI_Request> requests;
+    const int mpi_tag = 2402;
+    for ( int r = 0; r < comm_size; ++r )
+        if ( recv_counts[r] > 0 )
+        {
+            recv_buffers[r].resize( recv_counts[r] );
+            requests.push_back( MPI_REQUEST_NULL );
+            MPI_Irecv( recv_buffers[r].data(), recv_counts[r], MPI_CHAR, r,
+                       mpi_tag, comm, &requests.back() );
+        }
+    for ( int r = 0; r < comm_size; ++r )
+        if ( send_counts[r] > 0 )
+        {
+            requests.push_back( MPI_REQUEST_NULL );
+            MPI_Isend( const_cast<char*>( send_buffers[r].data() ),
+                       send_counts[r], MPI_CHAR, r, mpi_tag, comm,
+                       &requests.back() );
+        }
+    MPI_Waitall( requests.size(), requests.data(), MPI_STATUSES_IGNORE );
+    return recv_buffers;
+}
+
+// Append a record to a hop buffer.
+inline void appendAggregatedRecord( std::vector<char>& buffer,
+                                    const AggregatedRecordHeader& header,
+                                    const char* payload )
+{
+    const char* header_bytes = reinterpret_cast<const char*>( &header );
+    buffer.insert( buffer.end(), header_bytes,
+                   header_bytes + sizeof( AggregatedRecordHeader ) );
+    buffer.insert( buffer.end(), payload, payload + header.num_byte );
+}
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Exchange many small per-rank payloads through a two-hop virtual
+  grid, aggregating messages en route.
+
+  \param comm The communicator over which to exchange.
+  \param destinations Destination rank of each payload.
+  \param payloads Byte payload for each destination.
+  \param source_ranks (Return) Source rank of each received payload.
+  \param received (Return) Received payloads, aligned with source_ranks.
+
+  Plans with hundreds of neighbors and tiny payloads pay NIC latency per
+  message. Ranks are arranged on a sqrt(P) x sqrt(P) virtual grid and every
+  payload routes through the intermediate sharing the sender's column and
+  the destination's row, so each rank sends to at most 2*(sqrt(P)-1)
+  partners per exchange and payloads sharing a hop coalesce into one
+  message - bytes traded for message count, the win at high rank counts.
+  Payloads are staged on the host; the intended use is metadata-sized
+  far-field exchanges, not bulk particle data.
+*/
+inline void aggregatedExchange( MPI_Comm comm,
+                                const std::vector<int>& destinations,
+                                const std::vector<std::vector<char>>& payloads,
+                                std::vector<int>& source_ranks,
+                                std::vector<std::vector<char>>& received )
+{
+    int my_rank;
+    MPI_Comm_rank( comm, &my_rank );
+    int comm_size;
+    MPI_Comm_size( comm, &comm_size );
+
+    // Virtual grid shape.
+    int q = 1;
+    while ( q * q < comm_size )
+        ++q;
+    const int my_col = my_rank % q;
+
+    // Hop 1: coalesce payloads by intermediate (destination row, own
+    // column). Intermediates off the ragged grid edge route direct.
+    std::vector<std::vector<char>> hop_buffers( comm_size );
+    for ( std::size_t p = 0; p < destinations.size(); ++p )
+    {
+        const int dest = destinations[p];
+        int intermediate = ( dest / q ) * q + my_col;
+        if ( intermediate >= comm_size )
+            intermediate = dest;
+        Impl::appendAggregatedRecord(
+            hop_buffers[intermediate],
+            { dest, my_rank, static_cast<int>( payloads[p].size() ) },
+            payloads[p].data() );
+    }
+    auto hop_received = Impl::exchangeAggregatedBuffers( comm, hop_buffers );
+
+    // Hop 2: regroup the relayed records by final destination.
+    std::vector<std::vector<char>> final_buffers( comm_size );
+    for ( int r = 0; r < comm_size; ++r )
+    {
+        const auto& buffer = hop_received[r];
+        std::size_t offset = 0;
+        while ( offset < buffer.size() )
+        {
+            Impl::AggregatedRecordHeader header;
+            std::memcpy( &header, buffer.data() + offset, sizeof( header ) );
+            offset += sizeof( header );
+            Impl::appendAggregatedRecord( final_buffers[header.destination],
+                                          header, buffer.data() + offset );
+            offset += header.num_byte;
+        }
+    }
+    auto final_received =
+        Impl::exchangeAggregatedBuffers( comm, final_buffers );
+
+    // Unpack the delivered records.
+    source_ranks.clear();
+    received.clear();
+    for ( int r = 0; r < comm_size; ++r )
+    {
+        const auto& buffer = final_received[r];
+        std::size_t offset = 0;
+        while ( offset < buffer.size() )
+        {
+            Impl::AggregatedRecordHeader header;
+            std::memcpy( &header, buffer.data() + offset, sizeof( header ) );
+            offset += sizeof( header );
+            source_ranks.push_back( header.source );
+            received.emplace_back( buffer.data() + offset,
+                                   buffer.data() + offset + header.num_byte );
+            offset += header.num_byte;
+        }
+    }
+}
+
 } // end namespace Cabana
 
 #endif // end CABANA_COMMUNICATIONPLAN_HPP
@@ -17,6 +17,7 @@
 #define CABANA_DEEPCOPY_HPP
 
 #include <Cabana_AoSoA.hpp>
+#include <Cabana_ParameterPack.hpp>
 #include <Cabana_ParticleList.hpp>
 #include <Cabana_Slice.hpp>
 #include <impl/Cabana_TypeTraits.hpp>
@@ -456,6 +457,354 @@ auto create_mirror_view_and_copy(
         aosoa_dst );
 }
 
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+// Copy one element of a slice pair through the raw strided data.
+template <class DstSlice, class SrcSlice>
+KOKKOS_INLINE_FUNCTION void copySliceElement( const DstSlice& dst,
+                                              const SrcSlice& src,
+                                              const std::size_t i )
+{
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < dst.viewRank(); ++d )
+        num_comp *= dst.extent( d );
+
+    auto dst_s = DstSlice::index_type::s( i );
+    auto dst_a = DstSlice::index_type::a( i );
+    std::size_t dst_offset = dst_s * dst.stride( 0 ) + dst_a;
+    auto src_s = SrcSlice::index_type::s( i );
+    auto src_a = SrcSlice::index_type::a( i );
+    std::size_t src_offset = src_s * src.stride( 0 ) + src_a;
+
+    auto dst_data = dst.data();
+    auto src_data = src.data();
+    for ( std::size_t n = 0; n < num_comp; ++n )
+        dst_data[dst_offset + DstSlice::vector_length * n] =
+            src_data[src_offset + SrcSlice::vector_length * n];
+}
+
+// Copy one element of every slice pair in the packs.
+template <class DstPack, class SrcPack, std::size_t... I>
+KOKKOS_INLINE_FUNCTION void copySliceElements( const DstPack& dst,
+                                               const SrcPack& src,
+                                               const std::size_t i,
+                                               std::index_sequence<I...> )
+{
+    ( copySliceElement( Cabana::get<I>( dst ), Cabana::get<I>( src ), i ),
+      ... );
+}
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Copy an arbitrary set of slice pairs in one kernel on the given
+  execution space instance.
+
+  \param exec_space Kokkos execution space instance. The copy is enqueued on
+  this instance and not fenced - callers overlap it with other streams and
+  fence the instance when the data is needed.
+  \param dst_slices Pack of destination slices built with
+  makeParameterPack(). May come from differently-shaped AoSoAs.
+  \param src_slices Pack of source slices, pairwise matching the
+  destinations in value type and component count.
+
+  Replaces one kernel launch and one index-arithmetic sweep per member with
+  a single launch covering the whole set.
+*/
+template <class ExecutionSpace, class... DstSlices, class... SrcSlices>
+void deep_copy( ExecutionSpace exec_space,
+                const ParameterPack<DstSlices...>& dst_slices,
+                const ParameterPack<SrcSlices...>& src_slices )
+{
+    static_assert( sizeof...( DstSlices ) == sizeof...( SrcSlices ),
+                   "Must copy between matching numbers of slices" );
+
+    auto n = Cabana::get<0>( dst_slices ).size();
+    Kokkos::parallel_for(
+        "Cabana::deep_copy::slices",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, n ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            Impl::copySliceElements(
+                dst_slices, src_slices, i,
+                std::make_index_sequence<sizeof...( DstSlices )>{} );
+        } );
+}
+
+/*!
+  \brief Copy an arbitrary set of slice pairs in one kernel with the default
+  execution space. Blocks until complete.
+*/
+template <class... DstSlices, class... SrcSlices>
+void deep_copy( const ParameterPack<DstSlices...>& dst_slices,
+                const ParameterPack<SrcSlices...>& src_slices )
+{
+    using exec_space = typename Cabana::ParameterPack<
+        DstSlices...>::template value_type<0>::execution_space;
+    deep_copy( exec_space{}, dst_slices, src_slices );
+    Kokkos::fence();
+}
+
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+// Monotonically grown pinned host staging buffer, released through a Kokkos
+// finalize hook.
+inline Kokkos::View<char*, Kokkos::SharedHostPinnedSpace>
+pinnedStagingBuffer( const std::size_t bytes )
+{
+    static auto* buffer = []()
+    {
+        auto* pool = new Kokkos::View<char*, Kokkos::SharedHostPinnedSpace>(
+            Kokkos::ViewAllocateWithoutInitializing( "pinned_staging" ), 0 );
+        Kokkos::push_finalize_hook( [=]() { delete pool; } );
+        return pool;
+    }();
+    if ( buffer->extent( 0 ) < bytes )
+        Kokkos::realloc( Kokkos::WithoutInitializing, *buffer, bytes );
+    return *buffer;
+}
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Deep copy between AoSoAs staging through a pinned host buffer.
+
+  \param dst The destination for the copied data.
+  \param src The source of the copied data.
+
+  Host-device transfers from pageable host memory run at a fraction of the
+  link bandwidth; staging the block through a pooled pinned buffer restores
+  full-rate DMA without requiring the host container itself to live in
+  pinned memory. The pinned pool grows monotonically and is shared
+  process-wide. Use for dump and restart paths where the host side is an
+  ordinary HostSpace container.
+*/
+template <class DstAoSoA, class SrcAoSoA>
+void deep_copy_staged(
+    DstAoSoA& dst, const SrcAoSoA& src,
+    typename std::enable_if<( is_aosoa<DstAoSoA>::value &&
+                              is_aosoa<SrcAoSoA>::value )>::type* = 0 )
+{
+    static_assert(
+        std::is_same<typename DstAoSoA::member_types,
+                     typename SrcAoSoA::member_types>::value,
+        "Attempted to deep copy AoSoA objects of different member types" );
+    static_assert( DstAoSoA::vector_length == SrcAoSoA::vector_length,
+                   "Staged copy requires matching vector lengths" );
+
+    if ( dst.size() != src.size() )
+        throw std::runtime_error(
+            "Attempted to deep copy AoSoA objects of different sizes" );
+
+    const std::size_t bytes =
+        src.numSoA() * sizeof( typename SrcAoSoA::soa_type );
+    if ( 0 == bytes )
+        return;
+
+    auto staging = Impl::pinnedStagingBuffer( bytes );
+    Kokkos::View<char*, Kokkos::SharedHostPinnedSpace> staging_block(
+        staging.data(), bytes );
+
+    // Source block to pinned staging, then staging to the destination. Both
+    // legs run at full link rate.
+    Kokkos::View<const char*, typename SrcAoSoA::memory_space,
+                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+        src_bytes( reinterpret_cast<const char*>( src.data() ), bytes );
+    Kokkos::View<char*, typename DstAoSoA::memory_space,
+                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+        dst_bytes( reinterpret_cast<char*>( dst.data() ), bytes );
+    Kokkos::deep_copy( staging_block, src_bytes );
+    Kokkos::deep_copy( dst_bytes, staging_block );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Fused whole-slice linear update: y = a * x + b * y in one kernel.
+
+  \param exec_space Kokkos execution space instance. Enqueued without a
+  fence so updates compose on a stream.
+  \param a The x scale factor.
+  \param x The input slice.
+  \param b The y scale factor.
+  \param y The slice updated in place. Must match x in size and component
+  count.
+
+  Covers the v = v + dt * f family of updates without a hand-written
+  simd_parallel_for: all components of each element update in one fused
+  sweep through the raw strided data, with exactly one read and one write
+  of y and one read of x.
+*/
+template <class ExecutionSpace, class XSlice, class YSlice>
+void sliceAxpby( ExecutionSpace exec_space,
+                 const typename YSlice::value_type a, const XSlice& x,
+                 const typename YSlice::value_type b, const YSlice& y )
+{
+    static_assert( is_slice<XSlice>::value && is_slice<YSlice>::value,
+                   "sliceAxpby requires slices" );
+    using value_type = typename YSlice::value_type;
+
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < y.viewRank(); ++d )
+        num_comp *= y.extent( d );
+
+    auto x_data = x.data();
+    auto y_data = y.data();
+    Kokkos::parallel_for(
+        "Cabana::sliceAxpby",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, y.size() ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            auto x_s = XSlice::index_type::s( i );
+            auto x_a = XSlice::index_type::a( i );
+            std::size_t x_offset = x_s * x.stride( 0 ) + x_a;
+            auto y_s = YSlice::index_type::s( i );
+            auto y_a = YSlice::index_type::a( i );
+            std::size_t y_offset = y_s * y.stride( 0 ) + y_a;
+            for ( std::size_t n = 0; n < num_comp; ++n )
+            {
+                const value_type x_value = static_cast<value_type>(
+                    x_data[x_offset + XSlice::vector_length * n] );
+                value_type& y_value =
+                    y_data[y_offset + YSlice::vector_length * n];
+                y_value = a * x_value + b * y_value;
+            }
+        } );
+}
+
+/*!
+  \brief Fused whole-slice linear update with the default execution space.
+  Blocks until complete.
+*/
+template <class XSlice, class YSlice>
+void sliceAxpby( const typename YSlice::value_type a, const XSlice& x,
+                 const typename YSlice::value_type b, const YSlice& y )
+{
+    sliceAxpby( typename YSlice::execution_space{}, a, x, b, y );
+    Kokkos::fence();
+}
+
+/*!
+  \brief Scale a slice in place: x = a * x in one kernel.
+  \param exec_space Kokkos execution space instance (not fenced).
+  \param a The scale factor.
+  \param x The slice scaled in place.
+*/
+template <class ExecutionSpace, class SliceType>
+void sliceScale( ExecutionSpace exec_space,
+                 const typename SliceType::value_type a, const SliceType& x )
+{
+    static_assert( is_slice<SliceType>::value, "sliceScale requires a slice" );
+
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < x.viewRank(); ++d )
+        num_comp *= x.extent( d );
+
+    auto x_data = x.data();
+    Kokkos::parallel_for(
+        "Cabana::sliceScale",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, x.size() ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            auto s = SliceType::index_type::s( i );
+            auto a_idx = SliceType::index_type::a( i );
+            std::size_t offset = s * x.stride( 0 ) + a_idx;
+            for ( std::size_t n = 0; n < num_comp; ++n )
+                x_data[offset + SliceType::vector_length * n] *= a;
+        } );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Gather the tuples at the given indices into a destination AoSoA in
+  a single kernel launch.
+
+  \param exec_space Kokkos execution space.
+  \param src The AoSoA to gather from.
+  \param indices View of tuple indices into the source, one per destination
+  tuple.
+  \param dst The AoSoA to write the gathered tuples to. Must hold at least
+  indices.extent(0) tuples and share the source member types.
+
+  All members of each tuple move in one launch, replacing the
+  kernel-per-member emulation of indexed particle access (e.g. boundary
+  condition injection).
+*/
+template <class ExecutionSpace, class SrcAoSoA, class IndexView,
+          class DstAoSoA>
+void gatherTuples( ExecutionSpace exec_space, const SrcAoSoA& src,
+                   const IndexView& indices, DstAoSoA& dst )
+{
+    static_assert( is_aosoa<SrcAoSoA>::value && is_aosoa<DstAoSoA>::value,
+                   "Cabana::gatherTuples requires AoSoAs" );
+    static_assert( std::is_same<typename SrcAoSoA::tuple_type,
+                                typename DstAoSoA::tuple_type>::value,
+                   "AoSoA tuple types must match" );
+
+    Kokkos::parallel_for(
+        "Cabana::gatherTuples",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0,
+                                             indices.extent( 0 ) ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            dst.setTuple( i, src.getTuple( indices( i ) ) );
+        } );
+    Kokkos::fence();
+}
+
+/*!
+  \brief Gather tuples with the default execution space.
+*/
+template <class SrcAoSoA, class IndexView, class DstAoSoA>
+void gatherTuples( const SrcAoSoA& src, const IndexView& indices,
+                   DstAoSoA& dst )
+{
+    gatherTuples( typename SrcAoSoA::execution_space{}, src, indices, dst );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Scatter the tuples of a source AoSoA to the given indices of a
+  destination AoSoA in a single kernel launch.
+
+  \param exec_space Kokkos execution space.
+  \param src The AoSoA to scatter from.
+  \param indices View of destination tuple indices, one per source tuple.
+  The indices must be unique.
+  \param dst The AoSoA to write the scattered tuples to.
+*/
+template <class ExecutionSpace, class SrcAoSoA, class IndexView,
+          class DstAoSoA>
+void scatterTuples( ExecutionSpace exec_space, const SrcAoSoA& src,
+                    const IndexView& indices, DstAoSoA& dst )
+{
+    static_assert( is_aosoa<SrcAoSoA>::value && is_aosoa<DstAoSoA>::value,
+                   "Cabana::scatterTuples requires AoSoAs" );
+    static_assert( std::is_same<typename SrcAoSoA::tuple_type,
+                                typename DstAoSoA::tuple_type>::value,
+                   "AoSoA tuple types must match" );
+
+    Kokkos::parallel_for(
+        "Cabana::scatterTuples",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0,
+                                             indices.extent( 0 ) ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            dst.setTuple( indices( i ), src.getTuple( i ) );
+        } );
+    Kokkos::fence();
+}
+
+/*!
+  \brief Scatter tuples with the default execution space.
+*/
+template <class SrcAoSoA, class IndexView, class DstAoSoA>
+void scatterTuples( const SrcAoSoA& src, const IndexView& indices,
+                    DstAoSoA& dst )
+{
+    scatterTuples( typename SrcAoSoA::execution_space{}, src, indices, dst );
+}
+
 } // end namespace Cabana
 
 #endif // end CABANA_DEEPCOPY_HPP
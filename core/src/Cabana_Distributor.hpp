@@ -18,6 +18,9 @@
 
 #include <Cabana_AoSoA.hpp>
 #include <Cabana_CommunicationPlan.hpp>
+#include <Cabana_DeepCopy.hpp>
+#include <Cabana_Instrumentation.hpp>
+#include <Cabana_Remove.hpp>
 #include <Cabana_Slice.hpp>
 
 #include <Kokkos_Core.hpp>
@@ -25,6 +28,7 @@
 
 #include <mpi.h>
 
+#include <algorithm>
 #include <exception>
 #include <vector>
 
@@ -166,6 +170,144 @@ struct is_distributor
 namespace Impl
 {
 //! \cond Impl
+//---------------------------------------------------------------------------//
+// Exchange packed, neighbor-contiguous send/receive buffers according to the
+// distributor plan. The buffers may live in any MPI-accessible memory space.
+template <class Distributor_t, class SendBuffer, class RecvBuffer>
+void exchangeBuffers( const Distributor_t& distributor, const int my_rank,
+                      SendBuffer send_buffer, RecvBuffer recv_buffer,
+                      const ExchangeProtocol protocol =
+                          ExchangeProtocol::Automatic )
+{
+    using value_type = typename SendBuffer::value_type;
+
+    int num_n = distributor.numNeighbor();
+
+    // Collective exchange when forced or selected by the plan; the
+    // collective requires the static graph topology either way.
+    const bool use_collective =
+        distributor.hasNeighborComm() &&
+        ( ExchangeProtocol::Collective == protocol ||
+          ExchangeProtocol::Automatic == protocol );
+    if ( use_collective )
+    {
+        // Exchange with a single neighborhood collective over the static
+        // graph topology. The collective neighbor order matches the plan
+        // neighbor order. Self-sends were already copied locally so their
+        // counts are zero, but their displacements still skip the staying
+        // data at the front of the receive buffer.
+        const int tuple_bytes = sizeof( value_type );
+        std::vector<int> send_counts( num_n ), send_displs( num_n );
+        std::vector<int> recv_counts( num_n ), recv_displs( num_n );
+        int send_offset = 0;
+        int recv_offset = 0;
+        for ( int n = 0; n < num_n; ++n )
+        {
+            const bool self_send = ( distributor.neighborRank( n ) == my_rank );
+            send_counts[n] =
+                self_send ? 0 : distributor.numExport( n ) * tuple_bytes;
+            send_displs[n] = send_offset;
+            send_offset += send_counts[n];
+            recv_counts[n] =
+                self_send ? 0 : distributor.numImport( n ) * tuple_bytes;
+            recv_displs[n] = recv_offset;
+            recv_offset += distributor.numImport( n ) * tuple_bytes;
+        }
+        const int ec = MPI_Neighbor_alltoallv(
+            send_buffer.data(), send_counts.data(), send_displs.data(),
+            MPI_BYTE, recv_buffer.data(), recv_counts.data(),
+            recv_displs.data(), MPI_BYTE, distributor.neighborComm() );
+        if ( MPI_SUCCESS != ec )
+            throw std::logic_error( "Failed MPI Communication" );
+    }
+    else
+    {
+        // The distributor has its own communication space so choose any tag.
+        const int mpi_tag = 1234;
+
+        // Post non-blocking receives.
+        std::vector<MPI_Request> requests;
+        requests.reserve( 2 * num_n );
+        std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
+        for ( int n = 0; n < num_n; ++n )
+        {
+            recv_range.second = recv_range.first + distributor.numImport( n );
+
+            if ( ( distributor.numImport( n ) > 0 ) &&
+                 ( distributor.neighborRank( n ) != my_rank ) )
+            {
+                auto recv_subview = Kokkos::subview( recv_buffer, recv_range );
+
+                requests.push_back( MPI_Request() );
+
+                MPI_Irecv( recv_subview.data(),
+                           recv_subview.size() * sizeof( value_type ),
+                           MPI_BYTE, distributor.neighborRank( n ), mpi_tag,
+                           distributor.comm(), &( requests.back() ) );
+            }
+
+            recv_range.first = recv_range.second;
+        }
+
+        // Two-level topology-aware sends: off-node messages post
+        // non-blocking first (staggered by rank so simultaneous senders
+        // spread over distinct destinations) and occupy the NIC while the
+        // node-local messages copy through shared memory behind them.
+        std::vector<std::size_t> send_offsets( num_n, 0 );
+        for ( int n = 1; n < num_n; ++n )
+        {
+            std::size_t previous =
+                ( distributor.neighborRank( n - 1 ) != my_rank )
+                    ? distributor.numExport( n - 1 )
+                    : 0;
+            send_offsets[n] = send_offsets[n - 1] + previous;
+        }
+        const auto& schedule = distributor.createSendSchedule();
+        const std::size_t num_node_local =
+            distributor.numNodeLocalNeighbors();
+        auto post_send = [&]( const int n, const bool blocking )
+        {
+            if ( ( distributor.numExport( n ) > 0 ) &&
+                 ( distributor.neighborRank( n ) != my_rank ) )
+            {
+                auto send_subview = Kokkos::subview(
+                    send_buffer,
+                    std::pair<std::size_t, std::size_t>(
+                        send_offsets[n],
+                        send_offsets[n] + distributor.numExport( n ) ) );
+
+                if ( blocking )
+                {
+                    MPI_Send( send_subview.data(),
+                              send_subview.size() * sizeof( value_type ),
+                              MPI_BYTE, distributor.neighborRank( n ),
+                              mpi_tag, distributor.comm() );
+                }
+                else
+                {
+                    requests.push_back( MPI_Request() );
+                    MPI_Isend( send_subview.data(),
+                               send_subview.size() * sizeof( value_type ),
+                               MPI_BYTE, distributor.neighborRank( n ),
+                               mpi_tag, distributor.comm(),
+                               &requests.back() );
+                }
+            }
+        };
+        for ( std::size_t i = num_node_local; i < schedule.size(); ++i )
+            post_send( schedule[i], false );
+        for ( std::size_t i = 0; i < num_node_local; ++i )
+            post_send( schedule[i], true );
+
+        // Wait on non-blocking receives.
+        std::vector<MPI_Status> status( requests.size() );
+        const int ec =
+            MPI_Waitall( requests.size(), requests.data(), status.data() );
+        if ( MPI_SUCCESS != ec )
+            throw std::logic_error( "Failed MPI Communication" );
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Synchronously move data between a source and destination AoSoA by executing
 // the forward communication plan.
@@ -173,11 +315,16 @@ template <class ExecutionSpace, class Distributor_t, class AoSoA_t>
 void distributeData(
     ExecutionSpace, const Distributor_t& distributor, const AoSoA_t& src,
     AoSoA_t& dst,
+    const ExchangeProtocol protocol = ExchangeProtocol::Automatic,
     typename std::enable_if<( is_distributor<Distributor_t>::value &&
                               is_aosoa<AoSoA_t>::value ),
                             int>::type* = 0 )
 {
     Kokkos::Profiling::ScopedRegion region( "Cabana::migrate" );
+    ScopedOperationTimer operation_timer(
+        "migrate", ( distributor.totalNumExport() +
+                     distributor.totalNumImport() ) *
+                       sizeof( typename AoSoA_t::tuple_type ) );
 
     static_assert( is_accessible_from<typename Distributor_t::memory_space,
                                       ExecutionSpace>{},
@@ -229,69 +376,43 @@ void distributeData(
         else
             send_buffer( i - num_stay ) = tpl;
     };
+    Kokkos::Profiling::pushRegion( "Cabana::migrate::pack" );
     Kokkos::RangePolicy<ExecutionSpace> build_send_buffer_policy(
         0, distributor.totalNumExport() );
     Kokkos::parallel_for( "Cabana::Impl::distributeData::build_send_buffer",
                           build_send_buffer_policy, build_send_buffer_func );
     Kokkos::fence();
-
-    // The distributor has its own communication space so choose any tag.
-    const int mpi_tag = 1234;
-
-    // Post non-blocking receives.
-    std::vector<MPI_Request> requests;
-    requests.reserve( num_n );
-    std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
-    for ( int n = 0; n < num_n; ++n )
+    Kokkos::Profiling::popRegion();
+
+    // Exchange the buffers, staging through host copies when MPI cannot
+    // access the device memory directly.
+    Kokkos::Profiling::pushRegion( "Cabana::migrate::exchange" );
+    using memory_space = typename Distributor_t::memory_space;
+    const bool must_stage =
+        !Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                    memory_space>::accessible &&
+        !gpuAwareMpiSupported();
+    if ( must_stage || ExchangeProtocol::HostStaged == protocol )
     {
-        recv_range.second = recv_range.first + distributor.numImport( n );
-
-        if ( ( distributor.numImport( n ) > 0 ) &&
-             ( distributor.neighborRank( n ) != my_rank ) )
-        {
-            auto recv_subview = Kokkos::subview( recv_buffer, recv_range );
-
-            requests.push_back( MPI_Request() );
-
-            MPI_Irecv( recv_subview.data(),
-                       recv_subview.size() *
-                           sizeof( typename AoSoA_t::tuple_type ),
-                       MPI_BYTE, distributor.neighborRank( n ), mpi_tag,
-                       distributor.comm(), &( requests.back() ) );
-        }
-
-        recv_range.first = recv_range.second;
+        // The receive buffer already holds the staying data so it must be
+        // copied to the host as well.
+        auto send_host = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), send_buffer );
+        auto recv_host = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), recv_buffer );
+        exchangeBuffers( distributor, my_rank, send_host, recv_host );
+        Kokkos::deep_copy( recv_buffer, recv_host );
     }
-
-    // Do blocking sends.
-    std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
-    for ( int n = 0; n < num_n; ++n )
+    else
     {
-        if ( ( distributor.numExport( n ) > 0 ) &&
-             ( distributor.neighborRank( n ) != my_rank ) )
-        {
-            send_range.second = send_range.first + distributor.numExport( n );
-
-            auto send_subview = Kokkos::subview( send_buffer, send_range );
-
-            MPI_Send( send_subview.data(),
-                      send_subview.size() *
-                          sizeof( typename AoSoA_t::tuple_type ),
-                      MPI_BYTE, distributor.neighborRank( n ), mpi_tag,
-                      distributor.comm() );
-
-            send_range.first = send_range.second;
-        }
+        exchangeBuffers( distributor, my_rank, send_buffer, recv_buffer,
+                         protocol );
     }
 
-    // Wait on non-blocking receives.
-    std::vector<MPI_Status> status( requests.size() );
-    const int ec =
-        MPI_Waitall( requests.size(), requests.data(), status.data() );
-    if ( MPI_SUCCESS != ec )
-        throw std::logic_error( "Failed MPI Communication" );
+    Kokkos::Profiling::popRegion();
 
     // Extract the receive buffer into the destination AoSoA.
+    Kokkos::Profiling::pushRegion( "Cabana::migrate::unpack" );
     auto extract_recv_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
     {
         dst.setTuple( i, recv_buffer( i ) );
@@ -302,6 +423,7 @@ void distributeData(
                           extract_recv_buffer_policy,
                           extract_recv_buffer_func );
     Kokkos::fence();
+    Kokkos::Profiling::popRegion();
 
     // Barrier before completing to ensure synchronization.
     MPI_Barrier( distributor.comm() );
@@ -349,6 +471,50 @@ void migrate( ExecutionSpace exec_space, const Distributor_t& distributor,
     Impl::distributeData( exec_space, distributor, src, dst );
 }
 
+/*!
+  \brief Synchronously migrate data with runtime-measured exchange protocol
+  selection.
+
+  \param selector The protocol selector. The first migrations of each
+  message size class measure the candidate protocols; later migrations in
+  the class run the measured fastest.
+  \param distributor The distributor to use for the migration.
+  \param src The AoSoA containing the data to be migrated.
+  \param dst The AoSoA to which the migrated data will be written.
+*/
+template <class Distributor_t, class AoSoA_t>
+void migrate( ExchangeProtocolSelector& selector,
+              const Distributor_t& distributor, const AoSoA_t& src,
+              AoSoA_t& dst,
+              typename std::enable_if<( is_distributor<Distributor_t>::value &&
+                                        is_aosoa<AoSoA_t>::value ),
+                                      int>::type* = 0 )
+{
+    if ( src.size() != distributor.exportSize() )
+        throw std::runtime_error( "Source is the wrong size for migration!" );
+    if ( dst.size() != distributor.totalNumImport() )
+        throw std::runtime_error(
+            "Destination is the wrong size for migration!" );
+
+    // Classify by the largest per-neighbor payload - the message whose
+    // protocol dominates.
+    std::size_t max_bytes = 0;
+    for ( int n = 0; n < distributor.numNeighbor(); ++n )
+    {
+        const std::size_t bytes = distributor.numExport( n ) *
+                                  sizeof( typename AoSoA_t::tuple_type );
+        if ( bytes > max_bytes )
+            max_bytes = bytes;
+    }
+
+    auto protocol = selector.select( max_bytes );
+    using execution_space = typename Distributor_t::execution_space;
+    const double start = MPI_Wtime();
+    Impl::distributeData( execution_space{}, distributor, src, dst,
+                          protocol );
+    selector.record( max_bytes, protocol, MPI_Wtime() - start );
+}
+
 /*!
   \brief Synchronously migrate data between two different decompositions using
   the distributor forward communication plan. Multiple AoSoA version.
@@ -376,6 +542,586 @@ void migrate( const Distributor_t& distributor, const AoSoA_t& src,
     migrate( typename Distributor_t::execution_space{}, distributor, src, dst );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Migrate a CSR-style variable-length auxiliary payload alongside a
+  distributor plan.
+
+  \tparam Distributor_t Distributor type - must be a distributor.
+  \tparam CountView Per-element count view type (integer).
+  \tparam ValueView Flat value view type.
+
+  \param distributor The distributor the particles are migrated with.
+  \param src_counts The per-element value counts in the source
+  decomposition. Sized to the distributor export size.
+  \param src_values The flat values, element blocks ordered by element.
+  \param dst_counts Filled with the per-element counts in the new
+  decomposition (sized to the number of imports).
+  \param dst_values Filled with the flat values in the new decomposition.
+
+  Two-phase exchange: the fixed-size counts travel through the plan first,
+  then each neighbor's variable-sized value block is exchanged directly
+  into its CSR position - no fixed max-size serialization and no message
+  inflation for short rows. Value blocks arrive ordered consistently with
+  dst_counts, so offsets from scanning dst_counts index dst_values.
+*/
+template <class Distributor_t, class CountView, class ValueView>
+void migrateRagged( const Distributor_t& distributor,
+                    const CountView& src_counts, const ValueView& src_values,
+                    CountView& dst_counts, ValueView& dst_values,
+                    typename std::enable_if<is_distributor<Distributor_t>::value,
+                                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::migrateRagged" );
+
+    using memory_space = typename Distributor_t::memory_space;
+    using execution_space = typename memory_space::execution_space;
+    using value_type = typename ValueView::non_const_value_type;
+
+    int my_rank = -1;
+    MPI_Comm_rank( distributor.comm(), &my_rank );
+    const int num_n = distributor.numNeighbor();
+    auto steering = distributor.getExportSteering();
+    const std::size_t num_export = distributor.totalNumExport();
+    const std::size_t num_import = distributor.totalNumImport();
+
+    // Phase 1: move the counts through the plan. Pack in steering order so
+    // the send buffer is neighbor contiguous.
+    Kokkos::View<int*, memory_space> send_counts(
+        Kokkos::ViewAllocateWithoutInitializing( "ragged_send_counts" ),
+        num_export );
+    Kokkos::parallel_for(
+        "Cabana::migrateRagged::pack_counts",
+        Kokkos::RangePolicy<execution_space>( 0, num_export ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            send_counts( i ) = src_counts( steering( i ) );
+        } );
+    Kokkos::fence();
+    Kokkos::realloc( Kokkos::WithoutInitializing, dst_counts, num_import );
+
+    // The stay segment (self neighbor is always first) copies locally; the
+    // exchange helper skips self messages.
+    std::size_t num_stay =
+        ( num_n > 0 && distributor.neighborRank( 0 ) == my_rank )
+            ? distributor.numExport( 0 )
+            : 0;
+    if ( num_stay > 0 )
+    {
+        auto stay_range = Kokkos::pair<std::size_t, std::size_t>( 0,
+                                                                  num_stay );
+        Kokkos::deep_copy( Kokkos::subview( dst_counts, stay_range ),
+                           Kokkos::subview( send_counts, stay_range ) );
+    }
+    // Reuse the plan exchange over the non-stay regions by passing the full
+    // neighbor-contiguous buffers.
+    Impl::exchangeBuffers(
+        distributor, my_rank,
+        Kokkos::subview( send_counts,
+                         Kokkos::pair<std::size_t, std::size_t>( num_stay,
+                                                                 num_export ) ),
+        dst_counts );
+
+    // Compute the per-neighbor value totals on both sides from the counts.
+    auto count_segment_sum = []( auto counts, const std::size_t begin,
+                                 const std::size_t end )
+    {
+        long sum = 0;
+        Kokkos::parallel_reduce(
+            "Cabana::migrateRagged::segment_sum",
+            Kokkos::RangePolicy<execution_space>( begin, end ),
+            KOKKOS_LAMBDA( const std::size_t i, long& s ) {
+                s += counts( i );
+            },
+            sum );
+        Kokkos::fence();
+        return static_cast<std::size_t>( sum );
+    };
+    std::vector<std::size_t> send_value_counts( num_n );
+    std::vector<std::size_t> recv_value_counts( num_n );
+    std::size_t send_offset = 0;
+    std::size_t recv_offset = 0;
+    for ( int n = 0; n < num_n; ++n )
+    {
+        send_value_counts[n] = count_segment_sum(
+            send_counts, send_offset,
+            send_offset + distributor.numExport( n ) );
+        send_offset += distributor.numExport( n );
+        recv_value_counts[n] = count_segment_sum(
+            dst_counts, recv_offset,
+            recv_offset + distributor.numImport( n ) );
+        recv_offset += distributor.numImport( n );
+    }
+
+    // Phase 2: pack the values in steering order using a scan of the packed
+    // counts and exchange each neighbor's block directly into its CSR
+    // position.
+    Kokkos::View<std::size_t*, memory_space> send_value_offsets(
+        Kokkos::ViewAllocateWithoutInitializing( "ragged_send_offsets" ),
+        num_export );
+    std::size_t total_send_values = 0;
+    Kokkos::parallel_scan(
+        "Cabana::migrateRagged::send_offset_scan",
+        Kokkos::RangePolicy<execution_space>( 0, num_export ),
+        KOKKOS_LAMBDA( const std::size_t i, std::size_t& update,
+                       const bool final_pass ) {
+            if ( final_pass )
+                send_value_offsets( i ) = update;
+            update += send_counts( i );
+        },
+        total_send_values );
+
+    // Offsets of the source elements in the source values.
+    const std::size_t num_src = src_counts.extent( 0 );
+    Kokkos::View<std::size_t*, memory_space> src_value_offsets(
+        Kokkos::ViewAllocateWithoutInitializing( "ragged_src_offsets" ),
+        num_src );
+    Kokkos::parallel_scan(
+        "Cabana::migrateRagged::src_offset_scan",
+        Kokkos::RangePolicy<execution_space>( 0, num_src ),
+        KOKKOS_LAMBDA( const std::size_t i, std::size_t& update,
+                       const bool final_pass ) {
+            if ( final_pass )
+                src_value_offsets( i ) = update;
+            update += src_counts( i );
+        } );
+    Kokkos::fence();
+
+    Kokkos::View<value_type*, memory_space> send_values(
+        Kokkos::ViewAllocateWithoutInitializing( "ragged_send_values" ),
+        total_send_values );
+    Kokkos::parallel_for(
+        "Cabana::migrateRagged::pack_values",
+        Kokkos::RangePolicy<execution_space>( 0, num_export ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            const std::size_t element = steering( i );
+            const std::size_t src_off = src_value_offsets( element );
+            const std::size_t dst_off = send_value_offsets( i );
+            for ( int v = 0; v < send_counts( i ); ++v )
+                send_values( dst_off + v ) = src_values( src_off + v );
+        } );
+    Kokkos::fence();
+
+    // Exchange the value blocks.
+    std::size_t total_recv_values = 0;
+    for ( int n = 0; n < num_n; ++n )
+        total_recv_values += recv_value_counts[n];
+    Kokkos::realloc( Kokkos::WithoutInitializing, dst_values,
+                     total_recv_values );
+
+    const int mpi_tag = 1237;
+    std::vector<MPI_Request> requests;
+    requests.reserve( num_n );
+    recv_offset = 0;
+    for ( int n = 0; n < num_n; ++n )
+    {
+        if ( recv_value_counts[n] > 0 &&
+             distributor.neighborRank( n ) != my_rank )
+        {
+            requests.push_back( MPI_Request() );
+            MPI_Irecv( dst_values.data() + recv_offset,
+                       recv_value_counts[n] * sizeof( value_type ), MPI_BYTE,
+                       distributor.neighborRank( n ), mpi_tag,
+                       distributor.comm(), &requests.back() );
+        }
+        recv_offset += recv_value_counts[n];
+    }
+    send_offset = 0;
+    for ( int n = 0; n < num_n; ++n )
+    {
+        if ( send_value_counts[n] > 0 )
+        {
+            if ( distributor.neighborRank( n ) != my_rank )
+            {
+                MPI_Send( send_values.data() + send_offset,
+                          send_value_counts[n] * sizeof( value_type ),
+                          MPI_BYTE, distributor.neighborRank( n ), mpi_tag,
+                          distributor.comm() );
+            }
+            else
+            {
+                // The stay values copy locally into the front of the
+                // destination (the self neighbor is first on both sides).
+                auto stay_send = Kokkos::subview(
+                    send_values, Kokkos::pair<std::size_t, std::size_t>(
+                                     send_offset,
+                                     send_offset + send_value_counts[n] ) );
+                auto stay_recv = Kokkos::subview(
+                    dst_values, Kokkos::pair<std::size_t, std::size_t>(
+                                    0, send_value_counts[n] ) );
+                Kokkos::deep_copy( stay_recv, stay_send );
+            }
+        }
+        send_offset += send_value_counts[n];
+    }
+    std::vector<MPI_Status> status( requests.size() );
+    const int ec =
+        MPI_Waitall( requests.size(), requests.data(), status.data() );
+    if ( MPI_SUCCESS != ec )
+        throw std::logic_error( "Failed MPI Communication" );
+
+    MPI_Barrier( distributor.comm() );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Incremental in-place migration for low-mover steps.
+
+  \tparam ExecutionSpace Kokkos execution space.
+  \tparam AoSoAType AoSoA type.
+  \tparam RankView Export rank view type.
+
+  \param exec_space Kokkos execution space.
+  \param comm The MPI communicator over which to migrate.
+  \param element_export_ranks The destination rank of every particle. The
+  calling rank means the particle stays; -1 deletes it.
+  \param aosoa The particle data, migrated in place.
+
+  Only the leaving particles are gathered into a small send container and
+  communicated; arrivals fill the leavers' holes in place with no global
+  reorder, extra arrivals append at the end, and excess holes are closed by
+  moving a few tail particles in. Steady-state migration cost then scales
+  with the number of movers instead of the container size. Particle order
+  is not preserved across calls - run an occasional full migrate() or sort
+  when ordering matters.
+*/
+template <class ExecutionSpace, class AoSoAType, class RankView>
+void migrateIncremental( ExecutionSpace exec_space, MPI_Comm comm,
+                         const RankView& element_export_ranks,
+                         AoSoAType& aosoa )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::migrateIncremental" );
+
+    using memory_space = typename AoSoAType::memory_space;
+
+    int my_rank = -1;
+    MPI_Comm_rank( comm, &my_rank );
+
+    // Find the leavers.
+    const std::size_t num_particle = aosoa.size();
+    Kokkos::View<int*, memory_space> leaver_indices(
+        Kokkos::ViewAllocateWithoutInitializing( "leaver_indices" ),
+        num_particle );
+    std::size_t num_leaver = 0;
+    Kokkos::parallel_scan(
+        "Cabana::migrateIncremental::find_leavers",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, num_particle ),
+        KOKKOS_LAMBDA( const std::size_t i, std::size_t& count,
+                       const bool final_pass ) {
+            if ( element_export_ranks( i ) != my_rank )
+            {
+                if ( final_pass )
+                    leaver_indices( count ) = i;
+                ++count;
+            }
+        },
+        num_leaver );
+    Kokkos::fence();
+
+    // Gather the leavers and their destinations into small send data. Every
+    // rank participates even with no leavers since arrivals may still come.
+    AoSoAType leavers( "migrate_leavers", num_leaver );
+    auto leaver_subindices = Kokkos::subview(
+        leaver_indices, Kokkos::pair<std::size_t, std::size_t>( 0,
+                                                                num_leaver ) );
+    gatherTuples( exec_space, aosoa, leaver_subindices, leavers );
+    Kokkos::View<int*, memory_space> leaver_ranks(
+        Kokkos::ViewAllocateWithoutInitializing( "leaver_ranks" ),
+        num_leaver );
+    Kokkos::parallel_for(
+        "Cabana::migrateIncremental::leaver_ranks",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, num_leaver ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            leaver_ranks( i ) = element_export_ranks( leaver_subindices( i ) );
+        } );
+    Kokkos::fence();
+
+    // Migrate only the movers.
+    Distributor<memory_space> distributor( comm, leaver_ranks );
+    AoSoAType arrivals( "migrate_arrivals", distributor.totalNumImport() );
+    migrate( exec_space, distributor, leavers, arrivals );
+
+    // Fill the holes with the arrivals.
+    const std::size_t num_arrival = arrivals.size();
+    const std::size_t num_fill = std::min( num_arrival, num_leaver );
+    Kokkos::parallel_for(
+        "Cabana::migrateIncremental::fill_holes",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, num_fill ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            aosoa.setTuple( leaver_subindices( i ), arrivals.getTuple( i ) );
+        } );
+    Kokkos::fence();
+
+    if ( num_arrival > num_leaver )
+    {
+        // Append the extra arrivals.
+        const std::size_t num_extra = num_arrival - num_leaver;
+        aosoa.resize( num_particle + num_extra );
+        Kokkos::parallel_for(
+            "Cabana::migrateIncremental::append",
+            Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, num_extra ),
+            KOKKOS_LAMBDA( const std::size_t i ) {
+                aosoa.setTuple( num_particle + i,
+                                arrivals.getTuple( num_fill + i ) );
+            } );
+        Kokkos::fence();
+    }
+    else if ( num_leaver > num_arrival )
+    {
+        // Close the remaining holes by moving tail particles in.
+        Kokkos::View<bool*, memory_space> keep( "migrate_keep",
+                                                num_particle );
+        Kokkos::deep_copy( keep, true );
+        Kokkos::parallel_for(
+            "Cabana::migrateIncremental::flag_holes",
+            Kokkos::RangePolicy<ExecutionSpace>( exec_space, num_fill,
+                                                 num_leaver ),
+            KOKKOS_LAMBDA( const std::size_t i ) {
+                keep( leaver_subindices( i ) ) = false;
+            } );
+        Kokkos::fence();
+        Cabana::remove( exec_space,
+                        num_particle - ( num_leaver - num_arrival ), keep,
+                        aosoa, 0, false );
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Handle for a split-phase migration with communication in flight.
+
+  Created by migrateBegin() after the send data has been packed and all
+  messages posted; completed by migrateEnd(), which waits on the messages and
+  unpacks the received data. The handle owns the communication buffers and
+  pending requests and must be completed exactly once. Between the two calls
+  the caller is free to do local work (e.g. interior force computation) that
+  does not touch the destination AoSoA.
+*/
+template <class Distributor_t, class AoSoA_t>
+class MigrateHandle
+{
+  public:
+    //! Distributor type.
+    using distributor_type = Distributor_t;
+    //! Particle data type.
+    using aosoa_type = AoSoA_t;
+    //! Communication buffer type.
+    using buffer_type = Kokkos::View<typename AoSoA_t::tuple_type*,
+                                     typename Distributor_t::memory_space>;
+
+    //! Construct over the distributor and destination of the migration.
+    MigrateHandle( const Distributor_t& distributor, const AoSoA_t& dst )
+        : _distributor( distributor )
+        , _dst( dst )
+    {
+    }
+
+    //! \cond Impl
+    Distributor_t _distributor;
+    AoSoA_t _dst;
+    buffer_type _send_buffer;
+    buffer_type _recv_buffer;
+    std::vector<MPI_Request> _requests;
+    //! \endcond
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Start an asynchronous migration: pack the send data and post all
+  messages, then return while they are in flight.
+
+  \tparam ExecutionSpace Kokkos execution space.
+  \tparam Distributor_t Distributor type - must be a distributor.
+  \tparam AoSoA_t AoSoA type - must be an AoSoA.
+
+  \param exec_space Kokkos execution space.
+  \param distributor The distributor to use for the migration.
+  \param src The AoSoA containing the data to be migrated. Must have the same
+  number of elements as the inputs used to construct the distributor.
+  \param dst The AoSoA to which the migrated data will be written. Must be the
+  same size as the number of imports given by the distributor on this rank.
+  \return Handle to pass to migrateEnd() to complete the migration.
+*/
+template <class ExecutionSpace, class Distributor_t, class AoSoA_t>
+auto migrateBegin(
+    ExecutionSpace, const Distributor_t& distributor, const AoSoA_t& src,
+    AoSoA_t& dst,
+    typename std::enable_if<( is_distributor<Distributor_t>::value &&
+                              is_aosoa<AoSoA_t>::value ),
+                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::migrateBegin" );
+
+    static_assert( is_accessible_from<typename Distributor_t::memory_space,
+                                      ExecutionSpace>{},
+                   "" );
+
+    // Check that src and dst are the right size.
+    if ( src.size() != distributor.exportSize() )
+        throw std::runtime_error( "Source is the wrong size for migration!" );
+    if ( dst.size() != distributor.totalNumImport() )
+        throw std::runtime_error(
+            "Destination is the wrong size for migration!" );
+
+    // Get the MPI rank we are currently on.
+    int my_rank = -1;
+    MPI_Comm_rank( distributor.comm(), &my_rank );
+
+    // Get the number of neighbors.
+    int num_n = distributor.numNeighbor();
+
+    // Calculate the number of elements that are staying on this rank and
+    // therefore can be directly copied.
+    std::size_t num_stay =
+        ( num_n > 0 && distributor.neighborRank( 0 ) == my_rank )
+            ? distributor.numExport( 0 )
+            : 0;
+
+    // Create the handle owning the buffers for the in-flight messages.
+    MigrateHandle<Distributor_t, AoSoA_t> handle( distributor, dst );
+    std::size_t num_send = distributor.totalNumExport() - num_stay;
+    handle._send_buffer =
+        typename MigrateHandle<Distributor_t, AoSoA_t>::buffer_type(
+            Kokkos::ViewAllocateWithoutInitializing(
+                "distributor_send_buffer" ),
+            num_send );
+    handle._recv_buffer =
+        typename MigrateHandle<Distributor_t, AoSoA_t>::buffer_type(
+            Kokkos::ViewAllocateWithoutInitializing(
+                "distributor_recv_buffer" ),
+            distributor.totalNumImport() );
+    auto send_buffer = handle._send_buffer;
+    auto recv_buffer = handle._recv_buffer;
+
+    // Get the steering vector for the sends.
+    auto steering = distributor.getExportSteering();
+
+    // Gather the exports from the source AoSoA into the tuple-contiguous send
+    // buffer or the receive buffer if the data is staying.
+    auto build_send_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        auto tpl = src.getTuple( steering( i ) );
+        if ( i < num_stay )
+            recv_buffer( i ) = tpl;
+        else
+            send_buffer( i - num_stay ) = tpl;
+    };
+    Kokkos::RangePolicy<ExecutionSpace> build_send_buffer_policy(
+        0, distributor.totalNumExport() );
+    Kokkos::parallel_for( "Cabana::migrateBegin::build_send_buffer",
+                          build_send_buffer_policy, build_send_buffer_func );
+    Kokkos::fence();
+
+    // The distributor has its own communication space so choose any tag.
+    const int mpi_tag = 1234;
+
+    // Post non-blocking receives.
+    handle._requests.reserve( 2 * num_n );
+    std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
+    for ( int n = 0; n < num_n; ++n )
+    {
+        recv_range.second = recv_range.first + distributor.numImport( n );
+
+        if ( ( distributor.numImport( n ) > 0 ) &&
+             ( distributor.neighborRank( n ) != my_rank ) )
+        {
+            auto recv_subview = Kokkos::subview( recv_buffer, recv_range );
+
+            handle._requests.push_back( MPI_Request() );
+
+            MPI_Irecv( recv_subview.data(),
+                       recv_subview.size() *
+                           sizeof( typename AoSoA_t::tuple_type ),
+                       MPI_BYTE, distributor.neighborRank( n ), mpi_tag,
+                       distributor.comm(), &( handle._requests.back() ) );
+        }
+
+        recv_range.first = recv_range.second;
+    }
+
+    // Post non-blocking sends. The buffers live in the handle so they stay
+    // valid while the messages are in flight.
+    std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
+    for ( int n = 0; n < num_n; ++n )
+    {
+        if ( ( distributor.numExport( n ) > 0 ) &&
+             ( distributor.neighborRank( n ) != my_rank ) )
+        {
+            send_range.second = send_range.first + distributor.numExport( n );
+
+            auto send_subview = Kokkos::subview( send_buffer, send_range );
+
+            handle._requests.push_back( MPI_Request() );
+
+            MPI_Isend( send_subview.data(),
+                       send_subview.size() *
+                           sizeof( typename AoSoA_t::tuple_type ),
+                       MPI_BYTE, distributor.neighborRank( n ), mpi_tag,
+                       distributor.comm(), &( handle._requests.back() ) );
+
+            send_range.first = send_range.second;
+        }
+    }
+
+    return handle;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Start an asynchronous migration with the default execution space.
+  \return Handle to pass to migrateEnd() to complete the migration.
+*/
+template <class Distributor_t, class AoSoA_t>
+auto migrateBegin(
+    const Distributor_t& distributor, const AoSoA_t& src, AoSoA_t& dst,
+    typename std::enable_if<( is_distributor<Distributor_t>::value &&
+                              is_aosoa<AoSoA_t>::value ),
+                            int>::type* = 0 )
+{
+    return migrateBegin( typename Distributor_t::execution_space{},
+                         distributor, src, dst );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Complete an asynchronous migration started with migrateBegin():
+  wait on the in-flight messages and unpack the received data into the
+  destination AoSoA.
+
+  \param handle The handle returned by migrateBegin().
+*/
+template <class Distributor_t, class AoSoA_t>
+void migrateEnd( MigrateHandle<Distributor_t, AoSoA_t>& handle )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::migrateEnd" );
+
+    using execution_space = typename Distributor_t::execution_space;
+
+    // Wait on the posted messages.
+    std::vector<MPI_Status> status( handle._requests.size() );
+    const int ec = MPI_Waitall( handle._requests.size(),
+                                handle._requests.data(), status.data() );
+    if ( MPI_SUCCESS != ec )
+        throw std::logic_error( "Failed MPI Communication" );
+    handle._requests.clear();
+
+    // Extract the receive buffer into the destination AoSoA.
+    auto dst = handle._dst;
+    auto recv_buffer = handle._recv_buffer;
+    auto extract_recv_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        dst.setTuple( i, recv_buffer( i ) );
+    };
+    Kokkos::RangePolicy<execution_space> extract_recv_buffer_policy(
+        0, handle._distributor.totalNumImport() );
+    Kokkos::parallel_for( "Cabana::migrateEnd::extract_recv_buffer",
+                          extract_recv_buffer_policy,
+                          extract_recv_buffer_func );
+    Kokkos::fence();
+
+    // Barrier before completing to ensure synchronization.
+    MPI_Barrier( handle._distributor.comm() );
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Synchronously migrate data between two different decompositions using
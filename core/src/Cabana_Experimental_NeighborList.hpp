@@ -75,6 +75,34 @@ auto makePredicates(
         std::forward<Positions>( positions ), first, last, radius };
 }
 
+template <typename Positions,
+          typename = std::enable_if_t<Cabana::is_slice<Positions>::value ||
+                                      Kokkos::is_view_v<Positions>>>
+struct SubPositionsAndK
+{
+    using positions_type = Positions;
+    using memory_space = typename Positions::memory_space;
+    Positions data;
+    using size_type = typename Positions::size_type;
+    size_type first;
+    size_type last;
+    int num_neighbor;
+};
+
+template <typename Positions,
+          typename = std::enable_if_t<
+              Cabana::is_slice<std::remove_reference_t<Positions>>::value ||
+              Kokkos::is_view_v<Positions>>>
+auto makeKnnPredicates(
+    Positions&& positions,
+    typename stdcxx20::remove_cvref_t<Positions>::size_type first,
+    typename stdcxx20::remove_cvref_t<Positions>::size_type last,
+    const int num_neighbor )
+{
+    return Impl::SubPositionsAndK<stdcxx20::remove_cvref_t<Positions>>{
+        std::forward<Positions>( positions ), first, last, num_neighbor };
+}
+
 template <typename ExecutionSpace, typename D, typename... P>
 typename Kokkos::View<D, P...>::non_const_value_type
 max_reduce( ExecutionSpace const& space, Kokkos::View<D, P...> const& v )
@@ -154,6 +182,33 @@ struct AccessTraits<
         return attach( intersects( Sphere{ point, x.radius } ), (int)i );
     }
 };
+//! Nearest-k access trait.
+template <typename Positions>
+struct AccessTraits<Cabana::Experimental::Impl::SubPositionsAndK<Positions>,
+                    PredicatesTag>
+{
+    //! Position wrapper with partial range and neighbor count information.
+    using PositionLike =
+        Cabana::Experimental::Impl::SubPositionsAndK<Positions>;
+    //! Kokkos memory space.
+    using memory_space = typename PositionLike::memory_space;
+    //! Size type.
+    using size_type = typename PositionLike::size_type;
+    //! Get number of particles.
+    static KOKKOS_FUNCTION size_type size( PositionLike const& x )
+    {
+        return x.last - x.first;
+    }
+    //! Get the nearest-k predicate of the particle at the index.
+    static KOKKOS_FUNCTION auto get( PositionLike const& x, size_type i )
+    {
+        assert( i < size( x ) );
+        auto const point =
+            AccessTraits<typename PositionLike::positions_type,
+                         PrimitivesTag>::get( x.data, x.first + i );
+        return attach( nearest( point, x.num_neighbor ), (int)i );
+    }
+};
 } // namespace ArborX
 
 namespace Cabana
@@ -334,6 +389,69 @@ auto makeNeighborList( ExecutionSpace space, Tag, Positions const& positions,
         std::move( indices ), std::move( offset ), first, bvh.size() };
 }
 
+/*!
+  \brief Exact k-nearest-neighbor list implementation using ArborX with a 1D
+  compressed layout for particles and neighbors.
+
+  \tparam ExecutionSpace Kokkos execution space.
+  \tparam Positions The position type.
+  \tparam Tag Tag indicating whether to build a full or half neighbor list.
+
+  \param space Kokkos execution space.
+  \param positions The particle positions.
+  \param first The beginning particle index to compute neighbors for.
+  \param last The end particle index to compute neighbors for.
+  \param num_neighbor The number of nearest neighbors to find per particle.
+
+  Uses ArborX's nearest-k traversal directly, so density estimators stop
+  over-querying with an inflated radius and post-sorting. The self match is
+  consumed by the collision filter (one extra nearest candidate is
+  requested internally) and the result uses the same CSR layout as
+  makeNeighborList, consumable by every neighbor_parallel_for pattern.
+*/
+template <typename ExecutionSpace, typename Positions, typename Tag>
+auto makeKNeighborList( ExecutionSpace space, Tag, Positions const& positions,
+                        typename Positions::size_type first,
+                        typename Positions::size_type last,
+                        const int num_neighbor )
+{
+    assert( num_neighbor > 0 );
+    assert( last >= first );
+    assert( last <= positions.size() );
+
+    using memory_space = typename Positions::memory_space;
+
+    ArborX::BVH<memory_space> bvh( space, positions );
+
+    Kokkos::View<int*, memory_space> indices(
+        Kokkos::view_alloc( "indices", Kokkos::WithoutInitializing ), 0 );
+    Kokkos::View<int*, memory_space> offset(
+        Kokkos::view_alloc( "offset", Kokkos::WithoutInitializing ), 0 );
+    bvh.query( space,
+               Impl::makeKnnPredicates( positions, first, last,
+                                        num_neighbor + 1 ),
+               Impl::NeighborDiscriminatorCallback<Tag>{}, indices, offset );
+
+    return CrsGraph<memory_space, Tag>{ std::move( indices ),
+                                        std::move( offset ), first,
+                                        bvh.size() };
+}
+
+/*!
+  \brief Exact k-nearest-neighbor list implementation using ArborX with the
+  default execution space.
+*/
+template <typename Positions, typename Tag>
+auto makeKNeighborList( Tag tag, Positions const& positions,
+                        typename Positions::size_type first,
+                        typename Positions::size_type last,
+                        const int num_neighbor )
+{
+    typename Positions::execution_space space{};
+    return makeKNeighborList( space, tag, positions, first, last,
+                              num_neighbor );
+}
+
 /*!
   \brief Neighbor list implementation using ArborX for particles within the
   interaction distance with a 1D compressed layout for particles and neighbors.
@@ -559,6 +677,117 @@ template <typename DeviceType, typename Positions, typename Tag>
                                radius, buffer_size );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Future-like handle for an asynchronously built neighbor list.
+
+  \tparam ListType The neighbor list type under construction.
+  \tparam ExecutionSpace Kokkos execution space.
+
+  The build is enqueued on an execution space instance and a completion
+  flag in host-pinned memory is written at the end of the stream, so the
+  host can poll test() without fencing while integration sub-steps run on
+  other instances. get() blocks until the list is safe to traverse.
+*/
+template <typename ListType, typename ExecutionSpace>
+class NeighborListFuture
+{
+  public:
+    //! Neighbor list type.
+    using list_type = ListType;
+    //! Kokkos execution space.
+    using execution_space = ExecutionSpace;
+
+#ifdef KOKKOS_HAS_SHARED_HOST_PINNED_SPACE
+    //! Host-pollable completion flag memory space.
+    using flag_space = Kokkos::SharedHostPinnedSpace;
+#else
+    //! Host-pollable completion flag memory space.
+    using flag_space = Kokkos::HostSpace;
+#endif
+
+    /*!
+      \brief Constructor. Enqueues the completion flag write behind the
+      already-enqueued build.
+    */
+    NeighborListFuture( ListType list, ExecutionSpace space )
+        : _list( std::move( list ) )
+        , _space( space )
+        , _flag( "neighbor_build_complete" )
+    {
+        auto flag = _flag;
+        Kokkos::parallel_for(
+            "Cabana::NeighborListFuture::complete",
+            Kokkos::RangePolicy<ExecutionSpace>( _space, 0, 1 ),
+            KOKKOS_LAMBDA( const int ) {
+                Kokkos::atomic_store( &flag(), 1 );
+            } );
+    }
+
+    //! Poll for completion without blocking the host.
+    bool test() const
+    {
+        return 1 == Kokkos::atomic_load( &_flag() );
+    }
+
+    //! Block until the build is complete.
+    void wait()
+    {
+        if ( !_done )
+        {
+            _space.fence();
+            _done = true;
+        }
+    }
+
+    //! Block until the build is complete and get the list.
+    list_type& get()
+    {
+        wait();
+        return _list;
+    }
+
+  private:
+    ListType _list;
+    ExecutionSpace _space;
+    Kokkos::View<int, flag_space> _flag;
+    bool _done = false;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Asynchronously build an ArborX neighbor list on an execution
+  space instance.
+
+  \param space Kokkos execution space instance the build is enqueued on.
+  Use a dedicated instance to overlap construction with work on others.
+  \param tag Tag indicating whether to build a full or half neighbor list.
+  \param positions The particle positions, frozen until the future
+  completes.
+  \param first The beginning particle index to compute neighbors for.
+  \param last The end particle index to compute neighbors for.
+  \param radius The radius of the neighborhood.
+  \param buffer_size Optional guess for maximum number of neighbors.
+  \return NeighborListFuture handle; poll test() or block with get().
+
+  Everything makeNeighborList enqueues is stream-ordered on the instance,
+  so tree construction and the query hide behind bonded-force kernels
+  running elsewhere until get() is called.
+*/
+template <typename ExecutionSpace, typename Positions, typename Tag>
+auto makeNeighborListAsync( ExecutionSpace space, Tag tag,
+                            Positions const& positions,
+                            typename Positions::size_type first,
+                            typename Positions::size_type last,
+                            typename Positions::value_type radius,
+                            int buffer_size = 0 )
+{
+    auto list = makeNeighborList( space, tag, positions, first, last, radius,
+                                  buffer_size );
+    return NeighborListFuture<decltype( list ), ExecutionSpace>(
+        std::move( list ), space );
+}
+
 } // namespace Experimental
 
 //! 1d ArborX NeighborList interface.
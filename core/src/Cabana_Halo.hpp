@@ -18,7 +18,9 @@
 
 #include <Cabana_AoSoA.hpp>
 #include <Cabana_CommunicationPlan.hpp>
+#include <Cabana_Instrumentation.hpp>
 #include <Cabana_Slice.hpp>
+#include <Cabana_Sort.hpp>
 
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Profiling_ScopedRegion.hpp>
@@ -26,6 +28,7 @@
 #include <mpi.h>
 
 #include <exception>
+#include <memory>
 #include <vector>
 
 namespace Cabana
@@ -285,9 +288,11 @@ class Gather<HaloType, AoSoAType,
       \brief Perform the gather operation.
     */
     template <class ExecutionSpace>
-    void apply( ExecutionSpace )
+    void apply( ExecutionSpace exec_space )
     {
         Kokkos::Profiling::ScopedRegion region( "Cabana::gather" );
+        ScopedOperationTimer operation_timer(
+            "gather", ( _send_size + _recv_size ) * sizeof( data_type ) );
 
         // Get the buffers and particle data (local copies for lambdas below).
         auto send_buffer = this->getSendBuffer();
@@ -301,10 +306,11 @@ class Gather<HaloType, AoSoAType,
         {
             send_buffer( i ) = aosoa.getTuple( steering( i ) );
         };
-        Kokkos::RangePolicy<ExecutionSpace> send_policy( 0, _send_size );
+        Kokkos::RangePolicy<ExecutionSpace> send_policy( exec_space, 0,
+                                                          _send_size );
         Kokkos::parallel_for( "Cabana::gather::gather_send_buffer", send_policy,
                               gather_send_buffer_func );
-        Kokkos::fence();
+        exec_space.fence();
 
         // The halo has it's own communication space so choose any mpi tag.
         const int mpi_tag = 2345;
@@ -327,7 +333,9 @@ class Gather<HaloType, AoSoAType,
             recv_range.first = recv_range.second;
         }
 
-        // Do blocking sends.
+        // Do blocking sends, tracing each per-neighbor message when the
+        // communication tracer is enabled.
+        auto& tracer = CommTracer::instance();
         std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
         for ( int n = 0; n < num_n; ++n )
         {
@@ -335,9 +343,14 @@ class Gather<HaloType, AoSoAType,
 
             auto send_subview = Kokkos::subview( send_buffer, send_range );
 
+            const double t_begin = tracer.enabled() ? tracer.now() : 0.0;
             MPI_Send( send_subview.data(),
                       send_subview.size() * sizeof( data_type ), MPI_BYTE,
                       _halo.neighborRank( n ), mpi_tag, _halo.comm() );
+            if ( tracer.enabled() )
+                tracer.record( "gather_send", _halo.neighborRank( n ),
+                               send_subview.size() * sizeof( data_type ),
+                               t_begin, tracer.now() );
 
             send_range.first = send_range.second;
         }
@@ -356,10 +369,11 @@ class Gather<HaloType, AoSoAType,
             std::size_t ghost_idx = i + num_local;
             aosoa.setTuple( ghost_idx, recv_buffer( i ) );
         };
-        Kokkos::RangePolicy<ExecutionSpace> recv_policy( 0, _recv_size );
+        Kokkos::RangePolicy<ExecutionSpace> recv_policy( exec_space, 0,
+                                                          _recv_size );
         Kokkos::parallel_for( "Cabana::gather::extract_recv_buffer",
                               recv_policy, extract_recv_buffer_func );
-        Kokkos::fence();
+        exec_space.fence();
 
         // Barrier before completing to ensure synchronization.
         MPI_Barrier( _halo.comm() );
@@ -464,9 +478,11 @@ class Gather<HaloType, SliceType,
       \brief Perform the gather operation.
     */
     template <class ExecutionSpace>
-    void apply( ExecutionSpace )
+    void apply( ExecutionSpace exec_space )
     {
         Kokkos::Profiling::ScopedRegion region( "Cabana::gather" );
+        ScopedOperationTimer operation_timer(
+            "gather", ( _send_size + _recv_size ) * sizeof( data_type ) );
 
         // Get the buffers (local copies for lambdas below).
         auto send_buffer = this->getSendBuffer();
@@ -492,10 +508,11 @@ class Gather<HaloType, SliceType,
                 send_buffer( i, n ) =
                     slice_data[slice_offset + n * SliceType::vector_length];
         };
-        Kokkos::RangePolicy<ExecutionSpace> send_policy( 0, _send_size );
+        Kokkos::RangePolicy<ExecutionSpace> send_policy( exec_space, 0,
+                                                          _send_size );
         Kokkos::parallel_for( "Cabana::gather::gather_send_buffer", send_policy,
                               gather_send_buffer_func );
-        Kokkos::fence();
+        exec_space.fence();
 
         // The halo has it's own communication space so choose any mpi tag.
         const int mpi_tag = 2345;
@@ -554,10 +571,11 @@ class Gather<HaloType, SliceType,
                 slice_data[slice_offset + SliceType::vector_length * n] =
                     recv_buffer( i, n );
         };
-        Kokkos::RangePolicy<ExecutionSpace> recv_policy( 0, _recv_size );
+        Kokkos::RangePolicy<ExecutionSpace> recv_policy( exec_space, 0,
+                                                          _recv_size );
         Kokkos::parallel_for( "Cabana::gather::extract_recv_buffer",
                               recv_policy, extract_recv_buffer_func );
-        Kokkos::fence();
+        exec_space.fence();
 
         // Barrier before completing to ensure synchronization.
         MPI_Barrier( _halo.comm() );
@@ -648,10 +666,1084 @@ void gather( const HaloType& halo, ParticleDataType& data )
     gather.apply();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Synchronously gather a slice with the communication payload
+  converted to a reduced precision type.
+
+  \tparam CommValueType Value type used on the wire, e.g. float,
+  Kokkos::Experimental::half_t or Kokkos::Experimental::bhalf_t.
+
+  The pack kernel narrows each slice component to CommValueType and the
+  unpack kernel widens it back to the slice value type. Interconnect bytes
+  drop by the ratio of the type sizes (2x for double to float, 4x for double
+  to half). The conversion is lossy and opt-in: use only for fields, such as
+  ghost-region force contributions, that tolerate reduced precision.
+
+  \param halo The halo to use for the gather.
+  \param slice The slice on which to perform the gather. Sized as for
+  gather().
+*/
+template <class CommValueType, class HaloType, class SliceType>
+void gatherReduced( const HaloType& halo, SliceType& slice,
+                    typename std::enable_if<( is_halo<HaloType>::value &&
+                                              is_slice<SliceType>::value ),
+                                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::gatherReduced" );
+
+    if ( !haloCheckValidSize( halo, slice ) )
+        throw std::runtime_error( "Slice is the wrong size for gather!" );
+
+    using memory_space = typename HaloType::memory_space;
+    using execution_space = typename memory_space::execution_space;
+    using data_type = typename SliceType::value_type;
+
+    // Get the number of components in the slice.
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < slice.viewRank(); ++d )
+        num_comp *= slice.extent( d );
+
+    // Allocate the reduced-precision send and receive buffers.
+    Kokkos::View<CommValueType**, Kokkos::LayoutRight, memory_space>
+        send_buffer(
+            Kokkos::ViewAllocateWithoutInitializing( "gather_send_buffer" ),
+            halo.totalNumExport(), num_comp );
+    Kokkos::View<CommValueType**, Kokkos::LayoutRight, memory_space>
+        recv_buffer(
+            Kokkos::ViewAllocateWithoutInitializing( "gather_recv_buffer" ),
+            halo.totalNumImport(), num_comp );
+
+    // Get the raw slice data.
+    auto slice_data = slice.data();
+
+    // Narrow the exports into the send buffer.
+    auto steering = halo.getExportSteering();
+    auto gather_send_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        auto s = SliceType::index_type::s( steering( i ) );
+        auto a = SliceType::index_type::a( steering( i ) );
+        std::size_t slice_offset = s * slice.stride( 0 ) + a;
+        for ( std::size_t n = 0; n < num_comp; ++n )
+            send_buffer( i, n ) = static_cast<CommValueType>(
+                slice_data[slice_offset + SliceType::vector_length * n] );
+    };
+    Kokkos::RangePolicy<execution_space> send_policy(
+        0, halo.totalNumExport() );
+    Kokkos::parallel_for( "Cabana::gatherReduced::gather_send_buffer",
+                          send_policy, gather_send_buffer_func );
+    Kokkos::fence();
+
+    // The halo has it's own communication space so choose any mpi tag.
+    const int mpi_tag = 2345;
+
+    // Post non-blocking receives.
+    int num_n = halo.numNeighbor();
+    std::vector<MPI_Request> requests( num_n );
+    std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
+    for ( int n = 0; n < num_n; ++n )
+    {
+        recv_range.second = recv_range.first + halo.numImport( n );
+
+        auto recv_subview =
+            Kokkos::subview( recv_buffer, recv_range, Kokkos::ALL );
+
+        MPI_Irecv( recv_subview.data(),
+                   recv_subview.size() * sizeof( CommValueType ), MPI_BYTE,
+                   halo.neighborRank( n ), mpi_tag, halo.comm(),
+                   &( requests[n] ) );
+
+        recv_range.first = recv_range.second;
+    }
+
+    // Do blocking sends.
+    std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
+    for ( int n = 0; n < num_n; ++n )
+    {
+        send_range.second = send_range.first + halo.numExport( n );
+
+        auto send_subview =
+            Kokkos::subview( send_buffer, send_range, Kokkos::ALL );
+
+        MPI_Send( send_subview.data(),
+                  send_subview.size() * sizeof( CommValueType ), MPI_BYTE,
+                  halo.neighborRank( n ), mpi_tag, halo.comm() );
+
+        send_range.first = send_range.second;
+    }
+
+    // Wait on non-blocking receives.
+    std::vector<MPI_Status> status( num_n );
+    const int ec =
+        MPI_Waitall( requests.size(), requests.data(), status.data() );
+    if ( MPI_SUCCESS != ec )
+        throw std::logic_error( "Failed MPI Communication" );
+
+    // Widen the receives into the ghosted elements.
+    std::size_t num_local = halo.numLocal();
+    auto extract_recv_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        std::size_t ghost_idx = i + num_local;
+        auto s = SliceType::index_type::s( ghost_idx );
+        auto a = SliceType::index_type::a( ghost_idx );
+        std::size_t slice_offset = s * slice.stride( 0 ) + a;
+        for ( std::size_t n = 0; n < num_comp; ++n )
+            slice_data[slice_offset + SliceType::vector_length * n] =
+                static_cast<data_type>( recv_buffer( i, n ) );
+    };
+    Kokkos::RangePolicy<execution_space> recv_policy(
+        0, halo.totalNumImport() );
+    Kokkos::parallel_for( "Cabana::gatherReduced::extract_recv_buffer",
+                          recv_policy, extract_recv_buffer_func );
+    Kokkos::fence();
+
+    // Barrier before completing to ensure synchronization.
+    MPI_Barrier( halo.comm() );
+}
+
+//---------------------------------------------------------------------------//
+namespace Impl
+{
+//! \cond Impl
+
+// Copy a single member between tuples with different member sets.
+template <std::size_t DstM, std::size_t SrcM, class DstTuple, class SrcTuple>
+KOKKOS_INLINE_FUNCTION void copyTupleMember( DstTuple& dst,
+                                             const SrcTuple& src )
+{
+    auto& dst_data =
+        Impl::soaMemberCast<DstM>( static_cast<typename DstTuple::base&>( dst ) )
+            ._data;
+    const auto& src_data =
+        Impl::soaMemberCast<SrcM>(
+            static_cast<const typename SrcTuple::base&>( src ) )
+            ._data;
+    static_assert( sizeof( dst_data ) == sizeof( src_data ),
+                   "Tuple members must have the same data type" );
+    const char* src_bytes = reinterpret_cast<const char*>( &src_data );
+    char* dst_bytes = reinterpret_cast<char*>( &dst_data );
+    for ( std::size_t b = 0; b < sizeof( dst_data ); ++b )
+        dst_bytes[b] = src_bytes[b];
+}
+
+// Pack the given members of a full tuple into consecutive members of a
+// reduced tuple.
+template <std::size_t... M, class ReducedTuple, class FullTuple,
+          std::size_t... P>
+KOKKOS_INLINE_FUNCTION void packTupleMembers( ReducedTuple& reduced,
+                                              const FullTuple& full,
+                                              std::index_sequence<P...> )
+{
+    ( copyTupleMember<P, M>( reduced, full ), ... );
+}
+
+// Unpack consecutive members of a reduced tuple into the given members of a
+// full tuple.
+template <std::size_t... M, class ReducedTuple, class FullTuple,
+          std::size_t... P>
+KOKKOS_INLINE_FUNCTION void unpackTupleMembers( const ReducedTuple& reduced,
+                                                FullTuple& full,
+                                                std::index_sequence<P...> )
+{
+    ( copyTupleMember<M, P>( full, reduced ), ... );
+}
+
+//! \endcond
+} // end namespace Impl
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Synchronously gather a subset of AoSoA members from the local
+  decomposition to the ghosts using the halo forward communication plan.
+
+  \tparam M Indices of the members to gather.
+
+  Only the requested members are packed, sent in a single message per
+  neighbor, and unpacked into the ghosted elements; all other members ride
+  free. This cuts halo volume when only a few fields (e.g. positions) need
+  ghost updates each step.
+
+  \param halo The halo to use for the gather.
+  \param aosoa The AoSoA on which to perform the gather. Sized as for
+  gather().
+*/
+template <std::size_t M0, std::size_t... M, class HaloType, class AoSoAType>
+void gather( const HaloType& halo, AoSoAType& aosoa,
+             typename std::enable_if<( is_halo<HaloType>::value &&
+                                       is_aosoa<AoSoAType>::value ),
+                                     int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::gather" );
+
+    if ( !haloCheckValidSize( halo, aosoa ) )
+        throw std::runtime_error( "AoSoA is the wrong size for gather!" );
+
+    using memory_space = typename HaloType::memory_space;
+    using execution_space = typename memory_space::execution_space;
+    using reduced_tuple =
+        Tuple<MemberTypes<typename AoSoAType::template member_data_type<M0>,
+                          typename AoSoAType::template member_data_type<M>...>>;
+
+    // Allocate reduced send and receive buffers holding only the requested
+    // members.
+    Kokkos::View<reduced_tuple*, memory_space> send_buffer(
+        Kokkos::ViewAllocateWithoutInitializing( "gather_send_buffer" ),
+        halo.totalNumExport() );
+    Kokkos::View<reduced_tuple*, memory_space> recv_buffer(
+        Kokkos::ViewAllocateWithoutInitializing( "gather_recv_buffer" ),
+        halo.totalNumImport() );
+
+    // Pack the requested members of the exports.
+    auto steering = halo.getExportSteering();
+    auto gather_send_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        auto full = aosoa.getTuple( steering( i ) );
+        reduced_tuple reduced;
+        Impl::packTupleMembers<M0, M...>(
+            reduced, full,
+            std::make_index_sequence<1 + sizeof...( M )>{} );
+        send_buffer( i ) = reduced;
+    };
+    Kokkos::RangePolicy<execution_space> send_policy(
+        0, halo.totalNumExport() );
+    Kokkos::parallel_for( "Cabana::gather::gather_send_buffer", send_policy,
+                          gather_send_buffer_func );
+    Kokkos::fence();
+
+    // The halo has it's own communication space so choose any mpi tag.
+    const int mpi_tag = 2345;
+
+    // Post non-blocking receives.
+    int num_n = halo.numNeighbor();
+    std::vector<MPI_Request> requests( num_n );
+    std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
+    for ( int n = 0; n < num_n; ++n )
+    {
+        recv_range.second = recv_range.first + halo.numImport( n );
+
+        auto recv_subview = Kokkos::subview( recv_buffer, recv_range );
+
+        MPI_Irecv( recv_subview.data(),
+                   recv_subview.size() * sizeof( reduced_tuple ), MPI_BYTE,
+                   halo.neighborRank( n ), mpi_tag, halo.comm(),
+                   &( requests[n] ) );
+
+        recv_range.first = recv_range.second;
+    }
+
+    // Do blocking sends.
+    std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
+    for ( int n = 0; n < num_n; ++n )
+    {
+        send_range.second = send_range.first + halo.numExport( n );
+
+        auto send_subview = Kokkos::subview( send_buffer, send_range );
+
+        MPI_Send( send_subview.data(),
+                  send_subview.size() * sizeof( reduced_tuple ), MPI_BYTE,
+                  halo.neighborRank( n ), mpi_tag, halo.comm() );
+
+        send_range.first = send_range.second;
+    }
+
+    // Wait on non-blocking receives.
+    std::vector<MPI_Status> status( num_n );
+    const int ec =
+        MPI_Waitall( requests.size(), requests.data(), status.data() );
+    if ( MPI_SUCCESS != ec )
+        throw std::logic_error( "Failed MPI Communication" );
+
+    // Unpack the requested members into the ghosted elements.
+    std::size_t num_local = halo.numLocal();
+    auto extract_recv_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        std::size_t ghost_idx = i + num_local;
+        auto full = aosoa.getTuple( ghost_idx );
+        Impl::unpackTupleMembers<M0, M...>(
+            recv_buffer( i ), full,
+            std::make_index_sequence<1 + sizeof...( M )>{} );
+        aosoa.setTuple( ghost_idx, full );
+    };
+    Kokkos::RangePolicy<execution_space> recv_policy(
+        0, halo.totalNumImport() );
+    Kokkos::parallel_for( "Cabana::gather::extract_recv_buffer", recv_policy,
+                          extract_recv_buffer_func );
+    Kokkos::fence();
+
+    // Barrier before completing to ensure synchronization.
+    MPI_Barrier( halo.comm() );
+}
+
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+// Gather each member whose owner-side dirty flag is set.
+template <class HaloType, class AoSoAType, std::size_t... M>
+void gatherModifiedMembers( const HaloType& halo, AoSoAType& aosoa,
+                            std::index_sequence<M...> )
+{
+    (
+        [&]()
+        {
+            if ( aosoa.modified( M ) )
+                gather<M>( halo, aosoa );
+        }(),
+        ... );
+}
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Synchronously gather only the AoSoA members marked modified on
+  the owner since the last clear.
+
+  \param halo The halo to use for the gather.
+  \param aosoa The AoSoA on which to perform the gather. Sized as for
+  gather().
+
+  Owner-side kernels record which members they touched with
+  AoSoA::markModified(); between full gather epochs this re-gathers just
+  those members (one member-selective exchange each) and clears the
+  flags, so a solver iterating on positions pays the position bytes
+  instead of the full multi-member gather every pass. With no members
+  marked this is a no-op.
+*/
+template <class HaloType, class AoSoAType>
+void gatherModified( const HaloType& halo, AoSoAType& aosoa,
+                     typename std::enable_if<( is_halo<HaloType>::value &&
+                                               is_aosoa<AoSoAType>::value ),
+                                             int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::gatherModified" );
+
+    Impl::gatherModifiedMembers(
+        halo, aosoa,
+        std::make_index_sequence<AoSoAType::number_of_members>{} );
+    aosoa.clearModified();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Synchronously gather with runtime-measured variant selection.
+
+  \param selector The protocol selector. The first gathers of each message
+  size class measure the candidate variants; later gathers in the class
+  run the measured fastest.
+  \param halo The halo to use for the gather.
+  \param aosoa The AoSoA on which to perform the gather.
+
+  The candidates are the packed staging-buffer gather and the
+  single-message-per-neighbor batched gather - which one wins flips with
+  per-neighbor message size, which the halo knows from the plan.
+*/
+template <class HaloType, class AoSoAType>
+void gather( ExchangeProtocolSelector& selector, const HaloType& halo,
+             AoSoAType& aosoa,
+             typename std::enable_if<( is_halo<HaloType>::value &&
+                                       is_aosoa<AoSoAType>::value ),
+                                     int>::type* = 0 )
+{
+    // Classify by the largest per-neighbor payload.
+    std::size_t max_bytes = 0;
+    for ( int n = 0; n < halo.numNeighbor(); ++n )
+    {
+        const std::size_t bytes = halo.numExport( n ) *
+                                  sizeof( typename AoSoAType::tuple_type );
+        if ( bytes > max_bytes )
+            max_bytes = bytes;
+    }
+
+    const auto protocol = selector.select( max_bytes );
+    const double start = MPI_Wtime();
+    if ( ExchangeProtocol::Collective == protocol )
+        gatherBatched( halo, aosoa );
+    else
+        gather( halo, aosoa );
+    selector.record( max_bytes, protocol, MPI_Wtime() - start );
+}
+
+
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+// Copy the tuples of every container for one element into its block of the
+// batched byte buffer.
+template <class BufferType, class SteeringType, class PackType,
+          std::size_t... I>
+KOKKOS_INLINE_FUNCTION void
+packBatchedElement( const BufferType& buffer, const SteeringType& steering,
+                    const std::size_t i, const std::size_t elem_bytes,
+                    const PackType& aosoas, std::index_sequence<I...> )
+{
+    std::size_t offset = i * elem_bytes;
+    (
+        [&]()
+        {
+            auto tuple = Cabana::get<I>( aosoas ).getTuple( steering( i ) );
+            const char* bytes = reinterpret_cast<const char*>( &tuple );
+            for ( std::size_t b = 0; b < sizeof( tuple ); ++b )
+                buffer( offset + b ) = bytes[b];
+            offset += sizeof( tuple );
+        }(),
+        ... );
+}
+
+// Copy one element's blocks of the batched byte buffer into the ghost
+// tuples of every container.
+template <class BufferType, class PackType, std::size_t... I>
+KOKKOS_INLINE_FUNCTION void
+unpackBatchedElement( const BufferType& buffer, const std::size_t i,
+                      const std::size_t elem_bytes,
+                      const std::size_t ghost_idx, const PackType& aosoas,
+                      std::index_sequence<I...> )
+{
+    std::size_t offset = i * elem_bytes;
+    (
+        [&]()
+        {
+            typename std::decay_t<decltype( Cabana::get<I>(
+                aosoas ) )>::tuple_type tuple;
+            char* bytes = reinterpret_cast<char*>( &tuple );
+            for ( std::size_t b = 0; b < sizeof( tuple ); ++b )
+                bytes[b] = buffer( offset + b );
+            Cabana::get<I>( aosoas ).setTuple( ghost_idx, tuple );
+            offset += sizeof( tuple );
+        }(),
+        ... );
+}
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Synchronously gather several containers through the halo with one
+  message per neighbor.
+
+  \param halo The halo to use for the gather.
+  \param aosoas The AoSoAs on which to perform the gather. All must be sized
+  as for gather() against the same halo.
+
+  The tuples of every container are interleaved per element into one
+  batched buffer, so each neighbor receives a single message instead of one
+  small message per container - three species AoSoAs ghosted per step cost
+  one latency instead of three.
+*/
+template <class HaloType, class... AoSoATypes>
+void gatherBatched( const HaloType& halo, AoSoATypes&... aosoas )
+{
+    static_assert( sizeof...( AoSoATypes ) > 0,
+                   "Must gather at least one container" );
+    Kokkos::Profiling::ScopedRegion region( "Cabana::gatherBatched" );
+
+    if ( !( haloCheckValidSize( halo, aosoas ) && ... ) )
+        throw std::runtime_error( "AoSoA is the wrong size for gather!" );
+
+    using memory_space = typename HaloType::memory_space;
+    using execution_space = typename memory_space::execution_space;
+
+    // Bytes of one element across all containers.
+    const std::size_t elem_bytes =
+        ( sizeof( typename AoSoATypes::tuple_type ) + ... );
+
+    // Allocate the batched buffers.
+    Kokkos::View<char*, memory_space> send_buffer(
+        Kokkos::ViewAllocateWithoutInitializing( "gather_batched_send" ),
+        halo.totalNumExport() * elem_bytes );
+    Kokkos::View<char*, memory_space> recv_buffer(
+        Kokkos::ViewAllocateWithoutInitializing( "gather_batched_recv" ),
+        halo.totalNumImport() * elem_bytes );
+
+    // Pack all containers.
+    auto pack = makeParameterPack( aosoas... );
+    auto steering = halo.getExportSteering();
+    Kokkos::parallel_for(
+        "Cabana::gatherBatched::pack",
+        Kokkos::RangePolicy<execution_space>( 0, halo.totalNumExport() ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            Impl::packBatchedElement(
+                send_buffer, steering, i, elem_bytes, pack,
+                std::make_index_sequence<sizeof...( AoSoATypes )>{} );
+        } );
+    Kokkos::fence();
+
+    // The halo has it's own communication space so choose any mpi tag.
+    const int mpi_tag = 2346;
+
+    // Post non-blocking receives - one per neighbor.
+    int num_n = halo.numNeighbor();
+    std::vector<MPI_Request> requests( num_n );
+    std::size_t recv_offset = 0;
+    for ( int n = 0; n < num_n; ++n )
+    {
+        const std::size_t num_bytes = halo.numImport( n ) * elem_bytes;
+        MPI_Irecv( recv_buffer.data() + recv_offset, num_bytes, MPI_BYTE,
+                   halo.neighborRank( n ), mpi_tag, halo.comm(),
+                   &( requests[n] ) );
+        recv_offset += num_bytes;
+    }
+
+    // Do blocking sends - one per neighbor.
+    std::size_t send_offset = 0;
+    for ( int n = 0; n < num_n; ++n )
+    {
+        const std::size_t num_bytes = halo.numExport( n ) * elem_bytes;
+        MPI_Send( send_buffer.data() + send_offset, num_bytes, MPI_BYTE,
+                  halo.neighborRank( n ), mpi_tag, halo.comm() );
+        send_offset += num_bytes;
+    }
+
+    // Wait on non-blocking receives.
+    std::vector<MPI_Status> status( num_n );
+    const int ec =
+        MPI_Waitall( requests.size(), requests.data(), status.data() );
+    if ( MPI_SUCCESS != ec )
+        throw std::logic_error( "Failed MPI Communication" );
+
+    // Unpack all containers into the ghosts.
+    std::size_t num_local = halo.numLocal();
+    Kokkos::parallel_for(
+        "Cabana::gatherBatched::unpack",
+        Kokkos::RangePolicy<execution_space>( 0, halo.totalNumImport() ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            Impl::unpackBatchedElement(
+                recv_buffer, i, elem_bytes, i + num_local, pack,
+                std::make_index_sequence<sizeof...( AoSoATypes )>{} );
+        } );
+    Kokkos::fence();
+
+    // Barrier before completing to ensure synchronization.
+    MPI_Barrier( halo.comm() );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief One-sided (RMA) halo gather with pre-negotiated windows.
+
+  \tparam HaloType Halo type.
+  \tparam AoSoAType AoSoA type.
+
+  The receive buffer is exposed once as an MPI window and every neighbor
+  learns at construction where its data lands, which is static between
+  halo rebuilds. Each apply() packs, opens a fence epoch, and delivers the
+  data with MPI_Put - no per-neighbor tag matching or receive posting, which
+  removes the two-sided software overhead that dominates small,
+  latency-bound ghost updates. Buffers live in the halo memory space, so
+  device windows require a GPU-aware MPI.
+*/
+template <class HaloType, class AoSoAType>
+class GatherRma
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = typename HaloType::memory_space;
+    //! Kokkos execution space.
+    using execution_space = typename memory_space::execution_space;
+    //! Communication data type.
+    using data_type = typename AoSoAType::tuple_type;
+    //! Communication buffer type.
+    using buffer_type = Kokkos::View<data_type*, memory_space>;
+
+    /*!
+      \param halo The halo to use for the gather.
+      \param aosoa The AoSoA on which to perform the gather. Sized as for
+      gather().
+    */
+    GatherRma( const HaloType& halo, AoSoAType& aosoa )
+        : _halo( halo )
+        , _aosoa( aosoa )
+    {
+        if ( !haloCheckValidSize( halo, aosoa ) )
+            throw std::runtime_error( "AoSoA is the wrong size for gather!" );
+
+        // Allocate the communication buffers.
+        _send_buffer = buffer_type(
+            Kokkos::ViewAllocateWithoutInitializing( "gather_rma_send" ),
+            _halo.totalNumExport() );
+        _recv_buffer = buffer_type(
+            Kokkos::ViewAllocateWithoutInitializing( "gather_rma_recv" ),
+            _halo.totalNumImport() );
+
+        // Expose the receive buffer as a window.
+        MPI_Win_create( _recv_buffer.data(),
+                        _recv_buffer.size() * sizeof( data_type ),
+                        sizeof( data_type ), MPI_INFO_NULL, _halo.comm(),
+                        &_window );
+
+        // Tell each neighbor where its data lands in our window. The
+        // offsets are static until the halo is rebuilt.
+        const int num_n = _halo.numNeighbor();
+        _target_offsets.resize( num_n );
+        std::vector<std::size_t> import_offsets( num_n );
+        std::size_t offset = 0;
+        for ( int n = 0; n < num_n; ++n )
+        {
+            import_offsets[n] = offset;
+            offset += _halo.numImport( n );
+        }
+        const int mpi_tag = 3456;
+        for ( int n = 0; n < num_n; ++n )
+            MPI_Sendrecv( &import_offsets[n], 1, MPI_UNSIGNED_LONG,
+                          _halo.neighborRank( n ), mpi_tag,
+                          &_target_offsets[n], 1, MPI_UNSIGNED_LONG,
+                          _halo.neighborRank( n ), mpi_tag, _halo.comm(),
+                          MPI_STATUS_IGNORE );
+    }
+
+    ~GatherRma() { MPI_Win_free( &_window ); }
+
+    //! Windows are a unique resource.
+    GatherRma( const GatherRma& ) = delete;
+    //! Windows are a unique resource.
+    GatherRma& operator=( const GatherRma& ) = delete;
+
+    //! Perform the gather with one-sided delivery.
+    void apply()
+    {
+        Kokkos::Profiling::ScopedRegion region( "Cabana::gatherRma" );
+
+        // Pack the exports.
+        auto send_buffer = _send_buffer;
+        auto aosoa = _aosoa;
+        auto steering = _halo.getExportSteering();
+        Kokkos::parallel_for(
+            "Cabana::gatherRma::pack",
+            Kokkos::RangePolicy<execution_space>( 0,
+                                                  _halo.totalNumExport() ),
+            KOKKOS_LAMBDA( const std::size_t i ) {
+                send_buffer( i ) = aosoa.getTuple( steering( i ) );
+            } );
+        Kokkos::fence();
+
+        // Deliver every neighbor's data with one put inside a fence epoch.
+        MPI_Win_fence( 0, _window );
+        const int num_n = _halo.numNeighbor();
+        std::size_t send_offset = 0;
+        for ( int n = 0; n < num_n; ++n )
+        {
+            const std::size_t num_export = _halo.numExport( n );
+            if ( num_export > 0 )
+                MPI_Put( _send_buffer.data() + send_offset,
+                         num_export * sizeof( data_type ), MPI_BYTE,
+                         _halo.neighborRank( n ), _target_offsets[n],
+                         num_export * sizeof( data_type ), MPI_BYTE,
+                         _window );
+            send_offset += num_export;
+        }
+        MPI_Win_fence( 0, _window );
+
+        // Unpack into the ghosts.
+        auto recv_buffer = _recv_buffer;
+        const std::size_t num_local = _halo.numLocal();
+        Kokkos::parallel_for(
+            "Cabana::gatherRma::unpack",
+            Kokkos::RangePolicy<execution_space>( 0,
+                                                  _halo.totalNumImport() ),
+            KOKKOS_LAMBDA( const std::size_t i ) {
+                aosoa.setTuple( i + num_local, recv_buffer( i ) );
+            } );
+        Kokkos::fence();
+    }
+
+  private:
+    HaloType _halo;
+    AoSoAType _aosoa;
+    buffer_type _send_buffer;
+    buffer_type _recv_buffer;
+    MPI_Win _window;
+    std::vector<std::size_t> _target_offsets;
+};
+
+/*!
+  \brief Create a one-sided gather.
+  \param halo The halo to use for the gather.
+  \param aosoa The AoSoA on which to perform the gather.
+  \return GatherRma
+*/
+template <class HaloType, class AoSoAType>
+auto createGatherRma( const HaloType& halo, AoSoAType& aosoa )
+{
+    return std::make_shared<GatherRma<HaloType, AoSoAType>>( halo, aosoa );
+}
+
 /**********
  * SCATTER *
  **********/
 
+//---------------------------------------------------------------------------//
+//! Scatter combine operation: sum ghost contributions into the owner.
+struct ScatterSum
+{
+    //! Combine a ghost contribution into an owned value.
+    template <class T>
+    KOKKOS_INLINE_FUNCTION void operator()( T& owned,
+                                            const T contribution ) const
+    {
+        Kokkos::atomic_add( &owned, contribution );
+    }
+};
+
+//! Scatter combine operation: keep the minimum of owner and ghosts.
+struct ScatterMin
+{
+    //! Combine a ghost contribution into an owned value.
+    template <class T>
+    KOKKOS_INLINE_FUNCTION void operator()( T& owned,
+                                            const T contribution ) const
+    {
+        Kokkos::atomic_min( &owned, contribution );
+    }
+};
+
+//! Scatter combine operation: keep the maximum of owner and ghosts.
+struct ScatterMax
+{
+    //! Combine a ghost contribution into an owned value.
+    template <class T>
+    KOKKOS_INLINE_FUNCTION void operator()( T& owned,
+                                            const T contribution ) const
+    {
+        Kokkos::atomic_max( &owned, contribution );
+    }
+};
+
+//! \cond Impl
+namespace Impl
+{
+// Pack the ghost values of a slice and reverse-exchange them, returning the
+// received contributions ordered by the export steering.
+template <class HaloType, class SliceType>
+auto scatterExchange( const HaloType& halo, SliceType& slice,
+                      const std::size_t num_comp )
+{
+    using memory_space = typename HaloType::memory_space;
+    using execution_space = typename memory_space::execution_space;
+    using data_type = typename SliceType::value_type;
+
+
+    // Allocate the send and receive buffers. The scatter reverses the halo
+    // so ghosts send and owners receive.
+    Kokkos::View<data_type**, Kokkos::LayoutRight, memory_space> send_buffer(
+        Kokkos::ViewAllocateWithoutInitializing( "scatter_send_buffer" ),
+        halo.totalNumImport(), num_comp );
+    Kokkos::View<data_type**, Kokkos::LayoutRight, memory_space> recv_buffer(
+        Kokkos::ViewAllocateWithoutInitializing( "scatter_recv_buffer" ),
+        halo.totalNumExport(), num_comp );
+
+    // Get the raw slice data.
+    auto slice_data = slice.data();
+
+    // Pack the ghosted values.
+    std::size_t num_local = halo.numLocal();
+    auto extract_send_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        std::size_t ghost_idx = i + num_local;
+        auto s = SliceType::index_type::s( ghost_idx );
+        auto a = SliceType::index_type::a( ghost_idx );
+        std::size_t slice_offset = s * slice.stride( 0 ) + a;
+        for ( std::size_t n = 0; n < num_comp; ++n )
+            send_buffer( i, n ) =
+                slice_data[slice_offset + SliceType::vector_length * n];
+    };
+    Kokkos::RangePolicy<execution_space> send_policy(
+        0, halo.totalNumImport() );
+    Kokkos::parallel_for( "Cabana::scatterReduce::extract_send_buffer",
+                          send_policy, extract_send_buffer_func );
+    Kokkos::fence();
+
+    // The halo has it's own communication space so choose any mpi tag.
+    const int mpi_tag = 2347;
+
+    // Post non-blocking receives.
+    int num_n = halo.numNeighbor();
+    std::vector<MPI_Request> requests( num_n );
+    std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
+    for ( int n = 0; n < num_n; ++n )
+    {
+        recv_range.second = recv_range.first + halo.numExport( n );
+
+        auto recv_subview =
+            Kokkos::subview( recv_buffer, recv_range, Kokkos::ALL );
+
+        MPI_Irecv( recv_subview.data(),
+                   recv_subview.size() * sizeof( data_type ), MPI_BYTE,
+                   halo.neighborRank( n ), mpi_tag, halo.comm(),
+                   &( requests[n] ) );
+
+        recv_range.first = recv_range.second;
+    }
+
+    // Do blocking sends.
+    std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
+    for ( int n = 0; n < num_n; ++n )
+    {
+        send_range.second = send_range.first + halo.numImport( n );
+
+        auto send_subview =
+            Kokkos::subview( send_buffer, send_range, Kokkos::ALL );
+
+        MPI_Send( send_subview.data(),
+                  send_subview.size() * sizeof( data_type ), MPI_BYTE,
+                  halo.neighborRank( n ), mpi_tag, halo.comm() );
+
+        send_range.first = send_range.second;
+    }
+
+    // Wait on non-blocking receives.
+    std::vector<MPI_Status> status( num_n );
+    const int ec =
+        MPI_Waitall( requests.size(), requests.data(), status.data() );
+    if ( MPI_SUCCESS != ec )
+        throw std::logic_error( "Failed MPI Communication" );
+
+    return recv_buffer;
+}
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Synchronously scatter slice data from the ghosts to the local
+  decomposition combining with a user operation.
+
+  \param halo The halo to use for the scatter.
+  \param slice The slice on which to perform the scatter. Sized as for
+  scatter().
+  \param combine_op The operation combining each ghost contribution into
+  the owned value. ScatterSum reproduces the default scatter; ScatterMin /
+  ScatterMax support contact-style reductions, and any functor with an
+  atomicity-safe (owned&, contribution) call operator may be supplied (e.g.
+  masked accumulation). Replaces the second full-halo round trip previously
+  needed to emulate non-sum combining.
+*/
+template <class HaloType, class SliceType, class CombineOp>
+void scatterReduce( const HaloType& halo, SliceType& slice,
+                    const CombineOp& combine_op,
+                    typename std::enable_if<( is_halo<HaloType>::value &&
+                                              is_slice<SliceType>::value ),
+                                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::scatterReduce" );
+
+    if ( !haloCheckValidSize( halo, slice ) )
+        throw std::runtime_error( "Slice is the wrong size for scatter!" );
+
+    using memory_space = typename HaloType::memory_space;
+    using execution_space = typename memory_space::execution_space;
+
+    // Get the number of components in the slice.
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < slice.viewRank(); ++d )
+        num_comp *= slice.extent( d );
+
+    // Exchange the ghost contributions.
+    auto recv_buffer = Impl::scatterExchange( halo, slice, num_comp );
+    auto slice_data = slice.data();
+
+    // Combine the ghost contributions into the local values.
+    auto steering = halo.getExportSteering();
+    auto scatter_recv_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        auto s = SliceType::index_type::s( steering( i ) );
+        auto a = SliceType::index_type::a( steering( i ) );
+        std::size_t slice_offset = s * slice.stride( 0 ) + a;
+        for ( std::size_t n = 0; n < num_comp; ++n )
+            combine_op(
+                slice_data[slice_offset + SliceType::vector_length * n],
+                recv_buffer( i, n ) );
+    };
+    Kokkos::RangePolicy<execution_space> recv_policy(
+        0, halo.totalNumExport() );
+    Kokkos::parallel_for( "Cabana::scatterReduce::scatter_recv_buffer",
+                          recv_policy, scatter_recv_buffer_func );
+    Kokkos::fence();
+
+    // Barrier before completing to ensure synchronization.
+    MPI_Barrier( halo.comm() );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Deterministic owner-sorted unpack plan for halo scatter.
+
+  \tparam MemorySpace Kokkos memory space.
+
+  Built once per halo: the scatter contributions are sorted by the owned
+  element they target and grouped into segments, so the unpack can reduce
+  each owned element's contributions serially in a fixed order - no atomics
+  and bitwise run-to-run reproducibility.
+*/
+template <class MemorySpace>
+struct ScatterSegments
+{
+    //! Contribution indices sorted by owned element.
+    Kokkos::View<std::size_t*, MemorySpace> order;
+    //! Start of each segment in the sorted order (num_segment + 1 entries).
+    Kokkos::View<std::size_t*, MemorySpace> segment_begin;
+    //! The owned element each segment targets.
+    Kokkos::View<std::size_t*, MemorySpace> segment_element;
+    //! Number of segments (distinct owned elements receiving data).
+    std::size_t num_segment;
+};
+
+/*!
+  \brief Build the owner-sorted segments of a halo's scatter contributions.
+  \param halo The halo to build the segments for. Rebuild after the halo
+  changes.
+  \return ScatterSegments for deterministic scatter unpacks.
+*/
+template <class HaloType>
+auto createScatterSegments( const HaloType& halo )
+{
+    using memory_space = typename HaloType::memory_space;
+    using execution_space = typename memory_space::execution_space;
+
+    ScatterSegments<memory_space> segments;
+    auto steering = halo.getExportSteering();
+    const std::size_t num_contrib = halo.totalNumExport();
+
+    // Sort the contribution indices by target element. Sorting within bins
+    // fixes the combine order deterministically.
+    Kokkos::View<std::size_t*, memory_space> keys(
+        Kokkos::ViewAllocateWithoutInitializing( "scatter_keys" ),
+        num_contrib );
+    Kokkos::deep_copy( keys, steering );
+    auto bin_data = sortByKey( keys );
+    segments.order = Kokkos::View<std::size_t*, memory_space>(
+        Kokkos::ViewAllocateWithoutInitializing( "scatter_order" ),
+        num_contrib );
+    auto order = segments.order;
+    Kokkos::parallel_for(
+        "Cabana::createScatterSegments::order",
+        Kokkos::RangePolicy<execution_space>( 0, num_contrib ),
+        KOKKOS_LAMBDA( const std::size_t k ) {
+            order( k ) = bin_data.permutation( k );
+        } );
+
+    // Mark and count the segment starts.
+    Kokkos::View<std::size_t*, memory_space> segment_id(
+        Kokkos::ViewAllocateWithoutInitializing( "scatter_segment_id" ),
+        num_contrib );
+    std::size_t num_segment = 0;
+    Kokkos::parallel_scan(
+        "Cabana::createScatterSegments::count",
+        Kokkos::RangePolicy<execution_space>( 0, num_contrib ),
+        KOKKOS_LAMBDA( const std::size_t k, std::size_t& update,
+                       const bool final_pass ) {
+            const bool is_start =
+                ( 0 == k ) || ( steering( order( k ) ) !=
+                                steering( order( k - 1 ) ) );
+            if ( final_pass )
+                segment_id( k ) = update;
+            if ( is_start )
+                ++update;
+        },
+        num_segment );
+    Kokkos::fence();
+    segments.num_segment = num_segment;
+
+    // Fill the segment table.
+    segments.segment_begin = Kokkos::View<std::size_t*, memory_space>(
+        Kokkos::ViewAllocateWithoutInitializing( "scatter_segment_begin" ),
+        num_segment + 1 );
+    segments.segment_element = Kokkos::View<std::size_t*, memory_space>(
+        Kokkos::ViewAllocateWithoutInitializing( "scatter_segment_element" ),
+        num_segment );
+    auto segment_begin = segments.segment_begin;
+    auto segment_element = segments.segment_element;
+    Kokkos::parallel_for(
+        "Cabana::createScatterSegments::fill",
+        Kokkos::RangePolicy<execution_space>( 0, num_contrib ),
+        KOKKOS_LAMBDA( const std::size_t k ) {
+            const bool is_start =
+                ( 0 == k ) || ( steering( order( k ) ) !=
+                                steering( order( k - 1 ) ) );
+            if ( is_start )
+            {
+                segment_begin( segment_id( k ) ) = k;
+                segment_element( segment_id( k ) ) = steering( order( k ) );
+            }
+            if ( num_contrib - 1 == k )
+                segment_begin( segment_id( k ) + 1 ) = num_contrib;
+        } );
+    Kokkos::fence();
+
+    return segments;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Synchronously scatter slice data from the ghosts to the local
+  decomposition with a deterministic segmented-sum unpack.
+
+  \param halo The halo to use for the scatter.
+  \param slice The slice on which to perform the scatter. Sized as for
+  scatter().
+  \param segments Owner-sorted segments from createScatterSegments().
+
+  Each owned element's contributions are reduced serially in sorted order
+  by one thread, removing both the atomic hotspot of the default scatter
+  (many ghosts mapping to one owner) and its run-to-run floating point
+  nondeterminism.
+*/
+template <class HaloType, class SliceType>
+void scatterSegmented(
+    const HaloType& halo, SliceType& slice,
+    const ScatterSegments<typename HaloType::memory_space>& segments,
+    typename std::enable_if<( is_halo<HaloType>::value &&
+                              is_slice<SliceType>::value ),
+                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::scatterSegmented" );
+
+    if ( !haloCheckValidSize( halo, slice ) )
+        throw std::runtime_error( "Slice is the wrong size for scatter!" );
+
+    using memory_space = typename HaloType::memory_space;
+    using execution_space = typename memory_space::execution_space;
+    using data_type = typename SliceType::value_type;
+
+    // Get the number of components in the slice.
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < slice.viewRank(); ++d )
+        num_comp *= slice.extent( d );
+
+    // Exchange the ghost contributions.
+    auto recv_buffer = Impl::scatterExchange( halo, slice, num_comp );
+    auto slice_data = slice.data();
+
+    // Reduce each owned element's segment serially in sorted order.
+    auto order = segments.order;
+    auto segment_begin = segments.segment_begin;
+    auto segment_element = segments.segment_element;
+    auto segmented_unpack_func = KOKKOS_LAMBDA( const std::size_t seg )
+    {
+        const std::size_t element = segment_element( seg );
+        auto s = SliceType::index_type::s( element );
+        auto a = SliceType::index_type::a( element );
+        std::size_t slice_offset = s * slice.stride( 0 ) + a;
+        for ( std::size_t n = 0; n < num_comp; ++n )
+        {
+            data_type sum = 0;
+            for ( std::size_t k = segment_begin( seg );
+                  k < segment_begin( seg + 1 ); ++k )
+                sum += recv_buffer( order( k ), n );
+            slice_data[slice_offset + SliceType::vector_length * n] += sum;
+        }
+    };
+    Kokkos::parallel_for(
+        "Cabana::scatterSegmented::unpack",
+        Kokkos::RangePolicy<execution_space>( 0, segments.num_segment ),
+        segmented_unpack_func );
+    Kokkos::fence();
+
+    // Barrier before completing to ensure synchronization.
+    MPI_Barrier( halo.comm() );
+}
+
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Synchronously scatter data from the ghosts to the local decomposition
@@ -712,9 +1804,11 @@ class Scatter
       \brief Perform the scatter operation.
     */
     template <class ExecutionSpace>
-    void apply( ExecutionSpace )
+    void apply( ExecutionSpace exec_space )
     {
         Kokkos::Profiling::ScopedRegion region( "Cabana::scatter" );
+        ScopedOperationTimer operation_timer(
+            "scatter", ( _send_size + _recv_size ) * sizeof( data_type ) );
 
         // Get the buffers (local copies for lambdas below).
         auto send_buffer = this->getSendBuffer();
@@ -742,10 +1836,11 @@ class Scatter
                 send_buffer( i, n ) =
                     slice_data( slice_offset + SliceType::vector_length * n );
         };
-        Kokkos::RangePolicy<ExecutionSpace> send_policy( 0, _send_size );
+        Kokkos::RangePolicy<ExecutionSpace> send_policy( exec_space, 0,
+                                                          _send_size );
         Kokkos::parallel_for( "Cabana::scatter::extract_send_buffer",
                               send_policy, extract_send_buffer_func );
-        Kokkos::fence();
+        exec_space.fence();
 
         // The halo has it's own communication space so choose any mpi tag.
         const int mpi_tag = 2345;
@@ -806,10 +1901,11 @@ class Scatter
                     &slice_data( slice_offset + SliceType::vector_length * n ),
                     recv_buffer( i, n ) );
         };
-        Kokkos::RangePolicy<ExecutionSpace> recv_policy( 0, _recv_size );
+        Kokkos::RangePolicy<ExecutionSpace> recv_policy( exec_space, 0,
+                                                          _recv_size );
         Kokkos::parallel_for( "Cabana::scatter::scatter_recv_buffer",
                               recv_policy, scatter_recv_buffer_func );
-        Kokkos::fence();
+        exec_space.fence();
 
         // Barrier before completing to ensure synchronization.
         MPI_Barrier( _halo.comm() );
@@ -886,7 +1982,7 @@ auto createScatter( const HaloType& halo, const SliceType& slice,
 
   \note This routine allocates send and receive buffers internally. This is
   often not performant due to frequent buffer reallocations - consider creating
-  and reusing Gather instead.
+  and reusing Scatter instead.
 
   \param halo The halo to use for the scatter.
 
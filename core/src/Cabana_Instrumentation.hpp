@@ -0,0 +1,281 @@
+/****************************************************************************
+ * Copyright (c) 2018-2023 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_Instrumentation.hpp
+  \brief Lightweight per-operation timing and counter registry
+*/
+#ifndef CABANA_INSTRUMENTATION_HPP
+#define CABANA_INSTRUMENTATION_HPP
+
+#include <mpi.h>
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Cabana
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Opt-in registry of per-operation cumulative time, bytes moved, and
+  invocation counts.
+
+  Communication and build operations (migrate, gather, scatter) record into
+  the registry when enabled; applications can record their own operations
+  through ScopedOperationTimer. report() reduces the metrics across an MPI
+  communicator and prints a per-operation table of the mean and maximum
+  time, total bytes, and counts, replacing hand-rolled timer bracketing.
+  Recording is disabled by default and costs nothing when off.
+*/
+class OperationRegistry
+{
+  public:
+    //! Accumulated metrics of one operation.
+    struct Record
+    {
+        //! Cumulative seconds.
+        double time = 0.0;
+        //! Cumulative bytes moved.
+        std::size_t bytes = 0;
+        //! Number of invocations.
+        std::size_t count = 0;
+    };
+
+    //! Get the process-wide registry.
+    static OperationRegistry& instance()
+    {
+        static OperationRegistry registry;
+        return registry;
+    }
+
+    //! Enable or disable recording.
+    void enable( const bool enabled ) { _enabled = enabled; }
+
+    //! Whether recording is enabled.
+    bool enabled() const { return _enabled; }
+
+    /*!
+      \brief Record one invocation of an operation.
+      \param name The operation name.
+      \param seconds Elapsed wall time.
+      \param bytes Bytes moved, if meaningful.
+    */
+    void record( const std::string& name, const double seconds,
+                 const std::size_t bytes = 0 )
+    {
+        if ( !_enabled )
+            return;
+        auto& record = _records[name];
+        record.time += seconds;
+        record.bytes += bytes;
+        ++record.count;
+    }
+
+    //! Discard all recorded metrics.
+    void reset() { _records.clear(); }
+
+    /*!
+      \brief Print a per-operation report reduced over a communicator.
+      \param comm The communicator to reduce over. Collective.
+      \param out The stream rank 0 prints to.
+    */
+    void report( MPI_Comm comm, std::ostream& out = std::cout ) const
+    {
+        int comm_rank;
+        MPI_Comm_rank( comm, &comm_rank );
+        int comm_size;
+        MPI_Comm_size( comm, &comm_size );
+
+        if ( 0 == comm_rank )
+            out << "Cabana operation report\n"
+                << "operation  mean_time(s)  max_time(s)  total_bytes  "
+                   "count\n";
+
+        // The operation set is assumed consistent across ranks, as all
+        // recorded operations are collective.
+        for ( const auto& entry : _records )
+        {
+            double time_sum = entry.second.time;
+            double time_max = entry.second.time;
+            unsigned long bytes = entry.second.bytes;
+            unsigned long count = entry.second.count;
+            MPI_Allreduce( MPI_IN_PLACE, &time_sum, 1, MPI_DOUBLE, MPI_SUM,
+                           comm );
+            MPI_Allreduce( MPI_IN_PLACE, &time_max, 1, MPI_DOUBLE, MPI_MAX,
+                           comm );
+            MPI_Allreduce( MPI_IN_PLACE, &bytes, 1, MPI_UNSIGNED_LONG,
+                           MPI_SUM, comm );
+            MPI_Allreduce( MPI_IN_PLACE, &count, 1, MPI_UNSIGNED_LONG,
+                           MPI_MAX, comm );
+
+            if ( 0 == comm_rank )
+                out << entry.first << "  " << time_sum / comm_size << "  "
+                    << time_max << "  " << bytes << "  " << count << "\n";
+        }
+    }
+
+  private:
+    OperationRegistry() = default;
+
+    bool _enabled = false;
+    std::map<std::string, Record> _records;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Scope guard recording one operation invocation into the registry.
+*/
+class ScopedOperationTimer
+{
+  public:
+    /*!
+      \brief Start timing an operation.
+      \param name The operation name.
+      \param bytes Bytes moved by the operation, if meaningful.
+    */
+    ScopedOperationTimer( const std::string& name,
+                          const std::size_t bytes = 0 )
+        : _name( name )
+        , _bytes( bytes )
+        , _start( std::chrono::steady_clock::now() )
+    {
+    }
+
+    ~ScopedOperationTimer()
+    {
+        OperationRegistry::instance().record(
+            _name,
+            std::chrono::duration<double>( std::chrono::steady_clock::now() -
+                                           _start )
+                .count(),
+            _bytes );
+    }
+
+  private:
+    std::string _name;
+    std::size_t _bytes;
+    std::chrono::steady_clock::time_point _start;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Opt-in ring buffer of per-neighbor communication events dumpable
+  to Chrome trace format.
+
+  Halo exchanges record the post time, duration, and size of each
+  per-neighbor message when tracing is enabled. dumpChromeTrace() writes the
+  buffered events as a chrome://tracing / Perfetto compatible JSON array
+  with one track per neighbor, making late-sender imbalance visible without
+  intercepting MPI through external tools. The buffer wraps at the
+  configured capacity; tracing is off by default and free when disabled.
+*/
+class CommTracer
+{
+  public:
+    //! One recorded communication event.
+    struct Event
+    {
+        //! Event name (e.g. gather_send).
+        std::string name;
+        //! Neighbor rank of the message.
+        int neighbor;
+        //! Message size in bytes.
+        std::size_t bytes;
+        //! Event begin, seconds since the tracer epoch.
+        double t_begin;
+        //! Event end, seconds since the tracer epoch.
+        double t_end;
+    };
+
+    //! Get the process-wide tracer.
+    static CommTracer& instance()
+    {
+        static CommTracer tracer;
+        return tracer;
+    }
+
+    //! Enable or disable tracing.
+    void enable( const bool enabled ) { _enabled = enabled; }
+
+    //! Whether tracing is enabled.
+    bool enabled() const { return _enabled; }
+
+    //! Set the ring buffer capacity.
+    void setCapacity( const std::size_t capacity ) { _capacity = capacity; }
+
+    //! Seconds since the tracer epoch.
+    double now() const
+    {
+        return std::chrono::duration<double>(
+                   std::chrono::steady_clock::now() - _epoch )
+            .count();
+    }
+
+    //! Record a communication event.
+    void record( const std::string& name, const int neighbor,
+                 const std::size_t bytes, const double t_begin,
+                 const double t_end )
+    {
+        if ( !_enabled )
+            return;
+        if ( _events.size() < _capacity )
+            _events.push_back( { name, neighbor, bytes, t_begin, t_end } );
+        else
+            _events[_next_overwrite++ % _capacity] = { name, neighbor, bytes,
+                                                       t_begin, t_end };
+    }
+
+    //! Discard all buffered events.
+    void reset() { _events.clear(); }
+
+    /*!
+      \brief Dump the buffered events in Chrome trace format.
+      \param out The stream to write the JSON array to.
+      \param rank This process's rank, used as the trace process id.
+    */
+    void dumpChromeTrace( std::ostream& out, const int rank ) const
+    {
+        out << "[\n";
+        for ( std::size_t e = 0; e < _events.size(); ++e )
+        {
+            const auto& event = _events[e];
+            out << "  { \"name\": \"" << event.name
+                << "\", \"ph\": \"X\", \"ts\": " << event.t_begin * 1.0e6
+                << ", \"dur\": " << ( event.t_end - event.t_begin ) * 1.0e6
+                << ", \"pid\": " << rank << ", \"tid\": " << event.neighbor
+                << ", \"args\": { \"bytes\": " << event.bytes << " } }";
+            out << ( e + 1 < _events.size() ? ",\n" : "\n" );
+        }
+        out << "]\n";
+    }
+
+  private:
+    CommTracer()
+        : _epoch( std::chrono::steady_clock::now() )
+    {
+    }
+
+    bool _enabled = false;
+    std::size_t _capacity = 4096;
+    std::size_t _next_overwrite = 0;
+    std::vector<Event> _events;
+    std::chrono::steady_clock::time_point _epoch;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_INSTRUMENTATION_HPP
@@ -399,8 +399,8 @@ class LinkedCellList
       neighbors.
     */
     template <class ExecutionSpace, class PositionType>
-    void build( ExecutionSpace, PositionType positions, const std::size_t begin,
-                const std::size_t end )
+    void build( ExecutionSpace exec_space, PositionType positions,
+                const std::size_t begin, const std::size_t end )
     {
         Kokkos::Profiling::ScopedRegion region(
             "Cabana::LinkedCellList::build" );
@@ -430,8 +430,9 @@ class LinkedCellList
         auto permutes = _permutes;
 
         // Count.
-        Kokkos::RangePolicy<ExecutionSpace> particle_range( begin, end );
-        Kokkos::deep_copy( _counts, 0 );
+        Kokkos::RangePolicy<ExecutionSpace> particle_range( exec_space, begin,
+                                                            end );
+        Kokkos::deep_copy( exec_space, _counts, 0 );
         auto counts_sv = Kokkos::Experimental::create_scatter_view( _counts );
         auto cell_count = KOKKOS_LAMBDA( const std::size_t p )
         {
@@ -443,11 +444,10 @@ class LinkedCellList
         };
         Kokkos::parallel_for( "Cabana::LinkedCellList::build::cell_count",
                               particle_range, cell_count );
-        Kokkos::fence();
-        Kokkos::Experimental::contribute( _counts, counts_sv );
+        Kokkos::Experimental::contribute( exec_space, _counts, counts_sv );
 
         // Compute offsets.
-        Kokkos::RangePolicy<ExecutionSpace> cell_range( 0, ncell );
+        Kokkos::RangePolicy<ExecutionSpace> cell_range( exec_space, 0, ncell );
         auto offset_scan = KOKKOS_LAMBDA( const std::size_t c, int& update,
                                           const bool final_pass )
         {
@@ -457,10 +457,9 @@ class LinkedCellList
         };
         Kokkos::parallel_scan( "Cabana::LinkedCellList::build::offset_scan",
                                cell_range, offset_scan );
-        Kokkos::fence();
 
         // Reset counts.
-        Kokkos::deep_copy( _counts, 0 );
+        Kokkos::deep_copy( exec_space, _counts, 0 );
 
         // Compute the permutation vector.
         auto create_permute = KOKKOS_LAMBDA( const std::size_t p )
@@ -474,7 +473,7 @@ class LinkedCellList
         };
         Kokkos::parallel_for( "Cabana::LinkedCellList::build::create_permute",
                               particle_range, create_permute );
-        Kokkos::fence();
+        exec_space.fence();
 
         // Create the binning data.
         _bin_data = BinningData<MemorySpace>( begin, end, _counts, _offsets,
@@ -518,6 +517,212 @@ class LinkedCellList
         build( positions, 0, size( positions ) );
     }
 
+    /*!
+      \brief Relaxed rebuild: keep stale bin assignments and re-bin exactly
+      only every rebuild_interval calls.
+
+      \tparam ExecutionSpace Kokkos execution space.
+      \tparam PositionType Type for positions.
+
+      \param exec_space Kokkos execution space.
+      \param positions Particle positions.
+      \param begin The beginning index of particles to bin.
+      \param end The end index of particles to bin.
+      \param rebuild_interval Number of calls between exact rebuilds.
+      \return True if an exact rebuild was performed this call.
+
+      Weakly interacting systems tolerate bins that lag particle motion
+      when traversals use a stencil widened to cover the expected drift
+      (e.g. a larger neighborhood radius at construction). Calls between
+      the exact rebuilds cost nothing, so per-step binning drops to one
+      exact pass every rebuild_interval steps.
+    */
+    template <class ExecutionSpace, class PositionType>
+    bool buildRelaxed( ExecutionSpace exec_space, PositionType positions,
+                       const std::size_t begin, const std::size_t end,
+                       const int rebuild_interval )
+    {
+        ++_relaxed_step;
+        if ( _relaxed_step < rebuild_interval )
+            return false;
+
+        _relaxed_step = 0;
+        build( exec_space, positions, begin, end );
+        return true;
+    }
+
+    /*!
+      \brief Relaxed rebuild over all particles with the default execution
+      space.
+      \return True if an exact rebuild was performed this call.
+    */
+    template <class PositionType>
+    bool buildRelaxed( PositionType positions, const int rebuild_interval )
+    {
+        return buildRelaxed( execution_space{}, positions, 0,
+                             size( positions ), rebuild_interval );
+    }
+
+    /*!
+      \brief Build the linked cell list and sort the particles in the same
+      operation.
+
+      \tparam ExecutionSpace Kokkos execution space.
+      \tparam PositionType Type for positions.
+      \tparam AoSoAType AoSoA type.
+
+      \param exec_space Kokkos execution space.
+      \param positions Particle positions (a slice of the given AoSoA).
+      \param aosoa The particle data to sort.
+
+      Counting-sort style fusion of build() and permute(): after the binning
+      indices are computed, every tuple is scattered directly to its binned
+      destination in a fresh allocation that then replaces the AoSoA's
+      storage. The particle data is touched in a single
+      read-once-write-once pass instead of the gather-to-scratch plus
+      copy-back of a separate permute(). The AoSoA allocation changes, so
+      outstanding slices (including the given position slice) must be
+      re-created. The list is marked sorted.
+    */
+    template <class ExecutionSpace, class PositionType, class AoSoAType>
+    void buildAndPermute( ExecutionSpace exec_space, PositionType positions,
+                          AoSoAType& aosoa )
+    {
+        Kokkos::Profiling::ScopedRegion region(
+            "Cabana::LinkedCellList::buildAndPermute" );
+
+        static_assert( is_aosoa<AoSoAType>::value,
+                       "buildAndPermute requires an AoSoA" );
+
+        // Compute the binning.
+        build( exec_space, positions, 0, size( positions ) );
+
+        // Scatter the tuples directly to their binned destinations and
+        // replace the particle storage.
+        AoSoAType binned( aosoa.label(), aosoa.size() );
+        auto bin_data = _bin_data;
+        Kokkos::parallel_for(
+            "Cabana::LinkedCellList::buildAndPermute::scatter",
+            Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0,
+                                                 aosoa.size() ),
+            KOKKOS_LAMBDA( const std::size_t i ) {
+                binned.setTuple( i,
+                                 aosoa.getTuple( bin_data.permutation( i ) ) );
+            } );
+        exec_space.fence();
+        aosoa = binned;
+
+        // Update internal state.
+        update( true );
+        storeParticleBins();
+    }
+
+    /*!
+      \brief Build the linked cell list and sort the particles in the same
+      operation with the default execution space.
+    */
+    template <class PositionType, class AoSoAType>
+    void buildAndPermute( PositionType positions, AoSoAType& aosoa )
+    {
+        buildAndPermute( execution_space{}, positions, aosoa );
+    }
+
+    /*!
+      \brief Rebuild the linked cell list with a subset of particles only if
+      any particle changed cells since the last build.
+
+      Intended for mostly-static systems where rebuilding every step wastes
+      the count, scan, and permute passes. A single read-only sweep compares
+      each particle's current cell against the stored per-particle bins and
+      the existing binning is kept when nothing moved.
+
+      \tparam ExecutionSpace Kokkos execution space.
+      \tparam PositionType Type for positions.
+
+      \param exec_space Kokkos execution space.
+      \param positions Particle positions.
+      \param begin The beginning index of particles to bin.
+      \param end The end index of particles to bin.
+      \return True if a rebuild was performed.
+    */
+    template <class ExecutionSpace, class PositionType>
+    bool buildIncremental( ExecutionSpace exec_space, PositionType positions,
+                           const std::size_t begin, const std::size_t end )
+    {
+        Kokkos::Profiling::ScopedRegion region(
+            "Cabana::LinkedCellList::buildIncremental" );
+
+        static_assert( is_accessible_from<memory_space, ExecutionSpace>{}, "" );
+
+        // A full build is needed if the binned range changed.
+        if ( begin != _begin || end != _end ||
+             _particle_bins.extent( 0 ) != end - begin )
+        {
+            build( exec_space, positions, begin, end );
+            return true;
+        }
+
+        // Count the particles whose cell changed since the last build.
+        auto grid = _grid;
+        auto particle_bins = _particle_bins;
+        int num_moved = 0;
+        Kokkos::parallel_reduce(
+            "Cabana::LinkedCellList::buildIncremental::count_moved",
+            Kokkos::RangePolicy<ExecutionSpace>( begin, end ),
+            KOKKOS_LAMBDA( const std::size_t p, int& moved ) {
+                int i, j, k;
+                grid.locatePoint( positions( p, 0 ), positions( p, 1 ),
+                                  positions( p, 2 ), i, j, k );
+                if ( static_cast<int>( grid.cardinalCellIndex( i, j, k ) ) !=
+                     particle_bins( p - begin ) )
+                    ++moved;
+            },
+            num_moved );
+        Kokkos::fence();
+
+        // The existing binning is still valid if nothing moved between
+        // cells.
+        if ( 0 == num_moved )
+            return false;
+
+        build( exec_space, positions, begin, end );
+        return true;
+    }
+
+    /*!
+      \brief Rebuild the linked cell list with a subset of particles only if
+      any particle changed cells since the last build.
+
+      \tparam PositionType Type for positions.
+
+      \param positions Particle positions.
+      \param begin The beginning index of particles to bin.
+      \param end The end index of particles to bin.
+      \return True if a rebuild was performed.
+    */
+    template <class PositionType>
+    bool buildIncremental( PositionType positions, const std::size_t begin,
+                           const std::size_t end )
+    {
+        // Use the default execution space.
+        return buildIncremental( execution_space{}, positions, begin, end );
+    }
+
+    /*!
+      \brief Rebuild the linked cell list with all particles only if any
+      particle changed cells since the last build.
+
+      \tparam PositionType Type for positions.
+
+      \param positions Particle positions.
+      \return True if a rebuild was performed.
+    */
+    template <class PositionType>
+    bool buildIncremental( PositionType positions )
+    {
+        return buildIncremental( positions, 0, size( positions ) );
+    }
+
     /*!
       \brief Store the bin cell index for each binned particle.
     */
@@ -590,6 +795,99 @@ class LinkedCellList
         _cell_stencil.getCells( cell, imin, imax, jmin, jmax, kmin, kmax );
     }
 
+    /*!
+      \brief Precompute the per-bin neighbor-bin table with periodic
+      wrapping resolved.
+
+      \param periodic Whether each dimension wraps periodically.
+
+      After this call the traversal inner loop can read neighbor bin ids
+      straight from the table via numStencilBins()/stencilBin() instead of
+      recomputing stencil bounds and wrapping arithmetic per particle. Bins
+      on non-periodic boundaries simply store fewer entries. The table is
+      invalidated by a change of grid, so rebuild it after constructing the
+      list for a new domain.
+    */
+    void buildStencilTable( const bool periodic[3] )
+    {
+        const int num_bin = totalBins();
+        const int max_cells = _cell_stencil.max_cells;
+        const int cell_range = _cell_stencil.cell_range;
+        _stencil_table = Kokkos::View<int**, memory_space>(
+            Kokkos::ViewAllocateWithoutInitializing( "stencil_table" ),
+            num_bin, max_cells );
+        _stencil_counts = CountView(
+            Kokkos::ViewAllocateWithoutInitializing( "stencil_counts" ),
+            num_bin );
+
+        auto grid = _grid;
+        auto table = _stencil_table;
+        auto table_counts = _stencil_counts;
+        const bool period_x = periodic[0];
+        const bool period_y = periodic[1];
+        const bool period_z = periodic[2];
+        Kokkos::parallel_for(
+            "Cabana::LinkedCellList::buildStencilTable",
+            Kokkos::RangePolicy<execution_space>( 0, num_bin ),
+            KOKKOS_LAMBDA( const int cell ) {
+                int i, j, k;
+                grid.ijkBinIndex( cell, i, j, k );
+
+                int count = 0;
+                for ( int di = -cell_range; di <= cell_range; ++di )
+                    for ( int dj = -cell_range; dj <= cell_range; ++dj )
+                        for ( int dk = -cell_range; dk <= cell_range; ++dk )
+                        {
+                            int ni = i + di;
+                            int nj = j + dj;
+                            int nk = k + dk;
+
+                            // Resolve the periodic images or skip the
+                            // out-of-domain bins.
+                            if ( ni < 0 || ni >= grid._nx )
+                            {
+                                if ( !period_x )
+                                    continue;
+                                ni = ( ni + grid._nx ) % grid._nx;
+                            }
+                            if ( nj < 0 || nj >= grid._ny )
+                            {
+                                if ( !period_y )
+                                    continue;
+                                nj = ( nj + grid._ny ) % grid._ny;
+                            }
+                            if ( nk < 0 || nk >= grid._nz )
+                            {
+                                if ( !period_z )
+                                    continue;
+                                nk = ( nk + grid._nz ) % grid._nz;
+                            }
+
+                            table( cell, count++ ) =
+                                grid.cardinalCellIndex( ni, nj, nk );
+                        }
+                table_counts( cell ) = count;
+            } );
+        Kokkos::fence();
+    }
+
+    //! Whether the per-bin stencil table has been built.
+    bool hasStencilTable() const { return _stencil_table.extent( 0 ) > 0; }
+
+    //! Get the number of neighbor bins of a bin in the stencil table.
+    KOKKOS_INLINE_FUNCTION
+    int numStencilBins( const int cell ) const
+    {
+        return _stencil_counts( cell );
+    }
+
+    //! Get a neighbor bin of a bin from the stencil table.
+    KOKKOS_INLINE_FUNCTION
+    int stencilBin( const int cell, const int n ) const
+    {
+        return _stencil_table( cell, n );
+    }
+
     /*!
       \brief Get a candidate neighbor particle at a given binned offset.
       \param offset Particle offset in the binned layout.
@@ -623,6 +921,13 @@ class LinkedCellList
     bool _sorted;
     CountView _particle_bins;
 
+    // Calls since the last exact rebuild in relaxed mode.
+    int _relaxed_step = 0;
+
+    // Optional precomputed per-bin stencil table with periodic wrapping.
+    Kokkos::View<int**, memory_space> _stencil_table;
+    CountView _stencil_counts;
+
     void allocate( const int ncell, const int nparticles )
     {
         _counts = CountView(
@@ -700,6 +1005,72 @@ auto createLinkedCellList( PositionType positions, const std::size_t begin,
         neighborhood_radius, cell_size_ratio );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Bin occupancy statistics of a linked cell list.
+*/
+struct LinkedCellStatistics
+{
+    //! Total number of bins.
+    std::size_t num_bin;
+    //! Number of empty bins.
+    std::size_t num_empty_bin;
+    //! Largest bin occupancy.
+    std::size_t max_bin_size;
+    //! Mean particles per bin.
+    double mean_bin_size;
+    //! Occupancy variance across bins.
+    double bin_size_variance;
+};
+
+/*!
+  \brief Compute bin occupancy statistics of a linked cell list on device.
+
+  \param list The list to analyze.
+  \return The statistics.
+*/
+template <class MemorySpace, class Scalar>
+LinkedCellStatistics
+linkedCellStatistics( const LinkedCellList<MemorySpace, Scalar>& list )
+{
+    using execution_space = typename MemorySpace::execution_space;
+
+    LinkedCellStatistics stats;
+    stats.num_bin = list.totalBins();
+
+    auto bin_data = list.binningData();
+    long total = 0;
+    long total_sqr = 0;
+    long empty = 0;
+    int max = 0;
+    Kokkos::parallel_reduce(
+        "Cabana::linkedCellStatistics",
+        Kokkos::RangePolicy<execution_space>( 0, stats.num_bin ),
+        KOKKOS_LAMBDA( const int b, long& t, long& t2, long& e, int& m ) {
+            const long size = bin_data.binSize( b );
+            t += size;
+            t2 += size * size;
+            if ( 0 == size )
+                ++e;
+            if ( size > m )
+                m = size;
+        },
+        total, total_sqr, empty, Kokkos::Max<int>( max ) );
+    Kokkos::fence();
+
+    stats.num_empty_bin = empty;
+    stats.max_bin_size = max;
+    stats.mean_bin_size =
+        stats.num_bin > 0 ? static_cast<double>( total ) / stats.num_bin
+                          : 0.0;
+    stats.bin_size_variance =
+        stats.num_bin > 0
+            ? static_cast<double>( total_sqr ) / stats.num_bin -
+                  stats.mean_bin_size * stats.mean_bin_size
+            : 0.0;
+    return stats;
+}
+
 //---------------------------------------------------------------------------//
 //! \cond Impl
 template <typename>
@@ -0,0 +1,116 @@
+/****************************************************************************
+ * Copyright (c) 2018-2023 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_MemoryTracker.hpp
+  \brief Subsystem-labeled device memory accounting
+*/
+#ifndef CABANA_MEMORYTRACKER_HPP
+#define CABANA_MEMORYTRACKER_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <string>
+
+namespace Cabana
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Opt-in tracker of live and high-water memory usage per Cabana
+  subsystem.
+
+  Container growth paths (AoSoA blocks, communication buffers, neighbor
+  list rows) report their allocations and releases with a subsystem label
+  when tracking is enabled, so an out-of-memory inside a migration can be
+  attributed to the subsystem that owns the bytes. Tracking covers
+  reallocation events: storage released by destroying a whole container is
+  not observed, so treat live counts as the usage of containers still in
+  their growth cycle and high-water marks as the reliable signal.
+  Disabled by default and free when off.
+*/
+class MemoryTracker
+{
+  public:
+    //! Usage of one subsystem.
+    struct Usage
+    {
+        //! Currently tracked bytes.
+        std::ptrdiff_t live = 0;
+        //! Largest tracked byte count observed.
+        std::size_t high_water = 0;
+    };
+
+    //! Get the process-wide tracker.
+    static MemoryTracker& instance()
+    {
+        static MemoryTracker tracker;
+        return tracker;
+    }
+
+    //! Enable or disable tracking.
+    void enable( const bool enabled ) { _enabled = enabled; }
+
+    //! Whether tracking is enabled.
+    bool enabled() const { return _enabled; }
+
+    //! Record an allocation in a subsystem.
+    void allocate( const std::string& subsystem, const std::size_t bytes )
+    {
+        if ( !_enabled )
+            return;
+        auto& usage = _usage[subsystem];
+        usage.live += bytes;
+        if ( usage.live > 0 &&
+             static_cast<std::size_t>( usage.live ) > usage.high_water )
+            usage.high_water = usage.live;
+    }
+
+    //! Record a release in a subsystem.
+    void deallocate( const std::string& subsystem, const std::size_t bytes )
+    {
+        if ( !_enabled )
+            return;
+        _usage[subsystem].live -= bytes;
+    }
+
+    //! Get the usage of a subsystem.
+    Usage usage( const std::string& subsystem ) const
+    {
+        auto entry = _usage.find( subsystem );
+        return ( entry != _usage.end() ) ? entry->second : Usage{};
+    }
+
+    //! Discard all tracked usage.
+    void reset() { _usage.clear(); }
+
+    //! Print the per-subsystem live and high-water usage.
+    void report( std::ostream& out = std::cout ) const
+    {
+        out << "Cabana memory report\n"
+            << "subsystem  live_bytes  high_water_bytes\n";
+        for ( const auto& entry : _usage )
+            out << entry.first << "  " << entry.second.live << "  "
+                << entry.second.high_water << "\n";
+    }
+
+  private:
+    MemoryTracker() = default;
+
+    bool _enabled = false;
+    std::map<std::string, Usage> _usage;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_MEMORYTRACKER_HPP
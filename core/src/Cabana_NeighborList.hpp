@@ -171,6 +171,129 @@ maxNeighbor( const ListType& list, const std::size_t num_particles )
 }
 } // namespace Impl
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Dense all-pairs neighbor list with no materialized storage.
+
+  \tparam MemorySpace Kokkos memory space.
+  \tparam AlgorithmTag Tag indicating whether to traverse full or half
+  pair sets.
+
+  Every particle is a candidate neighbor of every other, enumerated
+  arithmetically through the NeighborList interface with no list build and
+  no memory traffic for neighbor indices. For systems or cell clusters
+  under a few thousand particles the tiled O(N^2) traversal this enables is
+  faster than Verlet list construction plus sparse traversal. Distance
+  filtering is the kernel's job since candidates are unfiltered.
+*/
+template <class MemorySpace, class AlgorithmTag>
+struct DenseAllPairs
+{
+    //! Kokkos memory space.
+    using memory_space = MemorySpace;
+    //! The number of particles.
+    std::size_t num_particle;
+};
+
+/*!
+  \brief Create a dense all-pairs neighbor list.
+  \param num_particle The number of particles.
+  \return DenseAllPairs usable with every neighbor_parallel_for pattern.
+*/
+template <class MemorySpace, class AlgorithmTag>
+auto createDenseAllPairs( const std::size_t num_particle, AlgorithmTag )
+{
+    return DenseAllPairs<MemorySpace, AlgorithmTag>{ num_particle };
+}
+
+//! Full dense all-pairs NeighborList interface.
+template <class MemorySpace>
+class NeighborList<DenseAllPairs<MemorySpace, FullNeighborTag>>
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = MemorySpace;
+    //! Neighbor list type.
+    using list_type = DenseAllPairs<MemorySpace, FullNeighborTag>;
+
+    //! Get the total number of neighbors across all particles.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t totalNeighbor( const list_type& list )
+    {
+        return list.num_particle * ( list.num_particle - 1 );
+    }
+
+    //! Get the maximum number of neighbors per particle.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t maxNeighbor( const list_type& list )
+    {
+        return list.num_particle - 1;
+    }
+
+    //! Get the number of neighbors for a given particle index.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t numNeighbor( const list_type& list, const std::size_t )
+    {
+        return list.num_particle - 1;
+    }
+
+    //! Get the id for a neighbor for a given particle index and the index of
+    //! the neighbor relative to the particle.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t getNeighbor( const list_type&,
+                                    const std::size_t particle_index,
+                                    const std::size_t neighbor_index )
+    {
+        // Skip over self.
+        return ( neighbor_index < particle_index ) ? neighbor_index
+                                                   : neighbor_index + 1;
+    }
+};
+
+//! Half dense all-pairs NeighborList interface.
+template <class MemorySpace>
+class NeighborList<DenseAllPairs<MemorySpace, HalfNeighborTag>>
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = MemorySpace;
+    //! Neighbor list type.
+    using list_type = DenseAllPairs<MemorySpace, HalfNeighborTag>;
+
+    //! Get the total number of neighbors across all particles.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t totalNeighbor( const list_type& list )
+    {
+        return list.num_particle * ( list.num_particle - 1 ) / 2;
+    }
+
+    //! Get the maximum number of neighbors per particle.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t maxNeighbor( const list_type& list )
+    {
+        return list.num_particle - 1;
+    }
+
+    //! Get the number of neighbors for a given particle index.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t numNeighbor( const list_type& list,
+                                    const std::size_t particle_index )
+    {
+        return list.num_particle - 1 - particle_index;
+    }
+
+    //! Get the id for a neighbor for a given particle index and the index of
+    //! the neighbor relative to the particle.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t getNeighbor( const list_type&,
+                                    const std::size_t particle_index,
+                                    const std::size_t neighbor_index )
+    {
+        return particle_index + 1 + neighbor_index;
+    }
+};
+
+
 /*!
   \brief Construct a histogram of neighbors per particle.
   \param exec_space Kokkos execution space.
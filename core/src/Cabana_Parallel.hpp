@@ -16,8 +16,10 @@
 #ifndef CABANA_PARALLEL_HPP
 #define CABANA_PARALLEL_HPP
 
+#include <Cabana_Algorithms.hpp>
 #include <Cabana_ExecutionPolicy.hpp>
 #include <Cabana_LinkedCellList.hpp>
+#include <Cabana_ParameterPack.hpp>
 #include <Cabana_NeighborList.hpp>
 #include <Cabana_Types.hpp> // is_accessible_from
 #include <impl/Cabana_CartesianGrid.hpp>
@@ -25,14 +27,38 @@
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Profiling_ScopedRegion.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 namespace Cabana
 {
 //---------------------------------------------------------------------------//
 namespace Impl
 {
+//! \cond Impl
+// Predicate selecting occupied linked cell list bins.
+template <class LinkedCellType>
+struct OccupiedBinPredicate
+{
+    LinkedCellType list;
+
+    KOKKOS_INLINE_FUNCTION
+    bool operator()( const int cell ) const
+    {
+        int i, j, k;
+        list.ijkBinIndex( cell, i, j, k );
+        return list.binSize( i, j, k ) > 0;
+    }
+};
+//! \endcond
+
 //! \cond Impl
 
 // No work tag was provided so call without a tag argument.
@@ -211,6 +237,23 @@ class TeamVectorOpTag
 {
 };
 
+//! Neighbor operations are executed in conflict-free colored cell batches.
+class ColorOpTag
+{
+};
+
+//! Neighbor operations are executed over particles ordered by neighbor
+//! count.
+class CountSortedOpTag
+{
+};
+
+//! Neighbor operations are executed with team parallelism over linked cell
+//! bins with candidate neighbor positions staged in team scratch.
+class TeamScratchOpTag
+{
+};
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Execute functor in parallel according to the execution policy over
@@ -292,6 +335,94 @@ inline void neighbor_parallel_for(
         Kokkos::parallel_for( str, linear_exec_policy, neigh_func );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute functor in parallel over particles ordered by neighbor
+  count with a thread-local serial loop over particle first neighbors.
+
+  \tparam FunctorType The functor type to execute.
+  \tparam NeighborListType The neighbor list type.
+  \tparam ExecParams The Kokkos range policy parameters.
+
+  \param exec_policy The policy over which to execute the functor.
+  \param functor The functor to execute in parallel.
+  \param list The neighbor list over which to execute the neighbor
+  operations.
+  \note FirstNeighborsTag Tag indicating operations over particle first
+  neighbors.
+  \note CountSortedOpTag Tag indicating neighbor-count-ordered scheduling.
+  \param str Optional name for the functor. Will be forwarded if non-empty
+  to the Kokkos::parallel_for called by this code and can be used for
+  identification and profiling purposes.
+
+  The particles are binned by their neighbor count and the flat dispatch
+  runs in that order, so adjacent work items - and therefore the lanes of a
+  warp - carry similar amounts of work. For polydisperse systems whose
+  neighbor counts vary by orders of magnitude this recovers the occupancy a
+  flat dispatch in particle order loses to divergent loop trip counts. The
+  binning costs one count sweep and a sort per call, so it pays off for
+  expensive pair kernels.
+*/
+template <class FunctorType, class NeighborListType, class... ExecParameters>
+inline void neighbor_parallel_for(
+    const Kokkos::RangePolicy<ExecParameters...>& exec_policy,
+    const FunctorType& functor, const NeighborListType& list,
+    const FirstNeighborsTag, const CountSortedOpTag,
+    const std::string& str = "",
+    typename std::enable_if<( !is_linked_cell_list<NeighborListType>::value ),
+                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::neighbor_parallel_for" );
+
+    using work_tag = typename Kokkos::RangePolicy<ExecParameters...>::work_tag;
+
+    using execution_space =
+        typename Kokkos::RangePolicy<ExecParameters...>::execution_space;
+
+    using index_type =
+        typename Kokkos::RangePolicy<ExecParameters...>::index_type;
+
+    using neighbor_list_traits = NeighborList<NeighborListType>;
+
+    using memory_space = typename neighbor_list_traits::memory_space;
+
+    static_assert( is_accessible_from<memory_space, execution_space>{}, "" );
+
+    auto begin = exec_policy.begin();
+    auto end = exec_policy.end();
+
+    // Bin the particles by neighbor count.
+    Kokkos::View<int*, memory_space> counts(
+        Kokkos::ViewAllocateWithoutInitializing( "neighbor_counts" ),
+        end - begin );
+    Kokkos::parallel_for(
+        "Cabana::neighbor_parallel_for::count",
+        Kokkos::RangePolicy<execution_space>( begin, end ),
+        KOKKOS_LAMBDA( const index_type i ) {
+            counts( i - begin ) = neighbor_list_traits::numNeighbor( list, i );
+        } );
+    Kokkos::fence();
+    auto bin_data = sortByKey( counts );
+
+    // Dispatch in count-sorted order.
+    auto neigh_func = KOKKOS_LAMBDA( const index_type k )
+    {
+        const index_type i = begin + bin_data.permutation( k );
+        for ( index_type n = 0;
+              n < neighbor_list_traits::numNeighbor( list, i ); ++n )
+            Impl::functorTagDispatch<work_tag>(
+                functor, i,
+                static_cast<index_type>(
+                    neighbor_list_traits::getNeighbor( list, i, n ) ) );
+    };
+    using linear_policy_type = Kokkos::RangePolicy<execution_space, void, void>;
+    linear_policy_type linear_exec_policy( 0, end - begin );
+    if ( str.empty() )
+        Kokkos::parallel_for( linear_exec_policy, neigh_func );
+    else
+        Kokkos::parallel_for( str, linear_exec_policy, neigh_func );
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Execute functor in parallel according to the execution policy over
@@ -593,9 +724,192 @@ inline void neighbor_parallel_for(
         Kokkos::parallel_for( str, team_policy, neigh_func );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute functor in parallel over particle first neighbors with a
+  team-cooperative cutoff pre-filter compacting surviving pairs before the
+  force computation.
+
+  \tparam FunctorType The functor type to execute.
+  \tparam NeighborListType The neighbor list type.
+  \tparam PositionType Type for positions.
+  \tparam ExecParams The Kokkos range policy parameters.
+
+  \param exec_policy The policy over which to execute the functor.
+  \param functor The functor to execute in parallel.
+  \param list The neighbor list over which to execute the neighbor
+  operations.
+  \param positions Particle positions for the cutoff pre-filter.
+  \param cutoff Interaction cutoff. Pairs beyond it never reach the
+  functor.
+  \note FirstNeighborsTag Tag indicating operations over particle first
+  neighbors.
+  \note TeamVectorOpTag Tag indicating team-vector parallelism.
+  \param str Optional name for the functor.
+
+  With a Verlet skin a large fraction of stored pairs is outside the force
+  cutoff, leaving divergent lanes idle through the expensive force math.
+  The team's vector lanes first evaluate the cheap distance predicate and
+  compact surviving neighbor indices into team scratch - the portable
+  expression of a warp ballot plus compaction - and the force functor then
+  runs over the dense survivor list with every lane doing useful work.
+*/
+template <class FunctorType, class NeighborListType, class PositionType,
+          class... ExecParameters>
+inline void neighbor_parallel_for(
+    const Kokkos::RangePolicy<ExecParameters...>& exec_policy,
+    const FunctorType& functor, const NeighborListType& list,
+    const FirstNeighborsTag, const TeamVectorOpTag, PositionType positions,
+    const typename PositionType::value_type cutoff,
+    const std::string& str = "",
+    typename std::enable_if<( !is_linked_cell_list<NeighborListType>::value ),
+                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::neighbor_parallel_for" );
+
+    using work_tag = typename Kokkos::RangePolicy<ExecParameters...>::work_tag;
+    using execution_space =
+        typename Kokkos::RangePolicy<ExecParameters...>::execution_space;
+
+    using kokkos_policy =
+        Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
+
+    using index_type = typename kokkos_policy::index_type;
+    using neighbor_list_traits = NeighborList<NeighborListType>;
+    using memory_space = typename neighbor_list_traits::memory_space;
+    static_assert( is_accessible_from<memory_space, execution_space>{}, "" );
+
+    // Size the survivor scratch from the largest neighbor count.
+    index_type max_neighbor = 0;
+    const auto range_begin = exec_policy.begin();
+    const auto range_end = exec_policy.end();
+    Kokkos::parallel_reduce(
+        "Cabana::neighbor_parallel_for::max_neighbor",
+        Kokkos::RangePolicy<execution_space>( range_begin, range_end ),
+        KOKKOS_LAMBDA( const index_type i, index_type& value ) {
+            const index_type nn = neighbor_list_traits::numNeighbor( list, i );
+            if ( nn > value )
+                value = nn;
+        },
+        Kokkos::Max<index_type>( max_neighbor ) );
+    Kokkos::fence();
+
+    using scratch_index_type =
+        Kokkos::View<index_type*,
+                     typename execution_space::scratch_memory_space,
+                     Kokkos::MemoryUnmanaged>;
+    using scratch_count_type =
+        Kokkos::View<int, typename execution_space::scratch_memory_space,
+                     Kokkos::MemoryUnmanaged>;
+    std::size_t scratch_size = scratch_index_type::shmem_size( max_neighbor ) +
+                               scratch_count_type::shmem_size();
+    kokkos_policy team_policy( range_end - range_begin, Kokkos::AUTO );
+    team_policy =
+        team_policy.set_scratch_size( 0, Kokkos::PerTeam( scratch_size ) );
+
+    const auto c2 = cutoff * cutoff;
+    auto neigh_func =
+        KOKKOS_LAMBDA( const typename kokkos_policy::member_type& team )
+    {
+        index_type i = team.league_rank() + range_begin;
+
+        // Ballot-and-compact: lanes evaluate the cheap distance predicate
+        // and pack surviving neighbor ids densely into scratch.
+        scratch_index_type survivors( team.team_scratch( 0 ), max_neighbor );
+        scratch_count_type num_survivor( team.team_scratch( 0 ) );
+        Kokkos::single( Kokkos::PerTeam( team ),
+                        [&]() { num_survivor() = 0; } );
+        team.team_barrier();
+
+        const index_type nn = neighbor_list_traits::numNeighbor( list, i );
+        Kokkos::parallel_for(
+            Kokkos::TeamVectorRange( team, nn ),
+            [&]( const index_type n )
+            {
+                const index_type j =
+                    neighbor_list_traits::getNeighbor( list, i, n );
+                const auto dx = positions( i, 0 ) - positions( j, 0 );
+                const auto dy = positions( i, 1 ) - positions( j, 1 );
+                const auto dz = positions( i, 2 ) - positions( j, 2 );
+                if ( dx * dx + dy * dy + dz * dz <= c2 )
+                {
+                    const int w =
+                        Kokkos::atomic_fetch_add( &num_survivor(), 1 );
+                    survivors( w ) = j;
+                }
+            } );
+        team.team_barrier();
+
+        // Dense force pass: every lane holds an interacting pair.
+        Kokkos::parallel_for(
+            Kokkos::TeamVectorRange( team, num_survivor() ),
+            [&]( const index_type n ) {
+                Impl::functorTagDispatch<work_tag>( functor, i,
+                                                    survivors( n ) );
+            } );
+    };
+    if ( str.empty() )
+        Kokkos::parallel_for( team_policy, neigh_func );
+    else
+        Kokkos::parallel_for( str, team_policy, neigh_func );
+}
+
 //---------------------------------------------------------------------------//
 // Neighbor Parallel Reduce
 //---------------------------------------------------------------------------//
+/*!
+  \brief Fixed-size multi-value reduction type for neighbor reductions.
+
+  \tparam T Scalar value type.
+  \tparam N Number of reduced components.
+
+  Usable as the reduce value of neighbor_parallel_reduce so several
+  quantities accumulate in a single neighbor traversal. Combined with a
+  functor that also scatters per-particle results, this fuses what would
+  otherwise be separate neighbor_parallel_for and neighbor_parallel_reduce
+  sweeps - e.g. forces plus energy and the six virial components in one pass
+  over the list.
+*/
+template <class T, int N>
+struct ReduceArray
+{
+    //! Reduced component values.
+    T values[N];
+
+    //! Zero-initializing constructor (also the reduction identity).
+    KOKKOS_INLINE_FUNCTION
+    ReduceArray()
+    {
+        for ( int d = 0; d < N; ++d )
+            values[d] = T( 0 );
+    }
+
+    //! Implicit construction from a scalar, broadcast to all components.
+    KOKKOS_INLINE_FUNCTION
+    ReduceArray( const T value )
+    {
+        for ( int d = 0; d < N; ++d )
+            values[d] = value;
+    }
+
+    //! Access a reduced component.
+    KOKKOS_INLINE_FUNCTION
+    T& operator[]( const int d ) { return values[d]; }
+
+    //! Access a reduced component.
+    KOKKOS_INLINE_FUNCTION
+    const T& operator[]( const int d ) const { return values[d]; }
+
+    //! Component-wise sum.
+    KOKKOS_INLINE_FUNCTION
+    ReduceArray& operator+=( const ReduceArray& rhs )
+    {
+        for ( int d = 0; d < N; ++d )
+            values[d] += rhs.values[d];
+        return *this;
+    }
+};
+
 /*!
   \brief Execute functor reduction in parallel according to the execution policy
   over particles with a thread-local serial loop over particle first neighbors.
@@ -1463,6 +1777,436 @@ inline void neighbor_parallel_for(
         lcl_par( str, team_policy, functor, list, exec_policy.begin() );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute a half-pair functor in parallel in conflict-free colored
+  cell batches over a linked cell list.
+
+  \tparam FunctorType The functor type to execute.
+  \tparam LinkedCellType The linked cell list type.
+  \tparam ExecParams The Kokkos range policy parameters.
+
+  \param exec_policy The policy over which to execute the functor. Must span
+  the binned range of the list.
+  \param functor The functor to execute in parallel.
+  \param list The linked cell list over which to execute neighbor operations.
+  \note FirstNeighborsTag Tag indicating operations over particle first
+  neighbors.
+  \note ColorOpTag Tag indicating conflict-free colored cell scheduling.
+  \param str Optional name for the functor. Will be forwarded if non-empty to
+  the Kokkos::parallel_for called by this code and can be used for
+  identification and profiling purposes.
+
+  The cells are partitioned into colors such that concurrently processed
+  cells are separated by more than the stencil range, and one thread
+  processes all pairs of a cell against its stencil. The functor is called
+  exactly once per candidate pair (i, j) with j > i and may therefore
+  scatter to both particles of the pair without atomics - the Newton's third
+  law work saving of a half list at full write bandwidth.
+*/
+template <class FunctorType, class LinkedCellType, class... ExecParameters>
+inline void neighbor_parallel_for(
+    const Kokkos::RangePolicy<ExecParameters...>& exec_policy,
+    const FunctorType& functor, const LinkedCellType& list,
+    const FirstNeighborsTag, const ColorOpTag, const std::string& str = "",
+    typename std::enable_if<( is_linked_cell_list<LinkedCellType>::value ),
+                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::neighbor_parallel_for" );
+
+    using work_tag = typename Kokkos::RangePolicy<ExecParameters...>::work_tag;
+    using execution_space =
+        typename Kokkos::RangePolicy<ExecParameters...>::execution_space;
+    using index_type =
+        typename Kokkos::RangePolicy<ExecParameters...>::index_type;
+
+    using memory_space = typename LinkedCellType::memory_space;
+    static_assert( is_accessible_from<memory_space, execution_space>{}, "" );
+
+    auto begin = exec_policy.begin();
+    auto end = exec_policy.end();
+    // Cannot iterate over range that was not binned.
+    assert( begin == list.getParticleBegin() );
+    assert( end == list.getParticleEnd() );
+
+    // Concurrently processed cells must be separated by more than the
+    // stencil range so that the particles they touch are disjoint.
+    const int stride = 2 * list.cellStencil().cell_range + 1;
+    const int num_bin_x = list.numBin( 0 );
+    const int num_bin_y = list.numBin( 1 );
+    const int num_bin_z = list.numBin( 2 );
+
+    // Launch one batch per color.
+    for ( int color_i = 0; color_i < stride; ++color_i )
+        for ( int color_j = 0; color_j < stride; ++color_j )
+            for ( int color_k = 0; color_k < stride; ++color_k )
+            {
+                const int nbx = ( num_bin_x - color_i + stride - 1 ) / stride;
+                const int nby = ( num_bin_y - color_j + stride - 1 ) / stride;
+                const int nbz = ( num_bin_z - color_k + stride - 1 ) / stride;
+                if ( nbx <= 0 || nby <= 0 || nbz <= 0 )
+                    continue;
+
+                Kokkos::MDRangePolicy<execution_space, Kokkos::Rank<3>>
+                    color_policy( { 0, 0, 0 }, { nbx, nby, nbz } );
+                auto color_func =
+                    KOKKOS_LAMBDA( const int bi, const int bj, const int bk )
+                {
+                    const int i = color_i + bi * stride;
+                    const int j = color_j + bj * stride;
+                    const int k = color_k + bk * stride;
+
+                    int imin, imax, jmin, jmax, kmin, kmax;
+                    list.getStencilCells( list.cardinalBinIndex( i, j, k ),
+                                          imin, imax, jmin, jmax, kmin, kmax );
+
+                    const std::size_t offset = list.binOffset( i, j, k );
+                    const int size = list.binSize( i, j, k );
+                    for ( int a = 0; a < size; ++a )
+                    {
+                        const index_type pid = list.getParticle( offset + a );
+                        if ( pid < static_cast<index_type>( begin ) ||
+                             pid >= static_cast<index_type>( end ) )
+                            continue;
+
+                        // Loop over the cell stencil and emit each candidate
+                        // pair once.
+                        for ( int si = imin; si < imax; ++si )
+                            for ( int sj = jmin; sj < jmax; ++sj )
+                                for ( int sk = kmin; sk < kmax; ++sk )
+                                {
+                                    const std::size_t n_offset =
+                                        list.binOffset( si, sj, sk );
+                                    const int num_n =
+                                        list.binSize( si, sj, sk );
+                                    for ( int n = 0; n < num_n; ++n )
+                                    {
+                                        const index_type qid =
+                                            list.getParticle( n_offset + n );
+                                        if ( qid > pid )
+                                            Impl::functorTagDispatch<work_tag>(
+                                                functor, pid, qid );
+                                    }
+                                }
+                    }
+                };
+                if ( str.empty() )
+                    Kokkos::parallel_for( color_policy, color_func );
+                else
+                    Kokkos::parallel_for( str, color_policy, color_func );
+                Kokkos::fence();
+            }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute a functor in parallel over linked cell list bins with
+  candidate neighbor positions staged in team scratch.
+
+  \tparam FunctorType The functor type to execute.
+  \tparam LinkedCellType The linked cell list type.
+  \tparam PositionType Type for positions.
+  \tparam ExecParams The Kokkos range policy parameters.
+
+  \param exec_policy The policy over which to execute the functor. Must span
+  the binned range of the list.
+  \param functor The functor to execute in parallel.
+  \param list The linked cell list over which to execute neighbor operations.
+  \param positions Particle positions used to stage candidate coordinates.
+  \note FirstNeighborsTag Tag indicating operations over particle first
+  neighbors.
+  \note TeamScratchOpTag Tag indicating team scratch staging of neighbors.
+  \param str Optional name for the functor. Will be forwarded if non-empty to
+  the Kokkos::parallel_for called by this code and can be used for
+  identification and profiling purposes.
+
+  One team processes one cell: the team cooperatively loads the indices and
+  coordinates of every candidate in the cell stencil into scratch once, then
+  the central particles of the cell iterate against the staged data. Because
+  particles in a bin share most of their candidates this converts repeated
+  global position reads into scratch reads, raising the arithmetic intensity
+  of otherwise bandwidth-bound pair kernels. The functor must have the
+  signature
+
+  \code
+  void operator()( const int i, const int j,
+                   const double x_j, const double y_j, const double z_j );
+  \endcode
+
+  where the trailing coordinates are the staged position of candidate j.
+*/
+template <class FunctorType, class LinkedCellType, class PositionType,
+          class... ExecParameters>
+inline void neighbor_parallel_for(
+    const Kokkos::RangePolicy<ExecParameters...>& exec_policy,
+    const FunctorType& functor, const LinkedCellType& list,
+    PositionType positions, const FirstNeighborsTag, const TeamScratchOpTag,
+    const std::string& str = "",
+    typename std::enable_if<( is_linked_cell_list<LinkedCellType>::value ),
+                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::neighbor_parallel_for" );
+
+    using work_tag = typename Kokkos::RangePolicy<ExecParameters...>::work_tag;
+    using execution_space =
+        typename Kokkos::RangePolicy<ExecParameters...>::execution_space;
+    using index_type =
+        typename Kokkos::RangePolicy<ExecParameters...>::index_type;
+
+    using memory_space = typename LinkedCellType::memory_space;
+    static_assert( is_accessible_from<memory_space, execution_space>{}, "" );
+
+    auto begin = exec_policy.begin();
+    auto end = exec_policy.end();
+    // Cannot iterate over range that was not binned.
+    assert( begin == list.getParticleBegin() );
+    assert( end == list.getParticleEnd() );
+
+    // Find the largest number of stencil candidates of any cell to size the
+    // team scratch.
+    int max_candidates = 0;
+    Kokkos::parallel_reduce(
+        "Cabana::neighbor_parallel_for::max_candidates",
+        Kokkos::RangePolicy<execution_space>( 0, list.totalBins() ),
+        KOKKOS_LAMBDA( const int cell, int& value ) {
+            int imin, imax, jmin, jmax, kmin, kmax;
+            list.getStencilCells( cell, imin, imax, jmin, jmax, kmin, kmax );
+            int candidates = 0;
+            for ( int i = imin; i < imax; ++i )
+                for ( int j = jmin; j < jmax; ++j )
+                    for ( int k = kmin; k < kmax; ++k )
+                        candidates += list.binSize( i, j, k );
+            if ( candidates > value )
+                value = candidates;
+        },
+        Kokkos::Max<int>( max_candidates ) );
+    Kokkos::fence();
+
+    using team_policy_type =
+        Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
+    using scratch_position_type =
+        Kokkos::View<double* [3],
+                     typename execution_space::scratch_memory_space,
+                     Kokkos::MemoryUnmanaged>;
+    using scratch_index_type =
+        Kokkos::View<index_type*,
+                     typename execution_space::scratch_memory_space,
+                     Kokkos::MemoryUnmanaged>;
+    std::size_t scratch_size =
+        scratch_position_type::shmem_size( max_candidates ) +
+        scratch_index_type::shmem_size( max_candidates );
+    team_policy_type team_policy( list.totalBins(), Kokkos::AUTO );
+    team_policy =
+        team_policy.set_scratch_size( 0, Kokkos::PerTeam( scratch_size ) );
+
+    auto neigh_func =
+        KOKKOS_LAMBDA( const typename team_policy_type::member_type& team )
+    {
+        int cell = team.league_rank();
+
+        int imin, imax, jmin, jmax, kmin, kmax;
+        list.getStencilCells( cell, imin, imax, jmin, jmax, kmin, kmax );
+
+        // Cooperatively stage the stencil candidates.
+        scratch_position_type x_n( team.team_scratch( 0 ), max_candidates );
+        scratch_index_type id_n( team.team_scratch( 0 ), max_candidates );
+        int num_candidates = 0;
+        for ( int i = imin; i < imax; ++i )
+            for ( int j = jmin; j < jmax; ++j )
+                for ( int k = kmin; k < kmax; ++k )
+                {
+                    const std::size_t n_offset = list.binOffset( i, j, k );
+                    const int num_n = list.binSize( i, j, k );
+                    Kokkos::parallel_for(
+                        Kokkos::TeamThreadRange( team, num_n ),
+                        [&]( const int n )
+                        {
+                            const index_type nid =
+                                list.getParticle( n_offset + n );
+                            id_n( num_candidates + n ) = nid;
+                            x_n( num_candidates + n, 0 ) = positions( nid, 0 );
+                            x_n( num_candidates + n, 1 ) = positions( nid, 1 );
+                            x_n( num_candidates + n, 2 ) = positions( nid, 2 );
+                        } );
+                    num_candidates += num_n;
+                }
+        team.team_barrier();
+
+        // Iterate the central particles of the cell against the staged
+        // candidates.
+        int bin_ijk[3];
+        list.ijkBinIndex( cell, bin_ijk[0], bin_ijk[1], bin_ijk[2] );
+        const std::size_t b_offset =
+            list.binOffset( bin_ijk[0], bin_ijk[1], bin_ijk[2] );
+        const int b_size = list.binSize( bin_ijk[0], bin_ijk[1], bin_ijk[2] );
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange( team, b_size ),
+            [&]( const int bi )
+            {
+                const index_type pid = list.getParticle( b_offset + bi );
+                if ( pid < static_cast<index_type>( begin ) ||
+                     pid >= static_cast<index_type>( end ) )
+                    return;
+
+                for ( int n = 0; n < num_candidates; ++n )
+                    Impl::functorTagDispatch<work_tag>(
+                        functor, pid, id_n( n ), x_n( n, 0 ), x_n( n, 1 ),
+                        x_n( n, 2 ) );
+            } );
+    };
+    if ( str.empty() )
+        Kokkos::parallel_for( team_policy, neigh_func );
+    else
+        Kokkos::parallel_for( str, team_policy, neigh_func );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute a functor in parallel with one team per occupied linked
+  cell list bin and the stencil candidates staged in team scratch.
+
+  \tparam ExecutionSpace Kokkos execution space.
+  \tparam FunctorType The functor type to execute. Called as
+  functor( i, j, xj, yj, zj ) for each candidate pair with the staged
+  candidate coordinates, as in the TeamScratchOpTag traversal.
+  \tparam LinkedCellType The linked cell list type.
+  \tparam PositionType Type for positions.
+
+  \param exec_space Kokkos execution space instance.
+  \param functor The functor to execute in parallel.
+  \param list The linked cell list over which to execute neighbor
+  operations.
+  \param positions Particle positions used to stage candidate coordinates.
+  \param str Optional name for the functor.
+
+  Direct cell-list traversal for short-lived configurations where a
+  Verlet list would be discarded next step: no neighbor list is
+  materialized. Empty bins are compacted out of the league up front so
+  sparse systems do not pay a team launch per empty bin, and each team
+  stages its stencil's particles once in scratch for all central
+  particles of the bin. Self pairs (j == i) are skipped; all other
+  candidates are emitted and the functor applies its own cutoff.
+*/
+template <class ExecutionSpace, class FunctorType, class LinkedCellType,
+          class PositionType>
+inline void bin_parallel_for(
+    const ExecutionSpace& exec_space, const FunctorType& functor,
+    const LinkedCellType& list, PositionType positions,
+    const std::string& str = "",
+    typename std::enable_if<( is_linked_cell_list<LinkedCellType>::value ),
+                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::bin_parallel_for" );
+
+    using execution_space = ExecutionSpace;
+    using index_type = typename LinkedCellType::size_type;
+
+    using memory_space = typename LinkedCellType::memory_space;
+    static_assert( is_accessible_from<memory_space, execution_space>{}, "" );
+
+    // Compact the empty bins out of the league.
+    auto occupied_bins = selectIndices<memory_space>(
+        exec_space, Impl::OccupiedBinPredicate<LinkedCellType>{ list },
+        list.totalBins() );
+    const int num_occupied = occupied_bins.extent( 0 );
+    if ( 0 == num_occupied )
+        return;
+
+    // Find the largest number of stencil candidates of any occupied cell
+    // to size the team scratch.
+    int max_candidates = 0;
+    Kokkos::parallel_reduce(
+        "Cabana::bin_parallel_for::max_candidates",
+        Kokkos::RangePolicy<execution_space>( exec_space, 0, num_occupied ),
+        KOKKOS_LAMBDA( const int b, int& value ) {
+            int imin, imax, jmin, jmax, kmin, kmax;
+            list.getStencilCells( occupied_bins( b ), imin, imax, jmin, jmax,
+                                  kmin, kmax );
+            int candidates = 0;
+            for ( int i = imin; i < imax; ++i )
+                for ( int j = jmin; j < jmax; ++j )
+                    for ( int k = kmin; k < kmax; ++k )
+                        candidates += list.binSize( i, j, k );
+            if ( candidates > value )
+                value = candidates;
+        },
+        Kokkos::Max<int>( max_candidates ) );
+    Kokkos::fence();
+
+    using team_policy_type =
+        Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
+    using scratch_position_type =
+        Kokkos::View<double* [3],
+                     typename execution_space::scratch_memory_space,
+                     Kokkos::MemoryUnmanaged>;
+    using scratch_index_type =
+        Kokkos::View<index_type*,
+                     typename execution_space::scratch_memory_space,
+                     Kokkos::MemoryUnmanaged>;
+    std::size_t scratch_size =
+        scratch_position_type::shmem_size( max_candidates ) +
+        scratch_index_type::shmem_size( max_candidates );
+    team_policy_type team_policy( exec_space, num_occupied, Kokkos::AUTO );
+    team_policy =
+        team_policy.set_scratch_size( 0, Kokkos::PerTeam( scratch_size ) );
+
+    auto bin_func =
+        KOKKOS_LAMBDA( const typename team_policy_type::member_type& team )
+    {
+        int cell = occupied_bins( team.league_rank() );
+
+        int imin, imax, jmin, jmax, kmin, kmax;
+        list.getStencilCells( cell, imin, imax, jmin, jmax, kmin, kmax );
+
+        // Cooperatively stage the stencil candidates.
+        scratch_position_type x_n( team.team_scratch( 0 ), max_candidates );
+        scratch_index_type id_n( team.team_scratch( 0 ), max_candidates );
+        int num_candidates = 0;
+        for ( int i = imin; i < imax; ++i )
+            for ( int j = jmin; j < jmax; ++j )
+                for ( int k = kmin; k < kmax; ++k )
+                {
+                    const std::size_t n_offset = list.binOffset( i, j, k );
+                    const int num_n = list.binSize( i, j, k );
+                    Kokkos::parallel_for(
+                        Kokkos::TeamThreadRange( team, num_n ),
+                        [&]( const int n )
+                        {
+                            const index_type nid =
+                                list.getParticle( n_offset + n );
+                            id_n( num_candidates + n ) = nid;
+                            x_n( num_candidates + n, 0 ) = positions( nid, 0 );
+                            x_n( num_candidates + n, 1 ) = positions( nid, 1 );
+                            x_n( num_candidates + n, 2 ) = positions( nid, 2 );
+                        } );
+                    num_candidates += num_n;
+                }
+        team.team_barrier();
+
+        // Iterate the central particles of the cell against the staged
+        // candidates.
+        int bin_ijk[3];
+        list.ijkBinIndex( cell, bin_ijk[0], bin_ijk[1], bin_ijk[2] );
+        const std::size_t b_offset =
+            list.binOffset( bin_ijk[0], bin_ijk[1], bin_ijk[2] );
+        const int b_size = list.binSize( bin_ijk[0], bin_ijk[1], bin_ijk[2] );
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange( team, b_size ),
+            [&]( const int bi )
+            {
+                const index_type pid = list.getParticle( b_offset + bi );
+                for ( int n = 0; n < num_candidates; ++n )
+                    if ( id_n( n ) != pid )
+                        functor( pid, id_n( n ), x_n( n, 0 ), x_n( n, 1 ),
+                                 x_n( n, 2 ) );
+            } );
+    };
+    if ( str.empty() )
+        Kokkos::parallel_for( team_policy, bin_func );
+    else
+        Kokkos::parallel_for( str, team_policy, bin_func );
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Execute functor in parallel according to the execution policy over
@@ -1594,6 +2338,478 @@ inline void neighbor_parallel_reduce(
                  exec_policy.begin() );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Chain of functors applied back-to-back to each index in a single
+  kernel.
+
+  \tparam Functors The chained functor types.
+
+  Passing the chain to one simd_parallel_for fuses what would otherwise be
+  several full sweeps over the same AoSoA (kick, drift, thermostat, ...):
+  every stage runs while the element is resident, so slice data loaded by
+  one stage is served to the next from registers or cache instead of from
+  memory. All stages must share the same index signature.
+*/
+template <class... Functors>
+struct FunctorChain
+{
+    //! The chained functors.
+    ParameterPack<Functors...> functors;
+
+    //! \cond Impl
+    template <std::size_t... I, class... Indices>
+    KOKKOS_FORCEINLINE_FUNCTION void applyImpl( std::index_sequence<I...>,
+                                                Indices... indices ) const
+    {
+        ( Cabana::get<I>( functors )( indices... ), ... );
+    }
+    //! \endcond
+
+    //! Apply every stage to the given indices in order.
+    template <class... Indices>
+    KOKKOS_FORCEINLINE_FUNCTION void operator()( Indices... indices ) const
+    {
+        applyImpl( std::make_index_sequence<sizeof...( Functors )>{},
+                   indices... );
+    }
+};
+
+/*!
+  \brief Create a fused functor chain.
+  \param functors The functors to chain, applied in argument order.
+  \return FunctorChain to pass to simd_parallel_for or parallel dispatch.
+*/
+template <class... Functors>
+auto makeFunctorChain( Functors&&... functors )
+{
+    FunctorChain<std::decay_t<Functors>...> chain{ makeParameterPack(
+        std::forward<Functors>( functors )... ) };
+    return chain;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Auto-tune and persistently cache an integer kernel parameter.
+
+  Micro-benchmarks a registered kernel shape over candidate parameter
+  values (team sizes, tile extents, or - through an application-level
+  compile-time dispatch - vector lengths), picks the fastest, and persists
+  the choice to a cache file keyed by the device and kernel label so
+  subsequent runs skip the measurement entirely. The cache file defaults to
+  "cabana_autotune.cache" in the working directory and can be relocated
+  with the CABANA_AUTOTUNE_CACHE environment variable.
+*/
+class KernelTuner
+{
+  public:
+    /*!
+      \brief Constructor.
+      \param kernel_label Unique label of the kernel shape being tuned.
+    */
+    KernelTuner( const std::string& kernel_label )
+        : _label( kernel_label )
+    {
+    }
+
+    //! Device identity used to key the cache.
+    static std::string deviceKey()
+    {
+        return Kokkos::DefaultExecutionSpace().name() +
+               std::string( "_" ) +
+               std::to_string( Kokkos::DefaultExecutionSpace().concurrency() );
+    }
+
+    /*!
+      \brief Get the tuned parameter, measuring once if not cached.
+
+      \param candidates The candidate parameter values.
+      \param benchmark Callable taking a candidate value and running the
+      kernel shape to completion (including any fence).
+      \return The fastest candidate.
+    */
+    template <class Benchmark>
+    int tune( const std::vector<int>& candidates, Benchmark&& benchmark )
+    {
+        const std::string key = deviceKey() + " " + _label;
+
+        // Check the persistent cache.
+        const std::string cache_name = cacheFileName();
+        {
+            std::ifstream cache( cache_name );
+            std::string device, label;
+            int value;
+            while ( cache >> device >> label >> value )
+                if ( device + " " + label == key )
+                    return value;
+        }
+
+        // Measure each candidate, warming up once.
+        int best = candidates.front();
+        double best_time = -1.0;
+        for ( auto candidate : candidates )
+        {
+            benchmark( candidate );
+            auto start = std::chrono::steady_clock::now();
+            benchmark( candidate );
+            double time = std::chrono::duration<double>(
+                              std::chrono::steady_clock::now() - start )
+                              .count();
+            if ( best_time < 0.0 || time < best_time )
+            {
+                best_time = time;
+                best = candidate;
+            }
+        }
+
+        // Persist the choice.
+        std::ofstream cache( cache_name, std::ios::app );
+        cache << key << " " << best << "\n";
+        return best;
+    }
+
+  private:
+    static std::string cacheFileName()
+    {
+        const char* env = std::getenv( "CABANA_AUTOTUNE_CACHE" );
+        return env ? env : "cabana_autotune.cache";
+    }
+
+    std::string _label;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Replayable pipeline of Cabana operations.
+
+  \tparam ExecutionSpace Kokkos execution space.
+
+  Records a step's sequence of operations once as stages - callables taking
+  the pipeline's execution space instance - and replays them back-to-back
+  on that single instance with one fence at the end. Steps made of many
+  small launches stop paying a synchronization between every operation and
+  the stages queue without host round trips in between. Call invalidate()
+  and re-record when captured sizes change (resize, migration).
+
+  Kokkos Graph can only capture kernels expressed against its builder, not
+  arbitrary library calls, so replay dispatches the recorded stages on the
+  shared instance; the recording API leaves room to move the replay to a
+  single graph launch when that capture becomes expressible.
+*/
+template <class ExecutionSpace>
+class Pipeline
+{
+  public:
+    //! Kokkos execution space.
+    using execution_space = ExecutionSpace;
+
+    //! Construct over an optional execution space instance.
+    Pipeline( const ExecutionSpace& exec_space = ExecutionSpace{} )
+        : _exec_space( exec_space )
+    {
+    }
+
+    /*!
+      \brief Record a pipeline stage.
+      \param stage Callable with signature void( const ExecutionSpace& )
+      that enqueues its kernels on the given instance without fencing.
+    */
+    template <class Stage>
+    void record( Stage&& stage )
+    {
+        _stages.emplace_back( std::forward<Stage>( stage ) );
+    }
+
+    //! Replay all recorded stages on the pipeline instance and fence once.
+    void replay()
+    {
+        Kokkos::Profiling::ScopedRegion region( "Cabana::Pipeline::replay" );
+        for ( auto& stage : _stages )
+            stage( _exec_space );
+        _exec_space.fence();
+    }
+
+    //! Discard the recorded stages, e.g. after a resize or migration.
+    void invalidate() { _stages.clear(); }
+
+    //! Get the number of recorded stages.
+    std::size_t numStages() const { return _stages.size(); }
+
+    //! Get the pipeline execution space instance.
+    ExecutionSpace executionSpace() const { return _exec_space; }
+
+  private:
+    ExecutionSpace _exec_space;
+    std::vector<std::function<void( const ExecutionSpace& )>> _stages;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Dependency-scheduled task pipeline over execution space instances.
+
+  \tparam ExecutionSpace Kokkos execution space.
+
+  Registers Cabana operations (simd_parallel_for bodies, interpolation,
+  halo ops) as tasks with explicit dependencies on earlier tasks -
+  e.g. per-species force pipelines that only meet at P2G/G2P sync points -
+  and runs independent tasks concurrently on partitioned execution space
+  instances. Tasks are scheduled in dependency levels: everything in a
+  level runs concurrently across the instances, and the instances are
+  fenced between levels. Kokkos exposes no portable cross-instance event,
+  so the level fence is the synchronization primitive; tasks that do not
+  depend on each other land in the same level and still overlap.
+*/
+template <class ExecutionSpace>
+class TaskGraph
+{
+  public:
+    //! Kokkos execution space.
+    using execution_space = ExecutionSpace;
+    //! Task callable type.
+    using task_type = std::function<void( const ExecutionSpace& )>;
+
+    /*!
+      \brief Construct with the number of concurrent instances (streams).
+      \param num_instances Number of execution space instances tasks are
+      distributed over within a level.
+    */
+    TaskGraph( const int num_instances = 4 )
+    {
+        _instances = Kokkos::Experimental::partition_space(
+            ExecutionSpace{}, std::vector<int>( num_instances, 1 ) );
+    }
+
+    /*!
+      \brief Register a task.
+      \param task Callable with signature void( const ExecutionSpace& )
+      that enqueues its kernels on the given instance without fencing.
+      \param dependencies Ids of previously added tasks that must complete
+      before this one runs.
+      \return The id of the added task.
+    */
+    int addTask( task_type task, const std::vector<int>& dependencies = {} )
+    {
+        int level = 0;
+        for ( auto dep : dependencies )
+        {
+            if ( dep < 0 || dep >= static_cast<int>( _nodes.size() ) )
+                throw std::logic_error(
+                    "Cabana::TaskGraph: dependency on unknown task" );
+            level = std::max( level, _nodes[dep].level + 1 );
+        }
+        _nodes.push_back( { std::move( task ), level } );
+        return _nodes.size() - 1;
+    }
+
+    //! Get the dependency level of a task.
+    int taskLevel( const int id ) const { return _nodes[id].level; }
+
+    //! Get the number of registered tasks.
+    std::size_t numTasks() const { return _nodes.size(); }
+
+    //! Run all tasks, overlapping independent tasks across instances.
+    void execute()
+    {
+        Kokkos::Profiling::ScopedRegion region( "Cabana::TaskGraph::execute" );
+
+        int max_level = 0;
+        for ( const auto& node : _nodes )
+            max_level = std::max( max_level, node.level );
+
+        for ( int level = 0; level <= max_level; ++level )
+        {
+            std::size_t instance = 0;
+            for ( const auto& node : _nodes )
+                if ( level == node.level )
+                {
+                    node.task( _instances[instance % _instances.size()] );
+                    ++instance;
+                }
+            for ( auto& exec_space : _instances )
+                exec_space.fence();
+        }
+    }
+
+    //! Discard all registered tasks.
+    void clear() { _nodes.clear(); }
+
+  private:
+    struct Node
+    {
+        task_type task;
+        int level;
+    };
+    std::vector<Node> _nodes;
+    std::vector<ExecutionSpace> _instances;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Run a multi-step loop body inside one long-lived kernel launch.
+
+  \tparam ExecutionSpace Kokkos execution space.
+  \tparam FunctorType Step body functor with device signature
+  void( const int step, const int i ).
+
+  \param exec_space Kokkos execution space instance.
+  \param num_elements Number of elements each step iterates.
+  \param num_steps Number of steps to run before returning to the host,
+  e.g. the steps between comm epochs.
+  \param functor The step body.
+  \param label Optional kernel label.
+
+  All steps execute in a single launch with device-side step control:
+  no per-step launch latency, no per-step fence, no host round trips.
+  Kokkos has no portable grid-wide barrier (cooperative launch is a CUDA
+  extension), so the driver runs one team - the largest portable unit
+  with a barrier - and strides it across the elements. That bounds it to
+  small systems where launch overhead dominates compute, which is exactly
+  the regime that motivates it.
+*/
+template <class ExecutionSpace, class FunctorType>
+void persistent_step_parallel_for( const ExecutionSpace& exec_space,
+                                   const int num_elements,
+                                   const int num_steps,
+                                   const FunctorType& functor,
+                                   const std::string& label = "" )
+{
+    std::string play_label =
+        label.empty() ? "Cabana::persistent_step_parallel_for" : label;
+
+    using team_policy = Kokkos::TeamPolicy<ExecutionSpace>;
+    Kokkos::parallel_for(
+        play_label, team_policy( exec_space, 1, Kokkos::AUTO ),
+        KOKKOS_LAMBDA( const typename team_policy::member_type& team ) {
+            for ( int step = 0; step < num_steps; ++step )
+            {
+                Kokkos::parallel_for(
+                    Kokkos::TeamThreadRange( team, num_elements ),
+                    [&]( const int i ) { functor( step, i ); } );
+                team.team_barrier();
+            }
+        } );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Run a multi-step loop body with a device-side stop condition
+  inside one long-lived kernel launch.
+
+  \tparam ExecutionSpace Kokkos execution space.
+  \tparam FunctorType Step body functor with device signature
+  void( const int step, const int i ).
+  \tparam DoneFunctor Convergence check with device signature
+  bool( const int step ), evaluated after each step.
+
+  \param exec_space Kokkos execution space instance.
+  \param num_elements Number of elements each step iterates.
+  \param max_steps Maximum number of steps before control returns to the
+  host.
+  \param functor The step body.
+  \param done The device-side stop condition. Must read only state all
+  threads observe identically after the step barrier.
+  \param label Optional kernel label.
+*/
+template <class ExecutionSpace, class FunctorType, class DoneFunctor>
+void persistent_step_parallel_for( const ExecutionSpace& exec_space,
+                                   const int num_elements,
+                                   const int max_steps,
+                                   const FunctorType& functor,
+                                   const DoneFunctor& done,
+                                   const std::string& label = "" )
+{
+    std::string play_label =
+        label.empty() ? "Cabana::persistent_step_parallel_for" : label;
+
+    using team_policy = Kokkos::TeamPolicy<ExecutionSpace>;
+    Kokkos::parallel_for(
+        play_label, team_policy( exec_space, 1, Kokkos::AUTO ),
+        KOKKOS_LAMBDA( const typename team_policy::member_type& team ) {
+            for ( int step = 0; step < max_steps; ++step )
+            {
+                Kokkos::parallel_for(
+                    Kokkos::TeamThreadRange( team, num_elements ),
+                    [&]( const int i ) { functor( step, i ); } );
+                team.team_barrier();
+                if ( done( step ) )
+                    break;
+            }
+        } );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Run a multi-step neighbor traversal inside one long-lived kernel
+  launch.
+
+  \tparam FunctorType Step body functor with device signature
+  void( const int step, const int i, const int j ) for each
+  particle-neighbor pair.
+  \tparam ListType Neighbor list type.
+
+  \param exec_space Kokkos execution space instance.
+  \param list The neighbor list to traverse each step.
+  \param num_particles Number of particles each step iterates.
+  \param num_steps Number of steps to run before returning to the host.
+  \param functor The step body.
+  \param label Optional kernel label.
+
+  Persistent-kernel form of the first-neighbor serial traversal: each
+  team thread owns a particle range and walks its neighbors in serial, as
+  in neighbor_parallel_for with SerialOpTag. The neighbor list must stay
+  valid for all steps; rebuild and communicate between launches.
+*/
+template <class ExecutionSpace, class FunctorType, class ListType>
+void persistent_neighbor_parallel_for( const ExecutionSpace& exec_space,
+                                       const ListType& list,
+                                       const int num_particles,
+                                       const int num_steps,
+                                       const FunctorType& functor,
+                                       const std::string& label = "" )
+{
+    std::string play_label =
+        label.empty() ? "Cabana::persistent_neighbor_parallel_for" : label;
+
+    using neighbor_list_traits = NeighborList<ListType>;
+
+    using team_policy = Kokkos::TeamPolicy<ExecutionSpace>;
+    Kokkos::parallel_for(
+        play_label, team_policy( exec_space, 1, Kokkos::AUTO ),
+        KOKKOS_LAMBDA( const typename team_policy::member_type& team ) {
+            for ( int step = 0; step < num_steps; ++step )
+            {
+                Kokkos::parallel_for(
+                    Kokkos::TeamThreadRange( team, num_particles ),
+                    [&]( const int i ) {
+                        const int num_neighbor =
+                            neighbor_list_traits::numNeighbor( list, i );
+                        for ( int n = 0; n < num_neighbor; ++n )
+                            functor( step, i,
+                                     static_cast<int>(
+                                         neighbor_list_traits::getNeighbor(
+                                             list, i, n ) ) );
+                    } );
+                team.team_barrier();
+            }
+        } );
+}
+
 } // end namespace Cabana
 
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Kokkos
+{
+// Sum reduction identity for the Cabana multi-value reduction type.
+template <class T, int N>
+struct reduction_identity<Cabana::ReduceArray<T, N>>
+{
+    KOKKOS_FORCEINLINE_FUNCTION static Cabana::ReduceArray<T, N> sum()
+    {
+        return Cabana::ReduceArray<T, N>();
+    }
+};
+} // end namespace Kokkos
+//! \endcond
+
 #endif // end CABANA_PARALLEL_HPP
@@ -21,8 +21,10 @@
 
 #include <Cabana_ParticleList.hpp>
 #include <Cabana_Slice.hpp>
+#include <Cabana_Sort.hpp>
 
 #include <random>
+#include <cstdint>
 #include <type_traits>
 
 namespace Cabana
@@ -139,7 +141,8 @@ int createParticles(
     Kokkos::RangePolicy<ExecutionSpace> exec_policy(
         exec_space, previous_num_particles,
         previous_num_particles + num_particles );
-    Kokkos::parallel_for( exec_policy, random_coord_op );
+    Kokkos::parallel_for( "Cabana::createParticles::random",
+                          exec_policy, random_coord_op );
     Kokkos::fence();
 
     auto count_host =
@@ -232,7 +235,8 @@ void createParticles(
     Kokkos::RangePolicy<ExecutionSpace> exec_policy(
         exec_space, previous_num_particles,
         previous_num_particles + num_particles );
-    Kokkos::parallel_for( exec_policy, random_coord_op );
+    Kokkos::parallel_for( "Cabana::createParticles::random",
+                          exec_policy, random_coord_op );
     Kokkos::fence();
 }
 
@@ -386,6 +390,166 @@ int createParticles( InitRandom tag, const InitFunctor& create_functor,
                             seed );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Stage random particles in an injection buffer given an
+  initialization functor.
+
+  \param exec_space Kokkos execution space.
+  \param create_functor A functor which populates a particle given the
+  logical position of a particle, with the same signature as the
+  createParticles functors. This functor returns true if a particle was
+  created and false if it was not.
+  \param injection_buffer The InjectionBuffer to stage created particles
+  in. The staged particles are committed to the particle list in one
+  batched append by InjectionBuffer::apply().
+  \param num_particles The number of candidate particles to create.
+  \param box_min Array specifying lower corner to create particles within.
+  \param box_max Array specifying upper corner to create particles within.
+  \param seed Optional random seed for generating particles.
+*/
+template <class ExecutionSpace, class InitFunctor, class InjectionBufferType,
+          class ArrayType>
+void injectParticles( InitRandom, ExecutionSpace exec_space,
+                      const InitFunctor& create_functor,
+                      const InjectionBufferType& injection_buffer,
+                      const std::size_t num_particles,
+                      const ArrayType box_min, const ArrayType box_max,
+                      const uint64_t seed = 342343901 )
+{
+    using PoolType = Kokkos::Random_XorShift64_Pool<ExecutionSpace>;
+    using RandomType = Kokkos::Random_XorShift64<ExecutionSpace>;
+    PoolType pool( seed );
+
+    using particle_type = typename InjectionBufferType::particle_type;
+
+    // Copy corners to device accessible arrays.
+    auto kokkos_min = Impl::copyArray( box_min );
+    auto kokkos_max = Impl::copyArray( box_max );
+
+    Kokkos::parallel_for(
+        "Cabana::injectParticles::random",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, num_particles ),
+        KOKKOS_LAMBDA( const int p ) {
+            // Particle coordinate.
+            double px[3];
+            auto gen = pool.get_state();
+            for ( int d = 0; d < 3; ++d )
+                px[d] = Kokkos::rand<RandomType, double>::draw(
+                    gen, kokkos_min[d], kokkos_max[d] );
+            pool.free_state( gen );
+
+            // No volume information, so pass zero.
+            double pv = 0.0;
+
+            // Stage if a particle was created.
+            particle_type particle;
+            if ( create_functor( p, px, pv, particle ) )
+                injection_buffer.stage( particle );
+        } );
+    Kokkos::fence();
+}
+
+//---------------------------------------------------------------------------//
+//! Initialization type tag: deterministic hash-based creation ordered along
+//! a space-filling curve.
+struct InitDeterministic
+{
+};
+
+//! \cond Impl
+namespace Impl
+{
+//! SplitMix64 hash for counter-based deterministic coordinates.
+KOKKOS_INLINE_FUNCTION
+std::uint64_t splitMix64( std::uint64_t x )
+{
+    x += 0x9e3779b97f4a7c15ull;
+    x = ( x ^ ( x >> 30 ) ) * 0xbf58476d1ce4e5b9ull;
+    x = ( x ^ ( x >> 27 ) ) * 0x94d049bb133111ebull;
+    return x ^ ( x >> 31 );
+}
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Initialize particles with deterministic, decomposition-independent
+  coordinates and order them along a space-filling curve.
+
+  \param exec_space Kokkos execution space.
+  \param positions Particle positions slice or view. Must be sized for
+  num_particles.
+  \param num_particles The number of particles this rank creates.
+  \param global_index_offset The global index of this rank's first
+  particle. Ranks creating disjoint index ranges produce the identical
+  global particle set for any rank count.
+  \param box_min Local box minimum used to build the locality ordering.
+  \param box_max Local box maximum.
+  \param global_min Global domain minimum in each dimension.
+  \param global_max Global domain maximum in each dimension.
+  \param seed Deterministic seed.
+
+  Each particle's coordinates derive from a counter-based hash of the seed
+  and its global index, so the global particle set is bitwise reproducible
+  across rank counts (particles landing outside a rank's sub-domain are
+  migrated by the usual grid migration). The created particles are then
+  sorted along Morton cell keys so fresh systems start with
+  post-first-sort memory locality instead of arbitrary creation order.
+*/
+template <class ExecutionSpace, class PositionType, class ArrayType>
+void createParticles(
+    InitDeterministic, ExecutionSpace exec_space, PositionType& positions,
+    const std::size_t num_particles, const std::size_t global_index_offset,
+    const ArrayType box_min, const ArrayType box_max,
+    const ArrayType global_min, const ArrayType global_max,
+    const std::uint64_t seed,
+    typename std::enable_if<( is_slice<PositionType>::value ||
+                              Kokkos::is_view<PositionType>::value ),
+                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region(
+        "Cabana::createParticles::deterministic" );
+
+    auto kokkos_min = Impl::copyArray( global_min );
+    auto kokkos_max = Impl::copyArray( global_max );
+
+    // Hash-based coordinates from the global particle index.
+    Kokkos::parallel_for(
+        "Cabana::createParticles::deterministic",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, num_particles ),
+        KOKKOS_LAMBDA( const std::size_t p ) {
+            const std::uint64_t global_id = global_index_offset + p;
+            for ( int d = 0; d < 3; ++d )
+            {
+                const std::uint64_t hash =
+                    Impl::splitMix64( seed ^ Impl::splitMix64(
+                                                 3 * global_id + d ) );
+                const double unit =
+                    ( hash >> 11 ) * ( 1.0 / 9007199254740992.0 );
+                positions( p, d ) =
+                    kokkos_min[d] + unit * ( kokkos_max[d] - kokkos_min[d] );
+            }
+        } );
+    Kokkos::fence();
+
+    // Order the local particles along the space-filling curve of the local
+    // box so fresh systems have first-sort locality.
+    double grid_delta[3];
+    double local_min[3];
+    double local_max[3];
+    for ( int d = 0; d < 3; ++d )
+    {
+        local_min[d] = box_min[d];
+        local_max[d] = box_max[d];
+        grid_delta[d] = ( local_max[d] - local_min[d] ) / 64.0;
+    }
+    auto keys = createSpaceFillingKeys( MortonKeyTag(), positions, grid_delta,
+                                        local_min, local_max );
+    auto bin_data = sortByKey( keys );
+    permute( bin_data, positions );
+}
+
 } // namespace Cabana
 
 #endif
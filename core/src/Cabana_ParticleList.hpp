@@ -309,6 +309,253 @@ auto createParticleList( const std::string& label,
         FieldTags...>( label );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Staging buffer for batched deferred particle injection.
+
+  \tparam ParticleListType ParticleList type receiving the injected
+  particles.
+
+  Injection events (e.g. an inflow boundary creating particles every step)
+  stage new particles in a fixed-capacity device buffer with a device
+  function instead of resizing the particle list per event. apply() commits
+  all staged particles in one batched append: a single resize (amortized by
+  the AoSoA overallocation slack) and one coalesced tuple copy.
+*/
+template <class ParticleListType>
+class InjectionBuffer
+{
+  public:
+    static_assert( is_particle_list<ParticleListType>::value,
+                   "InjectionBuffer requires a Cabana::ParticleList" );
+
+    //! Kokkos memory space.
+    using memory_space = typename ParticleListType::memory_space;
+    //! Particle tuple type.
+    using tuple_type = typename ParticleListType::tuple_type;
+    //! Single particle type.
+    using particle_type = typename ParticleListType::particle_type;
+
+    /*!
+      \brief Constructor.
+      \param capacity Maximum number of particles staged between applies.
+    */
+    InjectionBuffer( const std::size_t capacity )
+        : _staged( "injection_staged", capacity )
+        , _count( "injection_count" )
+    {
+    }
+
+    //! Get the staging capacity.
+    std::size_t capacity() const { return _staged.extent( 0 ); }
+
+    /*!
+      \brief Stage a particle for injection. Device-callable and
+      thread-safe. Returns false if the buffer is full (the particle is
+      dropped and the caller should grow the buffer and re-inject).
+    */
+    KOKKOS_INLINE_FUNCTION
+    bool stage( const particle_type& particle ) const
+    {
+        auto c = Kokkos::atomic_fetch_add( &_count(), 1 );
+        if ( c >= static_cast<int>( _staged.extent( 0 ) ) )
+            return false;
+        _staged( c ) = particle.tuple();
+        return true;
+    }
+
+    //! Get the number of currently staged particles.
+    std::size_t numStaged() const
+    {
+        auto count_host = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), _count );
+        auto num_staged = static_cast<std::size_t>( count_host() );
+        return ( num_staged < _staged.extent( 0 ) ) ? num_staged
+                                                    : _staged.extent( 0 );
+    }
+
+    /*!
+      \brief Commit all staged particles to the particle list with one
+      resize and one coalesced copy, then clear the buffer.
+      \param exec_space Kokkos execution space.
+      \param particle_list List to append staged particles to.
+      \return Number of particles appended.
+    */
+    template <class ExecutionSpace>
+    std::size_t apply( ExecutionSpace exec_space,
+                       ParticleListType& particle_list ) const
+    {
+        Kokkos::Profiling::ScopedRegion region(
+            "Cabana::InjectionBuffer::apply" );
+
+        auto num_staged = numStaged();
+        if ( 0 == num_staged )
+            return 0;
+
+        auto old_size = particle_list.size();
+        particle_list.resize( old_size + num_staged );
+
+        auto staged = _staged;
+        auto aosoa = particle_list.aosoa();
+        Kokkos::parallel_for(
+            "Cabana::InjectionBuffer::apply",
+            Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, num_staged ),
+            KOKKOS_LAMBDA( const std::size_t p ) {
+                aosoa.setTuple( old_size + p, staged( p ) );
+            } );
+        exec_space.fence();
+
+        clear();
+        return num_staged;
+    }
+
+    /*!
+      \brief Commit all staged particles with the default execution space.
+    */
+    std::size_t apply( ParticleListType& particle_list ) const
+    {
+        return apply( typename memory_space::execution_space{},
+                      particle_list );
+    }
+
+    //! Discard all staged particles.
+    void clear() const { Kokkos::deep_copy( _count, 0 ); }
+
+  private:
+    //! Staged particle tuples.
+    Kokkos::View<tuple_type*, memory_space> _staged;
+    //! Staged particle count.
+    Kokkos::View<int, memory_space> _count;
+};
+
+/*!
+  \brief InjectionBuffer creation function.
+  \param capacity Maximum number of particles staged between applies.
+  \return InjectionBuffer
+*/
+template <class ParticleListType>
+auto createInjectionBuffer( const ParticleListType&,
+                            const std::size_t capacity )
+{
+    return InjectionBuffer<ParticleListType>( capacity );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Particle storage with hot and cold fields in separate AoSoAs.
+
+  \tparam MemorySpace Kokkos memory space.
+  \tparam VectorLength AoSoA vector length.
+
+  One logical particle list backed by two internally managed AoSoAs: hot
+  fields (e.g. position, velocity, force) live in one store and cold fields
+  (diagnostics touched only at dump time) in another, so hot kernels stream
+  only the hot bytes instead of pulling cold data through the cache with
+  every tuple. slice() dispatches on the field tag to whichever store holds
+  it and sizing applies to both stores, preserving the single-list usage
+  model. Communication and compaction must be applied to both underlying
+  lists.
+*/
+template <class MemorySpace, int VectorLength, class HotTraits,
+          class ColdTraits, class ColdMemorySpace = MemorySpace>
+class SplitParticleList;
+
+//! \cond Impl
+template <class MemorySpace, int VectorLength, class... HotTags,
+          class... ColdTags, class ColdMemorySpace>
+class SplitParticleList<MemorySpace, VectorLength, ParticleTraits<HotTags...>,
+                        ParticleTraits<ColdTags...>, ColdMemorySpace>
+{
+  public:
+    //! Kokkos memory space of the hot fields.
+    using memory_space = MemorySpace;
+    //! Kokkos memory space of the cold fields. Defaults to the hot space;
+    //! on tiered-memory nodes (MI300A, Grace-Hopper) place cold diagnostic
+    //! fields in host-attached DDR while hot fields stay in HBM.
+    using cold_memory_space = ColdMemorySpace;
+    //! Hot field storage type.
+    using hot_list_type = ParticleList<MemorySpace, VectorLength, HotTags...>;
+    //! Cold field storage type.
+    using cold_list_type =
+        ParticleList<ColdMemorySpace, VectorLength, ColdTags...>;
+
+    //! Default constructor.
+    SplitParticleList( const std::string& label )
+        : _hot( label + "_hot" )
+        , _cold( label + "_cold" )
+    {
+    }
+
+    //! Get the number of particles in the list.
+    std::size_t size() const { return _hot.size(); }
+
+    //! Resize both stores to hold n particles.
+    void resize( const std::size_t n )
+    {
+        _hot.aosoa().resize( n );
+        _cold.aosoa().resize( n );
+    }
+
+    //! Get the hot field storage.
+    hot_list_type& hotList() { return _hot; }
+    //! Get the hot field storage.
+    const hot_list_type& hotList() const { return _hot; }
+    //! Get the cold field storage.
+    cold_list_type& coldList() { return _cold; }
+    //! Get the cold field storage.
+    const cold_list_type& coldList() const { return _cold; }
+
+    //! Get a slice of a given field from whichever store holds it.
+    template <class FieldTag>
+    auto slice( FieldTag tag ) const
+    {
+        if constexpr ( ( std::is_same<FieldTag, HotTags>::value || ... ) )
+            return _hot.slice( tag );
+        else
+            return _cold.slice( tag );
+    }
+
+  private:
+    hot_list_type _hot;
+    cold_list_type _cold;
+};
+//! \endcond
+
+/*!
+  \brief SplitParticleList creation function.
+  \return SplitParticleList with the given hot and cold fields.
+*/
+template <class MemorySpace, int VectorLength, class... HotTags,
+          class... ColdTags>
+auto createParticleList( const std::string& label,
+                         ParticleTraits<HotTags...>,
+                         ParticleTraits<ColdTags...> )
+{
+    return SplitParticleList<MemorySpace, VectorLength,
+                             ParticleTraits<HotTags...>,
+                             ParticleTraits<ColdTags...>>( label );
+}
+
+/*!
+  \brief Tiered SplitParticleList creation function with distinct hot and
+  cold memory spaces.
+  \return SplitParticleList with hot fields in the hot space and cold
+  fields in the cold space. slice() and sizing work transparently across
+  the tiers; kernels touching cold fields must run in an execution space
+  that can access the cold memory.
+*/
+template <class MemorySpace, class ColdMemorySpace, int VectorLength,
+          class... HotTags, class... ColdTags>
+auto createTieredParticleList( const std::string& label,
+                               ParticleTraits<HotTags...>,
+                               ParticleTraits<ColdTags...> )
+{
+    return SplitParticleList<MemorySpace, VectorLength,
+                             ParticleTraits<HotTags...>,
+                             ParticleTraits<ColdTags...>, ColdMemorySpace>(
+        label );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Cabana
@@ -95,6 +95,103 @@ void remove( const ExecutionSpace& exec_space, const int num_keep,
         particles.shrinkToFit();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Deferred-deletion mask batching particle removal across steps.
+
+  \tparam MemorySpace Kokkos memory space of the particle data.
+
+  Kernels mark particles for removal through the mask; the in-place
+  compaction of remove() only runs once the marked fraction exceeds the
+  configured threshold, so steps that delete a handful of particles pay
+  nothing and the survivors are rewritten once per batch instead of every
+  step.
+*/
+template <class MemorySpace>
+class RemoveMask
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = MemorySpace;
+
+    /*!
+      \brief Constructor.
+      \param num_particles Current number of particles.
+      \param threshold The marked fraction of particles that triggers
+      compaction.
+    */
+    RemoveMask( const std::size_t num_particles,
+                const double threshold = 0.01 )
+        : _keep( Kokkos::ViewAllocateWithoutInitializing( "keep_mask" ),
+                 num_particles )
+        , _threshold( threshold )
+    {
+        Kokkos::deep_copy( _keep, true );
+    }
+
+    //! (Device) Mark a particle for deferred removal.
+    KOKKOS_INLINE_FUNCTION
+    void remove( const std::size_t p ) const { _keep( p ) = false; }
+
+    //! Get the keep mask.
+    auto mask() const { return _keep; }
+
+    //! Count the particles currently marked for removal.
+    template <class ExecutionSpace>
+    std::size_t numMarked( const ExecutionSpace& exec_space ) const
+    {
+        auto keep = _keep;
+        std::size_t marked = 0;
+        Kokkos::parallel_reduce(
+            "Cabana::RemoveMask::numMarked",
+            Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0,
+                                                 _keep.extent( 0 ) ),
+            KOKKOS_LAMBDA( const std::size_t p, std::size_t& count ) {
+                if ( !keep( p ) )
+                    ++count;
+            },
+            marked );
+        Kokkos::fence();
+        return marked;
+    }
+
+    /*!
+      \brief Compact the particles in place if the marked fraction exceeds
+      the threshold.
+      \param exec_space Kokkos execution space.
+      \param particles The AoSoA containing particles. Must be the size the
+      mask was created (or last reset) with.
+      \param shrink_to_fit Whether to remove additional AoSoA capacity when
+      compacting.
+      \return True if a compaction was performed; the mask is then reset to
+      the new particle count.
+    */
+    template <class ExecutionSpace, class ParticleAoSoA>
+    bool compactIfNeeded( const ExecutionSpace& exec_space,
+                          ParticleAoSoA& particles,
+                          const bool shrink_to_fit = false )
+    {
+        const std::size_t marked = numMarked( exec_space );
+        if ( 0 == marked ||
+             marked < _threshold * static_cast<double>( particles.size() ) )
+            return false;
+
+        const int num_keep = particles.size() - marked;
+        Cabana::remove( exec_space, num_keep, _keep, particles, 0,
+                        shrink_to_fit );
+
+        // Reset the mask for the compacted particles.
+        Kokkos::realloc( Kokkos::WithoutInitializing, _keep,
+                         particles.size() );
+        Kokkos::deep_copy( _keep, true );
+        return true;
+    }
+
+  private:
+    Kokkos::View<bool*, memory_space> _keep;
+    double _threshold;
+};
+
 } // end namespace Cabana
 
 #endif // end CABANA_REMOVE_HPP
@@ -31,6 +31,7 @@
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Profiling_ScopedRegion.hpp>
 
+#include <Cabana_DeepCopy.hpp>
 #include <Cabana_Slice.hpp>
 
 #include <silo.h>
@@ -39,9 +40,14 @@
 
 #include <pmpio.h>
 
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <future>
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace Cabana
@@ -501,6 +507,107 @@ void writeTimeStep( const std::string& prefix, MPI_Comm comm,
                                0, coords.size(), coords, fields... );
 }
 
+
+/*!
+  \brief Choose a PMPIO aggregator (file group) count for this communicator.
+  \param comm MPI communicator the dump will use.
+  \return The number of files to write in parallel.
+
+  Defaults to the square root of the communicator size, which balances the
+  number of files against the length of each serialized baton chain. Set the
+  CABANA_SILO_NUM_GROUP environment variable to override with a
+  filesystem-specific tuning (e.g. matched to the number of OSTs).
+*/
+inline int selectAggregatorCount( MPI_Comm comm )
+{
+    int comm_size;
+    MPI_Comm_size( comm, &comm_size );
+
+    const char* env = std::getenv( "CABANA_SILO_NUM_GROUP" );
+    if ( env )
+    {
+        int num_group = std::atoi( env );
+        if ( num_group < 1 )
+            num_group = 1;
+        if ( num_group > comm_size )
+            num_group = comm_size;
+        return num_group;
+    }
+
+    return std::max( 1, static_cast<int>( std::lround(
+                            std::sqrt( static_cast<double>( comm_size ) ) ) ) );
+}
+
+//! \cond Impl
+namespace Impl
+{
+// Run the write over the staged host data with labeled slices.
+template <std::size_t CoordIndex, std::size_t... FieldIndices,
+          class AoSoAType, std::size_t... P>
+void writeStagedTimeStep(
+    const std::string& prefix, MPI_Comm comm, const int num_group,
+    const int time_step_index, const double time, const AoSoAType& host_aosoa,
+    const std::array<std::string, 1 + sizeof...( FieldIndices )>& names,
+    std::index_sequence<P...> )
+{
+    writeTimeStep( prefix, comm, num_group, time_step_index, time,
+                   Cabana::slice<CoordIndex>( host_aosoa, names[0] ),
+                   Cabana::slice<FieldIndices>( host_aosoa,
+                                                names[1 + P] )... );
+}
+} // namespace Impl
+//! \endcond
+
+/*!
+  \brief Asynchronously write Silo particle output: stage the particle data
+  on the host and run the baton chain on a background thread.
+
+  \tparam CoordIndex AoSoA member index of the particle coordinates.
+  \tparam FieldIndices AoSoA member indices of the fields to write.
+
+  \param prefix Filename prefix.
+  \param comm MPI communicator.
+  \param num_group Number of files to create in parallel.
+  \param time_step_index Current simulation step index.
+  \param time Current simulation time.
+  \param aosoa The particle data. Deep-copied into a host staging copy
+  before this function returns.
+  \param names Variable names: the coordinate name first, then one per
+  field index.
+  \return A future that completes when the write has finished.
+
+  The PMPIO baton chain serializes the ranks of a group while the file is
+  written; running it on a std::async thread over the staged host copy
+  returns control to the simulation immediately after the device-to-host
+  copy. The MPI library must be initialized with MPI_THREAD_MULTIPLE and
+  the returned future of one dump must complete before the next dump on the
+  same communicator begins.
+*/
+template <std::size_t CoordIndex, std::size_t... FieldIndices, class AoSoAType>
+std::future<void> writeTimeStepAsync(
+    const std::string& prefix, MPI_Comm comm, const int num_group,
+    const int time_step_index, const double time, const AoSoAType& aosoa,
+    const std::array<std::string, 1 + sizeof...( FieldIndices )>& names )
+{
+    Kokkos::Profiling::ScopedRegion region(
+        "Cabana::SiloParticleOutput::stage" );
+
+    // Stage the particle data on the host.
+    auto host_aosoa =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+
+    // Write on a background thread while the simulation continues.
+    return std::async(
+        std::launch::async,
+        [prefix, comm, num_group, time_step_index, time, host_aosoa, names]()
+        {
+            Impl::writeStagedTimeStep<CoordIndex, FieldIndices...>(
+                prefix, comm, num_group, time_step_index, time, host_aosoa,
+                names,
+                std::make_index_sequence<sizeof...( FieldIndices )>{} );
+        } );
+}
+
 //---------------------------------------------------------------------------//
 
 } // namespace SiloParticleOutput
@@ -1024,6 +1024,571 @@ auto size(
     return view.extent( 0 );
 }
 
+//---------------------------------------------------------------------------//
+//! Reference proxy converting between a narrow storage type and a wide
+//! compute type on load and store.
+template <class ComputeType, class StorageType>
+struct ConvertingReference
+{
+    //! The wrapped storage reference.
+    StorageType& _ref;
+
+    //! Load: widen the stored value to the compute type.
+    KOKKOS_FORCEINLINE_FUNCTION
+    operator ComputeType() const { return static_cast<ComputeType>( _ref ); }
+
+    //! Store: narrow the compute value into storage.
+    KOKKOS_FORCEINLINE_FUNCTION
+    const ConvertingReference& operator=( const ComputeType value ) const
+    {
+        _ref = static_cast<StorageType>( value );
+        return *this;
+    }
+
+    //! Accumulate in the compute type and narrow the result into storage.
+    KOKKOS_FORCEINLINE_FUNCTION
+    const ConvertingReference& operator+=( const ComputeType value ) const
+    {
+        _ref = static_cast<StorageType>( static_cast<ComputeType>( _ref ) +
+                                         value );
+        return *this;
+    }
+};
+
+/*!
+  \brief Slice adaptor splitting the storage type from the compute type.
+
+  \tparam ComputeType The type kernel arithmetic is performed in.
+  \tparam SliceType The wrapped slice type.
+
+  Declare bandwidth-heavy members in a narrow storage type (float or a
+  16-bit float) to cut the AoSoA footprint and wrap their slices with
+  makeConvertingSlice<double>() inside kernels: loads widen to the compute
+  type and stores narrow back, so kernels are written once against the
+  compute type. The conversion happens per access and costs no extra
+  layout.
+*/
+template <class ComputeType, class SliceType>
+struct ConvertingSlice
+{
+    //! Compute value type.
+    using compute_type = ComputeType;
+    //! Wrapped slice type.
+    using slice_type = SliceType;
+
+    //! The wrapped slice.
+    SliceType _slice;
+
+    //! Access a converting reference to the given element.
+    template <class... Indices>
+    KOKKOS_FORCEINLINE_FUNCTION auto operator()( Indices... indices ) const
+    {
+        using storage_type = typename SliceType::value_type;
+        return ConvertingReference<ComputeType, storage_type>{
+            _slice( indices... ) };
+    }
+
+    //! Get the number of particles in the slice.
+    KOKKOS_FORCEINLINE_FUNCTION
+    auto size() const { return _slice.size(); }
+};
+
+/*!
+  \brief Create a converting slice computing in the given type.
+  \return ConvertingSlice over the given slice.
+*/
+template <class ComputeType, class SliceType>
+auto makeConvertingSlice( const SliceType& slice )
+{
+    return ConvertingSlice<ComputeType, SliceType>{ slice };
+}
+
+//---------------------------------------------------------------------------//
+// Access-intent hints for streaming kernels.
+//---------------------------------------------------------------------------//
+/*!
+  \brief Store a value with a non-temporal (streaming) hint.
+
+  \param ptr The destination address.
+  \param value The value to store.
+
+  Streaming kernels that write huge slices they will never re-read can
+  bypass the cache hierarchy on CPU backends, keeping the LLC for data
+  with reuse. Falls back to a plain store where the compiler or
+  architecture offers no non-temporal form (including device code, where
+  the memory system handles streaming).
+*/
+template <class T>
+KOKKOS_FORCEINLINE_FUNCTION void streamStore( T* ptr, const T value )
+{
+#if defined( __clang__ ) && !defined( __CUDA_ARCH__ ) &&                           !defined( __HIP_DEVICE_COMPILE__ )
+    __builtin_nontemporal_store( value, ptr );
+#else
+    *ptr = value;
+#endif
+}
+
+/*!
+  \brief Software-prefetch a slice element's member data for reading.
+
+  \param slice The slice to prefetch from.
+  \param i The element index to prefetch.
+
+  Issue a few iterations ahead of use in CPU streaming loops with
+  irregular access (indexed gathers) so loads overlap computation. A no-op
+  on device code.
+*/
+template <class SliceType>
+KOKKOS_FORCEINLINE_FUNCTION void prefetchRead( const SliceType& slice,
+                                               const std::size_t i )
+{
+#if !defined( __CUDA_ARCH__ ) && !defined( __HIP_DEVICE_COMPILE__ ) &&             ( defined( __GNUC__ ) || defined( __clang__ ) )
+    auto s = SliceType::index_type::s( i );
+    auto a = SliceType::index_type::a( i );
+    __builtin_prefetch( slice.data() + s * slice.stride( 0 ) + a, 0, 0 );
+#else
+    (void)slice;
+    (void)i;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Logical vector slice over several same-typed scalar members.
+
+  \tparam SliceType The underlying slice type.
+  \tparam N The number of combined members.
+
+  Members declared separately (x, y, z as three scalars) read through one
+  vector-style interface: operator()(i, d) dispatches to member d's
+  stream, so kernels written against a double[3]-style interface run
+  unchanged over the separated streams - and vice versa, each component
+  remains an independent contiguous stream for kernels that want it.
+*/
+template <class SliceType, std::size_t N>
+struct MultiSlice
+{
+    //! Underlying slice type.
+    using slice_type = SliceType;
+    //! Number of combined members.
+    static constexpr std::size_t extent = N;
+
+    //! The combined member slices.
+    Kokkos::Array<SliceType, N> slices;
+
+    //! Access component d of element i.
+    KOKKOS_FORCEINLINE_FUNCTION
+    typename SliceType::reference_type operator()( const std::size_t i,
+                                                   const std::size_t d ) const
+    {
+        return slices[d]( i );
+    }
+
+    //! Get the number of elements.
+    KOKKOS_FORCEINLINE_FUNCTION
+    auto size() const { return slices[0].size(); }
+
+    //! Get one component's underlying slice.
+    KOKKOS_FORCEINLINE_FUNCTION
+    const SliceType& component( const std::size_t d ) const
+    {
+        return slices[d];
+    }
+};
+
+/*!
+  \brief Combine several same-typed scalar slices into a logical vector
+  slice.
+  \param slice0 The first component slice.
+  \param slices The remaining component slices.
+  \return MultiSlice over the given components.
+*/
+template <class SliceType, class... SliceTypes>
+auto makeMultiSlice( const SliceType& slice0, const SliceTypes&... slices )
+{
+    static_assert( ( std::is_same<SliceType, SliceTypes>::value && ... ),
+                   "Combined slices must have the same type" );
+    return MultiSlice<SliceType, 1 + sizeof...( SliceTypes )>{
+        { slice0, slices... } };
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Fixed-width value pack for explicit SIMD slice access.
+
+  \tparam T Value type.
+  \tparam Width Number of lanes. Matches the AoSoA vector length when
+  produced by loadPack().
+
+  A pack holds one value per lane in a fixed-size array so elementwise
+  arithmetic compiles to straight-line vector code instead of relying on
+  auto-vectorization through the slice index arithmetic. Kernels written
+  against packs run unchanged for any member type mix.
+*/
+template <class T, int Width>
+struct Pack
+{
+    //! Lane value type.
+    using value_type = T;
+    //! Number of lanes.
+    static constexpr int width = Width;
+
+    //! Lane values.
+    T v[Width];
+
+    //! Uninitialized pack.
+    KOKKOS_DEFAULTED_FUNCTION Pack() = default;
+
+    //! Broadcast a scalar to all lanes.
+    KOKKOS_FORCEINLINE_FUNCTION
+    Pack( const T value )
+    {
+        for ( int l = 0; l < Width; ++l )
+            v[l] = value;
+    }
+
+    //! Access a lane.
+    KOKKOS_FORCEINLINE_FUNCTION
+    T& operator[]( const int l ) { return v[l]; }
+    //! Access a lane.
+    KOKKOS_FORCEINLINE_FUNCTION
+    const T& operator[]( const int l ) const { return v[l]; }
+};
+
+//! \cond Impl
+#define CABANA_PACK_BINARY_OP( op )                                            \
+    template <class T, int Width>                                              \
+    KOKKOS_FORCEINLINE_FUNCTION Pack<T, Width> operator op(                    \
+        const Pack<T, Width>& a, const Pack<T, Width>& b )                     \
+    {                                                                          \
+        Pack<T, Width> result;                                                 \
+        for ( int l = 0; l < Width; ++l )                                      \
+            result.v[l] = a.v[l] op b.v[l];                                    \
+        return result;                                                         \
+    }                                                                          \
+    template <class T, int Width>                                              \
+    KOKKOS_FORCEINLINE_FUNCTION Pack<T, Width> operator op(                    \
+        const Pack<T, Width>& a, const T b )                                   \
+    {                                                                          \
+        Pack<T, Width> result;                                                 \
+        for ( int l = 0; l < Width; ++l )                                      \
+            result.v[l] = a.v[l] op b;                                         \
+        return result;                                                         \
+    }                                                                          \
+    template <class T, int Width>                                              \
+    KOKKOS_FORCEINLINE_FUNCTION Pack<T, Width> operator op(                    \
+        const T a, const Pack<T, Width>& b )                                   \
+    {                                                                          \
+        Pack<T, Width> result;                                                 \
+        for ( int l = 0; l < Width; ++l )                                      \
+            result.v[l] = a op b.v[l];                                         \
+        return result;                                                         \
+    }
+
+CABANA_PACK_BINARY_OP( + )
+CABANA_PACK_BINARY_OP( - )
+CABANA_PACK_BINARY_OP( * )
+CABANA_PACK_BINARY_OP( / )
+
+#undef CABANA_PACK_BINARY_OP
+//! \endcond
+
+/*!
+  \brief Load one full struct of a rank-0 member as a pack.
+
+  \param slice The slice to load from.
+  \param s The struct index.
+  \param num_valid Number of valid lanes (the array size of the struct);
+  masked lanes load zero.
+  \return The loaded pack.
+*/
+template <class SliceType>
+KOKKOS_FORCEINLINE_FUNCTION auto
+loadPack( const SliceType& slice, const int s,
+          const int num_valid = SliceType::vector_length )
+{
+    using value_type = typename SliceType::value_type;
+    constexpr int width = SliceType::vector_length;
+
+    Pack<value_type, width> result;
+    auto slice_data = slice.data();
+    const std::size_t offset = s * slice.stride( 0 );
+    for ( int l = 0; l < width; ++l )
+        result.v[l] =
+            ( l < num_valid ) ? slice_data[offset + l] : value_type( 0 );
+    return result;
+}
+
+/*!
+  \brief Load one component of one full struct of a rank-1 member as a pack.
+
+  \param slice The slice to load from.
+  \param s The struct index.
+  \param d The component index.
+  \param num_valid Number of valid lanes; masked lanes load zero.
+  \return The loaded pack.
+*/
+template <class SliceType>
+KOKKOS_FORCEINLINE_FUNCTION auto
+loadPack( const SliceType& slice, const int s, const int d,
+          const int num_valid )
+{
+    using value_type = typename SliceType::value_type;
+    constexpr int width = SliceType::vector_length;
+
+    Pack<value_type, width> result;
+    auto slice_data = slice.data();
+    const std::size_t offset = s * slice.stride( 0 ) + width * d;
+    for ( int l = 0; l < width; ++l )
+        result.v[l] =
+            ( l < num_valid ) ? slice_data[offset + l] : value_type( 0 );
+    return result;
+}
+
+/*!
+  \brief Store a pack into one full struct of a rank-0 member.
+
+  \param slice The slice to store to.
+  \param pack The pack to store.
+  \param s The struct index.
+  \param num_valid Number of valid lanes; masked lanes are not written.
+*/
+template <class SliceType>
+KOKKOS_FORCEINLINE_FUNCTION void
+storePack( const SliceType& slice,
+           const Pack<typename SliceType::value_type,
+                      SliceType::vector_length>& pack,
+           const int s, const int num_valid = SliceType::vector_length )
+{
+    constexpr int width = SliceType::vector_length;
+    auto slice_data = slice.data();
+    const std::size_t offset = s * slice.stride( 0 );
+    for ( int l = 0; l < width; ++l )
+        if ( l < num_valid )
+            slice_data[offset + l] = pack.v[l];
+}
+
+/*!
+  \brief Store a pack into one component of one full struct of a rank-1
+  member.
+
+  \param slice The slice to store to.
+  \param pack The pack to store.
+  \param s The struct index.
+  \param d The component index.
+  \param num_valid Number of valid lanes; masked lanes are not written.
+*/
+template <class SliceType>
+KOKKOS_FORCEINLINE_FUNCTION void
+storePack( const SliceType& slice,
+           const Pack<typename SliceType::value_type,
+                      SliceType::vector_length>& pack,
+           const int s, const int d, const int num_valid )
+{
+    constexpr int width = SliceType::vector_length;
+    auto slice_data = slice.data();
+    const std::size_t offset = s * slice.stride( 0 ) + width * d;
+    for ( int l = 0; l < width; ++l )
+        if ( l < num_valid )
+            slice_data[offset + l] = pack.v[l];
+}
+
+//---------------------------------------------------------------------------//
+// Team-collective slice staging.
+//---------------------------------------------------------------------------//
+/*!
+  \brief Team-collective load of a slice block into scratch.
+
+  \param team The team member.
+  \param scratch Scratch view indexed as (block element, flattened
+  component). Must hold at least (end - begin) elements.
+  \param slice The slice to load from.
+  \param begin The first slice index of the block.
+  \param end The index past the last slice element of the block.
+
+  The team's lanes cooperatively copy all components of the block. No
+  barrier is issued: the caller places it (or lets the loads overlap
+  following computation, as in teamDoubleBufferedApply).
+*/
+template <class TeamMemberType, class ScratchViewType, class SliceType>
+KOKKOS_INLINE_FUNCTION void
+teamLoadSlice( const TeamMemberType& team, const ScratchViewType& scratch,
+               const SliceType& slice, const std::size_t begin,
+               const std::size_t end )
+{
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < slice.viewRank(); ++d )
+        num_comp *= slice.extent( d );
+
+    auto slice_data = slice.data();
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange( team, end - begin ),
+        [&]( const std::size_t n )
+        {
+            const std::size_t i = begin + n;
+            auto s = SliceType::index_type::s( i );
+            auto a = SliceType::index_type::a( i );
+            const std::size_t offset = s * slice.stride( 0 ) + a;
+            for ( std::size_t c = 0; c < num_comp; ++c )
+                scratch( n, c ) =
+                    slice_data[offset + SliceType::vector_length * c];
+        } );
+}
+
+/*!
+  \brief Team-collective store of a scratch block back to a slice.
+
+  \param team The team member.
+  \param slice The slice to store to.
+  \param scratch Scratch view indexed as (block element, flattened
+  component).
+  \param begin The first slice index of the block.
+  \param end The index past the last slice element of the block.
+
+  No barrier is issued; the caller synchronizes around the store.
+*/
+template <class TeamMemberType, class ScratchViewType, class SliceType>
+KOKKOS_INLINE_FUNCTION void
+teamStoreSlice( const TeamMemberType& team, const SliceType& slice,
+                const ScratchViewType& scratch, const std::size_t begin,
+                const std::size_t end )
+{
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < slice.viewRank(); ++d )
+        num_comp *= slice.extent( d );
+
+    auto slice_data = slice.data();
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange( team, end - begin ),
+        [&]( const std::size_t n )
+        {
+            const std::size_t i = begin + n;
+            auto s = SliceType::index_type::s( i );
+            auto a = SliceType::index_type::a( i );
+            const std::size_t offset = s * slice.stride( 0 ) + a;
+            for ( std::size_t c = 0; c < num_comp; ++c )
+                slice_data[offset + SliceType::vector_length * c] =
+                    scratch( n, c );
+        } );
+}
+
+/*!
+  \brief Iterate a slice range in scratch-staged blocks with software
+  double buffering.
+
+  \param team The team member.
+  \param scratch_a First scratch buffer, (block element, component).
+  \param scratch_b Second scratch buffer of the same shape.
+  \param slice The slice to stage.
+  \param begin The first slice index of the range.
+  \param end The index past the last slice element of the range.
+  \param functor Block consumer with device signature
+  void( const ScratchViewType& block, const std::size_t block_begin,
+  const std::size_t block_size ), called once per staged block.
+
+  The next block's loads are issued before the current block's compute,
+  so the staging latency hides behind the functor work - the hand-coded
+  double-buffer pattern, maintained in one place. The block size is the
+  scratch extent; both buffers must be distinct allocations.
+*/
+template <class TeamMemberType, class ScratchViewType, class SliceType,
+          class FunctorType>
+KOKKOS_INLINE_FUNCTION void
+teamDoubleBufferedApply( const TeamMemberType& team,
+                         const ScratchViewType& scratch_a,
+                         const ScratchViewType& scratch_b,
+                         const SliceType& slice, const std::size_t begin,
+                         const std::size_t end, const FunctorType& functor )
+{
+    const std::size_t block_size = scratch_a.extent( 0 );
+    if ( begin >= end )
+        return;
+
+    // Prologue: stage the first block.
+    const ScratchViewType* buffers[2] = { &scratch_a, &scratch_b };
+    std::size_t block_begin = begin;
+    std::size_t block_end =
+        ( begin + block_size < end ) ? begin + block_size : end;
+    int current = 0;
+    teamLoadSlice( team, *buffers[current], slice, block_begin, block_end );
+    team.team_barrier();
+
+    while ( block_begin < end )
+    {
+        // Issue the next block's loads before computing the current one so
+        // the copy latency overlaps the functor work.
+        const std::size_t next_begin = block_end;
+        const std::size_t next_end =
+            ( block_end + block_size < end ) ? block_end + block_size : end;
+        if ( next_begin < end )
+            teamLoadSlice( team, *buffers[1 - current], slice, next_begin,
+                           next_end );
+
+        functor( *buffers[current], block_begin,
+                 block_end - block_begin );
+        team.team_barrier();
+
+        block_begin = next_begin;
+        block_end = next_end;
+        current = 1 - current;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create an unmanaged slice aliasing an externally-owned view with
+  zero copies.
+
+  \param view The external Kokkos view to alias, indexed as (particle,
+  component...). Must be contiguous with the component dimensions fastest
+  (LayoutRight, or rank-1 for scalar members).
+  \param label An optional label for the slice.
+  \return Slice viewing the external memory.
+
+  Coupled codes hand Cabana their device arrays directly: the returned
+  slice has vector length one and a stride equal to the per-particle
+  component count, which lays out identically to the contiguous external
+  buffer, so every slice-consuming Cabana operation runs on the external
+  memory with no copy. The external allocation must outlive the slice.
+  Aliasing a full AoSoA member is only possible when the external code
+  already stores blocked SoA data; for plain contiguous arrays the slice
+  is the zero-copy interoperability point.
+*/
+template <class ViewType>
+auto makeUnmanagedSlice( const ViewType& view, const std::string& label = "" )
+{
+    static_assert( Kokkos::is_view<ViewType>::value,
+                   "makeUnmanagedSlice requires a Kokkos::View" );
+    static_assert(
+        ViewType::rank == 1 ||
+            std::is_same<typename ViewType::array_layout,
+                         Kokkos::LayoutRight>::value,
+        "External view must be contiguous with components fastest" );
+
+    // The member data type is the view data type without the runtime
+    // particle dimension.
+    using data_type =
+        typename std::remove_pointer<typename ViewType::data_type>::type;
+    using memory_space = typename ViewType::memory_space;
+
+    // One element stride per particle component.
+    constexpr std::size_t stride =
+        sizeof( data_type ) /
+        sizeof( typename std::remove_all_extents<data_type>::type );
+
+    using slice_type = Slice<data_type, memory_space, DefaultAccessMemory, 1,
+                             static_cast<int>( stride )>;
+
+    if ( !view.span_is_contiguous() )
+        throw std::runtime_error(
+            "Cabana::makeUnmanagedSlice: external view must be contiguous" );
+
+    return slice_type( view.data(), view.extent( 0 ), view.extent( 0 ),
+                       label );
+}
+
+//---------------------------------------------------------------------------//
+
 } // end namespace Cabana
 
 //---------------------------------------------------------------------------//
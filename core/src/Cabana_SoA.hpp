@@ -460,6 +460,112 @@ tupleCopy( SoA<MemberTypes<Types...>, DstVectorLength>& dst,
 //! \endcond
 
 } // end namespace Impl
+
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+template <class SoA_t, std::size_t... M>
+bool checkMemberAlignmentImpl( const std::size_t alignment,
+                               std::index_sequence<M...> )
+{
+    // Member data offsets come from a host instance of the struct - the
+    // layout is identical in every memory space.
+    SoA_t soa;
+    const char* soa_begin = reinterpret_cast<const char*>( &soa );
+    bool aligned = true;
+    (
+        [&]()
+        {
+            const std::size_t offset =
+                reinterpret_cast<const char*>( soaMemberPtr<M>( &soa ) ) -
+                soa_begin;
+            aligned = aligned && ( 0 == offset % alignment );
+        }(),
+        ... );
+    return aligned;
+}
+template <class DataTypes, std::size_t... M>
+constexpr bool blocksAligned( const int vector_length,
+                              const std::size_t alignment,
+                              std::index_sequence<M...> )
+{
+    bool aligned = true;
+    (
+        [&]()
+        {
+            using member_type =
+                typename MemberTypeAtIndex<M, DataTypes>::type;
+            using value_type =
+                typename std::remove_all_extents<member_type>::type;
+            constexpr std::size_t num_component =
+                sizeof( member_type ) / sizeof( value_type );
+            const std::size_t block_bytes =
+                sizeof( value_type ) * num_component * vector_length;
+            aligned = aligned && ( 0 == block_bytes % alignment );
+        }(),
+        ... );
+    return aligned;
+}
+} // end namespace Impl
+//! \endcond
+
+/*!
+  \brief Check whether every member block of an SoA begins on an aligned
+  boundary.
+
+  \tparam SoA_t The SoA type to audit.
+  \param alignment The required alignment in bytes (a cacheline by
+  default).
+  \return True when every member's data starts on an alignment boundary.
+
+  Odd vector lengths can leave scalar members of mixed-size types at
+  offsets that split loads across cachelines on CPU backends. This audits
+  the layout a given member ordering and vector length produce; fix
+  failures by choosing the vector length from alignedVectorLength() or by
+  reordering members.
+*/
+template <class SoA_t>
+bool checkMemberAlignment( const std::size_t alignment = 64 )
+{
+    static_assert( is_soa<SoA_t>::value,
+                   "checkMemberAlignment only for SoAs" );
+    return Impl::checkMemberAlignmentImpl<SoA_t>(
+        alignment,
+        std::make_index_sequence<SoA_t::member_types::size>{} );
+}
+
+/*!
+  \brief Compute the smallest vector length multiple that aligns every
+  member block of the given member types.
+
+  \tparam DataTypes The member types (Cabana::MemberTypes).
+  \param minimum_vector_length The smallest acceptable vector length.
+  \param alignment The required alignment in bytes.
+  \return A vector length >= the minimum for which every member block size
+  is a multiple of the alignment, so all member offsets are aligned.
+
+  Use the result as the AoSoA vector length template argument to get
+  guaranteed cacheline-aligned member streams with no per-member padding.
+*/
+template <class DataTypes>
+constexpr int alignedVectorLength( const int minimum_vector_length,
+                                   const std::size_t alignment = 64 )
+{
+    int vector_length = minimum_vector_length;
+    bool aligned = false;
+    while ( !aligned )
+    {
+        // Check every member block size at this vector length.
+        aligned = Impl::blocksAligned<DataTypes>(
+            vector_length, alignment,
+            std::make_index_sequence<DataTypes::size>{} );
+        if ( !aligned )
+            vector_length *= 2;
+    }
+    return vector_length;
+}
+
 } // end namespace Cabana
 
 #endif // end CABANA_SOA_HPP
@@ -20,11 +20,13 @@
 #include <Cabana_DeepCopy.hpp>
 #include <Cabana_Slice.hpp>
 #include <Cabana_Utils.hpp>
+#include <impl/Cabana_CartesianGrid.hpp>
 
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Profiling_ScopedRegion.hpp>
 #include <Kokkos_Sort.hpp>
 
+#include <cstdint>
 #include <type_traits>
 
 namespace Cabana
@@ -239,6 +241,72 @@ auto kokkosBinSort1d( KeyViewType keys, const int nbin,
         keys, comp, sort_within_bins, begin, end );
 }
 
+//---------------------------------------------------------------------------//
+//! Bin integer keys with a dense counting sort (the single-pass
+//! specialization of an LSD radix sort for cell-id-like keys) producing
+//! binning data with one bin per key value in the occupied range.
+template <class KeyViewType,
+          class ExecutionSpace = typename KeyViewType::execution_space>
+auto radixBinSort1d( KeyViewType keys, const std::size_t begin,
+                     const std::size_t end )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::RadixSort" );
+
+    using memory_space = typename KeyViewType::memory_space;
+    static_assert( is_accessible_from<memory_space, ExecutionSpace>{}, "" );
+    static_assert(
+        std::is_integral<typename KeyViewType::non_const_value_type>::value,
+        "Radix sort requires integer keys" );
+    using size_type = typename memory_space::size_type;
+
+    // One bin per key value in the occupied range.
+    auto key_bounds =
+        Impl::keyMinMax<KeyViewType, ExecutionSpace>( keys, begin, end );
+    auto key_min = key_bounds.min_val;
+    int nbin = key_bounds.max_val - key_min + 1;
+
+    // Count the keys in each bin.
+    Kokkos::View<int*, memory_space> counts( "radix_bin_counts", nbin );
+    Kokkos::parallel_for(
+        "Cabana::radixBinSort::count",
+        Kokkos::RangePolicy<ExecutionSpace>( begin, end ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            Kokkos::atomic_increment( &counts( keys( i ) - key_min ) );
+        } );
+
+    // Compute the bin offsets.
+    Kokkos::View<size_type*, memory_space> offsets( "radix_bin_offsets",
+                                                    nbin );
+    Kokkos::parallel_scan(
+        "Cabana::radixBinSort::scan",
+        Kokkos::RangePolicy<ExecutionSpace>( 0, nbin ),
+        KOKKOS_LAMBDA( const int b, size_type& update,
+                       const bool final_pass ) {
+            if ( final_pass )
+                offsets( b ) = update;
+            update += counts( b );
+        } );
+
+    // Scatter the tuple indices into their bins.
+    Kokkos::View<size_type*, memory_space> bin_fill( "radix_bin_fill", nbin );
+    Kokkos::View<size_type*, memory_space> permute_vector(
+        Kokkos::ViewAllocateWithoutInitializing( "radix_bin_permute" ),
+        end - begin );
+    Kokkos::parallel_for(
+        "Cabana::radixBinSort::scatter",
+        Kokkos::RangePolicy<ExecutionSpace>( begin, end ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            auto b = keys( i ) - key_min;
+            auto loc = offsets( b ) + Kokkos::atomic_fetch_add(
+                                          &bin_fill( b ), size_type( 1 ) );
+            permute_vector( loc ) = i;
+        } );
+    Kokkos::fence();
+
+    return BinningData<memory_space>( begin, end, counts, offsets,
+                                      permute_vector );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Impl
@@ -447,6 +515,581 @@ auto binByKey( KeyViewType keys, const int nbin,
         keys, nbin, false, 0, keys.extent( 0 ) );
 }
 
+//---------------------------------------------------------------------------//
+//! Algorithm tag selecting the dense radix-sort binning backend for integer
+//! keys.
+class RadixSortTag
+{
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Reusable binning workspace for the radix backend.
+
+  \tparam MemorySpace Kokkos memory space.
+
+  Rebinning every step allocates fresh count, offset, and permutation
+  views inside each call; constructing one workspace and passing it to the
+  workspace binByKey overload reuses monotonically grown views instead, so
+  steady-state rebinning performs no allocation or first touch.
+*/
+template <class MemorySpace>
+struct BinningWorkspace
+{
+    //! Memory space.
+    using memory_space = typename MemorySpace::memory_space;
+    //! Memory space size type.
+    using size_type = typename memory_space::size_type;
+
+    //! Bin counts.
+    Kokkos::View<int*, memory_space> counts;
+    //! Bin offsets.
+    Kokkos::View<size_type*, memory_space> offsets;
+    //! Bin fill scratch.
+    Kokkos::View<size_type*, memory_space> bin_fill;
+    //! Permutation vector.
+    Kokkos::View<size_type*, memory_space> permute_vector;
+
+    //! Grow the workspace to cover a binning of the given shape.
+    void reserve( const std::size_t num_bin, const std::size_t num_key )
+    {
+        if ( counts.extent( 0 ) < num_bin )
+        {
+            Kokkos::realloc( Kokkos::WithoutInitializing, counts, num_bin );
+            Kokkos::realloc( Kokkos::WithoutInitializing, offsets, num_bin );
+            Kokkos::realloc( Kokkos::WithoutInitializing, bin_fill, num_bin );
+        }
+        if ( permute_vector.extent( 0 ) < num_key )
+            Kokkos::realloc( Kokkos::WithoutInitializing, permute_vector,
+                             num_key );
+    }
+};
+
+/*!
+  \brief Bin an entire AoSoA with the radix backend reusing a persistent
+  workspace.
+
+  \param keys The integer key values to use for binning.
+  \param workspace The workspace to bin in. Grown monotonically and reused
+  across calls.
+  \return The binning data, viewing the workspace storage. Valid until the
+  next binning into the same workspace.
+*/
+template <class KeyViewType, class MemorySpace,
+          class ExecutionSpace = typename KeyViewType::execution_space>
+auto binByKey( KeyViewType keys, RadixSortTag,
+               BinningWorkspace<MemorySpace>& workspace,
+               typename std::enable_if<( Kokkos::is_view<KeyViewType>::value ),
+                                       int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::RadixSort" );
+
+    using memory_space = typename MemorySpace::memory_space;
+    static_assert( is_accessible_from<memory_space, ExecutionSpace>{}, "" );
+    using size_type = typename memory_space::size_type;
+
+    const std::size_t num_key = keys.extent( 0 );
+    auto key_bounds =
+        Impl::keyMinMax<KeyViewType, ExecutionSpace>( keys, 0, num_key );
+    auto key_min = key_bounds.min_val;
+    const int nbin = key_bounds.max_val - key_min + 1;
+
+    workspace.reserve( nbin, num_key );
+    auto counts = workspace.counts;
+    auto offsets = workspace.offsets;
+    auto bin_fill = workspace.bin_fill;
+    auto permute_vector = workspace.permute_vector;
+
+    // Count the keys in each bin.
+    Kokkos::parallel_for(
+        "Cabana::radixBinSort::reset",
+        Kokkos::RangePolicy<ExecutionSpace>( 0, nbin ),
+        KOKKOS_LAMBDA( const int b ) {
+            counts( b ) = 0;
+            bin_fill( b ) = 0;
+        } );
+    Kokkos::parallel_for(
+        "Cabana::radixBinSort::count",
+        Kokkos::RangePolicy<ExecutionSpace>( 0, num_key ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            Kokkos::atomic_increment( &counts( keys( i ) - key_min ) );
+        } );
+
+    // Compute the bin offsets.
+    Kokkos::parallel_scan(
+        "Cabana::radixBinSort::scan",
+        Kokkos::RangePolicy<ExecutionSpace>( 0, nbin ),
+        KOKKOS_LAMBDA( const int b, size_type& update,
+                       const bool final_pass ) {
+            if ( final_pass )
+                offsets( b ) = update;
+            update += counts( b );
+        } );
+
+    // Scatter the tuple indices into their bins.
+    Kokkos::parallel_for(
+        "Cabana::radixBinSort::scatter",
+        Kokkos::RangePolicy<ExecutionSpace>( 0, num_key ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            auto b = keys( i ) - key_min;
+            auto loc = offsets( b ) + Kokkos::atomic_fetch_add(
+                                          &bin_fill( b ), size_type( 1 ) );
+            permute_vector( loc ) = i;
+        } );
+    Kokkos::fence();
+
+    // The workspace views may exceed the exact binning shape; hand exact
+    // extents to the binning data so numBin() and sizes stay correct.
+    return BinningData<memory_space>(
+        0, num_key,
+        Kokkos::subview( counts, Kokkos::pair<int, int>( 0, nbin ) ),
+        Kokkos::subview( offsets, Kokkos::pair<int, int>( 0, nbin ) ),
+        Kokkos::subview( permute_vector,
+                         Kokkos::pair<std::size_t, std::size_t>( 0,
+                                                                 num_key ) ) );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Bin an entire AoSoA by a composite key: primary key major,
+  secondary key minor.
+
+  \tparam PrimaryViewType The Kokkos::View type for primary (e.g. cell id)
+  keys.
+  \tparam SecondaryViewType The Kokkos::View or Cabana slice type for
+  secondary (e.g. species) keys.
+
+  \param primary_keys The primary integer keys, one per element.
+  \param secondary_keys The secondary integer keys, one per element. Must
+  lie in [0, num_secondary).
+  \param num_secondary The number of distinct secondary key values.
+  \return The binning data over the fused keys. Consecutive bins of one
+  primary value hold its secondary classes in order, so particles sort
+  cell-major and species-minor and type-dependent kernels see uniform
+  warps within each cell's species segment.
+
+  The fused keys run through the dense radix backend, so the cost is one
+  extra fused-key sweep over a plain cell binning.
+*/
+template <class PrimaryViewType, class SecondaryViewType,
+          class ExecutionSpace = typename PrimaryViewType::execution_space>
+auto binByCompositeKey(
+    PrimaryViewType primary_keys, SecondaryViewType secondary_keys,
+    const int num_secondary,
+    typename std::enable_if<( Kokkos::is_view<PrimaryViewType>::value ),
+                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::binByCompositeKey" );
+
+    using memory_space = typename PrimaryViewType::memory_space;
+    using key_type = typename PrimaryViewType::non_const_value_type;
+    static_assert( std::is_integral<key_type>::value,
+                   "Composite binning requires integer keys" );
+
+    // Fuse the keys: primary major, secondary minor.
+    Kokkos::View<key_type*, memory_space> fused_keys(
+        Kokkos::ViewAllocateWithoutInitializing( "composite_keys" ),
+        primary_keys.extent( 0 ) );
+    Kokkos::parallel_for(
+        "Cabana::binByCompositeKey::fuse",
+        Kokkos::RangePolicy<ExecutionSpace>( 0, primary_keys.extent( 0 ) ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            fused_keys( i ) =
+                primary_keys( i ) * num_secondary +
+                static_cast<key_type>( secondary_keys( i ) );
+        } );
+    Kokkos::fence();
+
+    return binByKey( fused_keys, RadixSortTag() );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Bin an entire AoSoA into bins of approximately equal population.
+
+  \tparam KeyViewType The Kokkos::View type for keys.
+
+  \param keys The key values to use for binning.
+  \param nbin The number of bins.
+  \return The binning data with quantile-spaced bin edges.
+
+  Skewed key distributions put most particles into a few uniform-width
+  bins, destroying downstream bin-based load balance. This mode builds a
+  fine device histogram, takes quantile bin edges from its cumulative
+  counts on the host, maps each key to its quantile bin, and bins the
+  result with the dense radix backend - every bin then holds roughly the
+  same number of elements up to the fine-histogram resolution.
+*/
+template <class KeyViewType,
+          class ExecutionSpace = typename KeyViewType::execution_space>
+auto binByKeyEqualFrequency(
+    KeyViewType keys, const int nbin,
+    typename std::enable_if<( Kokkos::is_view<KeyViewType>::value ),
+                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region(
+        "Cabana::binByKeyEqualFrequency" );
+
+    using memory_space = typename KeyViewType::memory_space;
+    using key_value_type = typename KeyViewType::non_const_value_type;
+
+    const std::size_t num_key = keys.extent( 0 );
+    auto key_bounds =
+        Impl::keyMinMax<KeyViewType, ExecutionSpace>( keys, 0, num_key );
+    const double key_min = static_cast<double>( key_bounds.min_val );
+    const double key_max = static_cast<double>( key_bounds.max_val );
+
+    // Fine histogram of the key distribution.
+    const int num_fine = 64 * nbin;
+    const double fine_scale =
+        ( key_max > key_min ) ? num_fine / ( key_max - key_min ) : 0.0;
+    Kokkos::View<long*, memory_space> histogram( "key_histogram", num_fine );
+    Kokkos::parallel_for(
+        "Cabana::binByKeyEqualFrequency::histogram",
+        Kokkos::RangePolicy<ExecutionSpace>( 0, num_key ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            int fine_bin = static_cast<int>(
+                ( static_cast<double>( keys( i ) ) - key_min ) * fine_scale );
+            if ( fine_bin >= num_fine )
+                fine_bin = num_fine - 1;
+            Kokkos::atomic_increment( &histogram( fine_bin ) );
+        } );
+    Kokkos::fence();
+
+    // Quantile bin edges from the cumulative counts: edge b is the last
+    // fine bucket belonging to quantile bin b.
+    auto histogram_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), histogram );
+    Kokkos::View<double*, Kokkos::HostSpace> edges_host( "bin_edges", nbin );
+    long cumulative = 0;
+    int bin = 0;
+    for ( int f = 0; f < num_fine && bin < nbin; ++f )
+    {
+        cumulative += histogram_host( f );
+        while ( bin < nbin &&
+                cumulative >=
+                    static_cast<long>( ( bin + 1 ) *
+                                       ( num_key / double( nbin ) ) ) )
+        {
+            edges_host( bin ) = key_min + ( f + 1 ) / fine_scale;
+            ++bin;
+        }
+    }
+    for ( ; bin < nbin; ++bin )
+        edges_host( bin ) = key_max + 1.0;
+    auto edges =
+        Kokkos::create_mirror_view_and_copy( memory_space(), edges_host );
+
+    // Map each key to its quantile bin and bin densely.
+    Kokkos::View<int*, memory_space> bin_keys(
+        Kokkos::ViewAllocateWithoutInitializing( "quantile_bin_keys" ),
+        num_key );
+    Kokkos::parallel_for(
+        "Cabana::binByKeyEqualFrequency::map",
+        Kokkos::RangePolicy<ExecutionSpace>( 0, num_key ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            const double key = static_cast<double>( keys( i ) );
+            int b = 0;
+            while ( b < nbin - 1 && key >= edges( b ) )
+                ++b;
+            bin_keys( i ) = b;
+        } );
+    Kokkos::fence();
+
+    return binByKey( bin_keys, RadixSortTag() );
+}
+
+//---------------------------------------------------------------------------//
+//! Morton (Z-order) space-filling curve key tag.
+class MortonKeyTag
+{
+};
+
+//! Hilbert space-filling curve key tag.
+class HilbertKeyTag
+{
+};
+
+namespace Impl
+{
+//! \cond Impl
+
+//! Spread the low 21 bits of an integer to every third bit.
+KOKKOS_INLINE_FUNCTION
+std::uint64_t spreadBits3d( std::uint64_t x )
+{
+    x &= 0x1fffff;
+    x = ( x | x << 32 ) & 0x1f00000000ffff;
+    x = ( x | x << 16 ) & 0x1f0000ff0000ff;
+    x = ( x | x << 8 ) & 0x100f00f00f00f00f;
+    x = ( x | x << 4 ) & 0x10c30c30c30c30c3;
+    x = ( x | x << 2 ) & 0x1249249249249249;
+    return x;
+}
+
+//! Morton (Z-order) key of a cell (21 bits per dimension).
+KOKKOS_INLINE_FUNCTION
+std::uint64_t mortonKey3d( const int i, const int j, const int k )
+{
+    return spreadBits3d( i ) | ( spreadBits3d( j ) << 1 ) |
+           ( spreadBits3d( k ) << 2 );
+}
+
+//! Hilbert curve key of a cell (21 bits per dimension). Uses Skilling's
+//! transpose algorithm to convert the cell coordinates to transposed Hilbert
+//! coordinates and then interleaves the bits into a single key.
+KOKKOS_INLINE_FUNCTION
+std::uint64_t hilbertKey3d( const int i, const int j, const int k )
+{
+    constexpr int bits = 21;
+    std::uint32_t coords[3] = { static_cast<std::uint32_t>( i ),
+                                static_cast<std::uint32_t>( j ),
+                                static_cast<std::uint32_t>( k ) };
+
+    // Inverse undo.
+    for ( std::uint32_t q = 1u << ( bits - 1 ); q > 1; q >>= 1 )
+    {
+        std::uint32_t p = q - 1;
+        for ( int d = 0; d < 3; ++d )
+        {
+            if ( coords[d] & q )
+            {
+                coords[0] ^= p;
+            }
+            else
+            {
+                std::uint32_t t = ( coords[0] ^ coords[d] ) & p;
+                coords[0] ^= t;
+                coords[d] ^= t;
+            }
+        }
+    }
+
+    // Gray encode.
+    for ( int d = 1; d < 3; ++d )
+        coords[d] ^= coords[d - 1];
+    std::uint32_t t = 0;
+    for ( std::uint32_t q = 1u << ( bits - 1 ); q > 1; q >>= 1 )
+        if ( coords[2] & q )
+            t ^= q - 1;
+    for ( int d = 0; d < 3; ++d )
+        coords[d] ^= t;
+
+    // Interleave the transposed coordinates, most significant bit first.
+    std::uint64_t key = 0;
+    for ( int b = bits - 1; b >= 0; --b )
+        for ( int d = 0; d < 3; ++d )
+            key = ( key << 1 ) | ( ( coords[d] >> b ) & 1u );
+    return key;
+}
+
+//! \endcond
+} // end namespace Impl
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Generate Morton (Z-order) cell keys from particle positions.
+
+  \tparam PositionType Type for positions.
+  \tparam Scalar Grid scalar type.
+
+  \param positions Particle positions.
+  \param grid_delta Grid cell sizes in each cardinal direction.
+  \param grid_min Grid minimum value in each direction.
+  \param grid_max Grid maximum value in each direction.
+  \return A view of keys suitable for sortByKey.
+
+  Sorting particles by these keys orders them along a space-filling curve
+  through the grid cells, improving the cache locality of slice accesses in
+  subsequent kernels compared to row-major cell order.
+*/
+template <class PositionType, class Scalar>
+auto createSpaceFillingKeys(
+    MortonKeyTag, PositionType positions, const Scalar grid_delta[3],
+    const Scalar grid_min[3], const Scalar grid_max[3],
+    typename std::enable_if<( is_slice<PositionType>::value ||
+                              Kokkos::is_view<PositionType>::value ),
+                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region(
+        "Cabana::createSpaceFillingKeys" );
+
+    using memory_space = typename PositionType::memory_space;
+    using execution_space = typename memory_space::execution_space;
+
+    Impl::CartesianGrid<Scalar> grid( grid_min[0], grid_min[1], grid_min[2],
+                                      grid_max[0], grid_max[1], grid_max[2],
+                                      grid_delta[0], grid_delta[1],
+                                      grid_delta[2] );
+    Kokkos::View<std::uint64_t*, memory_space> keys(
+        Kokkos::ViewAllocateWithoutInitializing( "morton_keys" ),
+        size( positions ) );
+    Kokkos::parallel_for(
+        "Cabana::createSpaceFillingKeys::morton",
+        Kokkos::RangePolicy<execution_space>( 0, size( positions ) ),
+        KOKKOS_LAMBDA( const std::size_t p ) {
+            int i, j, k;
+            grid.locatePoint( positions( p, 0 ), positions( p, 1 ),
+                              positions( p, 2 ), i, j, k );
+            keys( p ) = Impl::mortonKey3d( i, j, k );
+        } );
+    Kokkos::fence();
+    return keys;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Generate Hilbert curve cell keys from particle positions.
+
+  \tparam PositionType Type for positions.
+  \tparam Scalar Grid scalar type.
+
+  \param positions Particle positions.
+  \param grid_delta Grid cell sizes in each cardinal direction.
+  \param grid_min Grid minimum value in each direction.
+  \param grid_max Grid maximum value in each direction.
+  \return A view of keys suitable for sortByKey.
+
+  The Hilbert ordering preserves locality better than Morton order at the
+  cost of a more expensive key computation.
+*/
+template <class PositionType, class Scalar>
+auto createSpaceFillingKeys(
+    HilbertKeyTag, PositionType positions, const Scalar grid_delta[3],
+    const Scalar grid_min[3], const Scalar grid_max[3],
+    typename std::enable_if<( is_slice<PositionType>::value ||
+                              Kokkos::is_view<PositionType>::value ),
+                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region(
+        "Cabana::createSpaceFillingKeys" );
+
+    using memory_space = typename PositionType::memory_space;
+    using execution_space = typename memory_space::execution_space;
+
+    Impl::CartesianGrid<Scalar> grid( grid_min[0], grid_min[1], grid_min[2],
+                                      grid_max[0], grid_max[1], grid_max[2],
+                                      grid_delta[0], grid_delta[1],
+                                      grid_delta[2] );
+    Kokkos::View<std::uint64_t*, memory_space> keys(
+        Kokkos::ViewAllocateWithoutInitializing( "hilbert_keys" ),
+        size( positions ) );
+    Kokkos::parallel_for(
+        "Cabana::createSpaceFillingKeys::hilbert",
+        Kokkos::RangePolicy<execution_space>( 0, size( positions ) ),
+        KOKKOS_LAMBDA( const std::size_t p ) {
+            int i, j, k;
+            grid.locatePoint( positions( p, 0 ), positions( p, 1 ),
+                              positions( p, 2 ), i, j, k );
+            keys( p ) = Impl::hilbertKey3d( i, j, k );
+        } );
+    Kokkos::fence();
+    return keys;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Sort an AoSoA over a subset of its range based on the associated
+  integer key values using the radix-sort backend.
+
+  A single-pass dense counting sort (the degenerate LSD radix sort for
+  cell-id-like keys) that is bandwidth-bound rather than comparison-bound.
+  One bin is produced per key value in the occupied range so equal keys are
+  fully sorted.
+
+  \tparam KeyViewType The Kokkos::View type for keys. Must have an integer
+  value type.
+
+  \param keys The key values to use for sorting. A key value is needed for
+  every element of the AoSoA.
+  \param begin The beginning index of the AoSoA range to sort.
+  \param end The end index of the AoSoA range to sort.
+  \return The binning data including the permutation vector.
+*/
+template <class KeyViewType,
+          class ExecutionSpace = typename KeyViewType::execution_space>
+auto sortByKey( KeyViewType keys, RadixSortTag, const std::size_t begin,
+                const std::size_t end,
+                typename std::enable_if<( Kokkos::is_view<KeyViewType>::value ),
+                                        int>::type* = 0 )
+{
+    return Impl::radixBinSort1d<KeyViewType, ExecutionSpace>( keys, begin,
+                                                              end );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Sort an entire AoSoA based on the associated integer key values
+  using the radix-sort backend.
+
+  \tparam KeyViewType The Kokkos::View type for keys. Must have an integer
+  value type.
+
+  \param keys The key values to use for sorting. A key value is needed for
+  every element of the AoSoA.
+  \return The binning data including the permutation vector.
+*/
+template <class KeyViewType,
+          class ExecutionSpace = typename KeyViewType::execution_space>
+auto sortByKey( KeyViewType keys, RadixSortTag tag,
+                typename std::enable_if<( Kokkos::is_view<KeyViewType>::value ),
+                                        int>::type* = 0 )
+{
+    return sortByKey<KeyViewType, ExecutionSpace>( keys, tag, 0,
+                                                   keys.extent( 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Bin an AoSoA over a subset of its range based on the associated
+  integer key values using the radix-sort backend.
+
+  Unlike the Kokkos::BinSort backend the number of bins is not an input: one
+  bin is produced per key value in the occupied range, which is the natural
+  binning for cell ids.
+
+  \tparam KeyViewType The Kokkos::View type for keys. Must have an integer
+  value type.
+
+  \param keys The key values to use for binning. A key value is needed for
+  every element of the AoSoA.
+  \param begin The beginning index of the AoSoA range to bin.
+  \param end The end index of the AoSoA range to bin.
+  \return The binning data (e.g. bin sizes and offsets).
+*/
+template <class KeyViewType,
+          class ExecutionSpace = typename KeyViewType::execution_space>
+auto binByKey( KeyViewType keys, RadixSortTag, const std::size_t begin,
+               const std::size_t end,
+               typename std::enable_if<( Kokkos::is_view<KeyViewType>::value ),
+                                       int>::type* = 0 )
+{
+    return Impl::radixBinSort1d<KeyViewType, ExecutionSpace>( keys, begin,
+                                                              end );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Bin an entire AoSoA based on the associated integer key values using
+  the radix-sort backend.
+
+  \tparam KeyViewType The Kokkos::View type for keys. Must have an integer
+  value type.
+
+  \param keys The key values to use for binning. A key value is needed for
+  every element of the AoSoA.
+  \return The binning data (e.g. bin sizes and offsets).
+*/
+template <class KeyViewType,
+          class ExecutionSpace = typename KeyViewType::execution_space>
+auto binByKey( KeyViewType keys, RadixSortTag tag,
+               typename std::enable_if<( Kokkos::is_view<KeyViewType>::value ),
+                                       int>::type* = 0 )
+{
+    return binByKey<KeyViewType, ExecutionSpace>( keys, tag, 0,
+                                                  keys.extent( 0 ) );
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Sort an AoSoA over a subset of its range based on the associated
@@ -542,6 +1185,17 @@ auto binByKey(
     return binByKey<SliceType, ExecutionSpace>( slice, nbin, 0, slice.size() );
 }
 
+//---------------------------------------------------------------------------//
+//! Algorithm tag for permutation through a scratch copy (the default).
+class ScratchPermuteTag
+{
+};
+
+//! Algorithm tag for in-place cycle-following permutation.
+class InPlacePermuteTag
+{
+};
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Given binning data permute an AoSoA.
@@ -592,6 +1246,145 @@ void permute(
     Kokkos::fence();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Given binning data permute an AoSoA on an execution space instance.
+
+  \tparam ExecutionSpace Kokkos execution space.
+  \tparam BinningDataType The binning data type.
+  \tparam AoSoA_t The AoSoA type.
+  \param exec_space Execution space instance. All kernels are enqueued on
+  the instance and only the instance is fenced, so the permutation composes
+  with multi-stream pipelines.
+  \param binning_data The binning data.
+  \param aosoa The AoSoA to permute.
+ */
+template <class ExecutionSpace, class BinningDataType, class AoSoA_t>
+void permute(
+    ExecutionSpace exec_space, const BinningDataType& binning_data,
+    AoSoA_t& aosoa,
+    typename std::enable_if<( is_binning_data<BinningDataType>::value &&
+                              is_aosoa<AoSoA_t>::value ),
+                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::permute" );
+
+    using memory_space = typename BinningDataType::memory_space;
+    static_assert( is_accessible_from<memory_space, ExecutionSpace>{}, "" );
+
+    auto begin = binning_data.rangeBegin();
+    auto end = binning_data.rangeEnd();
+
+    Kokkos::View<typename AoSoA_t::tuple_type*, memory_space> scratch_tuples(
+        Kokkos::ViewAllocateWithoutInitializing( "scratch_tuples" ),
+        end - begin );
+
+    auto permute_to_scratch = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        scratch_tuples( i - begin ) =
+            aosoa.getTuple( binning_data.permutation( i - begin ) );
+    };
+    Kokkos::parallel_for(
+        "Cabana::kokkosBinSort::permute_to_scratch",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, begin, end ),
+        permute_to_scratch );
+
+    auto copy_back = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        aosoa.setTuple( i, scratch_tuples( i - begin ) );
+    };
+    Kokkos::parallel_for(
+        "Cabana::kokkosBinSort::copy_back",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, begin, end ),
+        copy_back );
+    exec_space.fence();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Given binning data permute an AoSoA with a scratch copy.
+
+  Tag-dispatched equivalent of the default permute.
+
+  \tparam BinningDataType The binning data type.
+  \tparam AoSoA_t The AoSoA type.
+  \param binning_data The binning data.
+  \param aosoa The AoSoA to permute.
+ */
+template <class BinningDataType, class AoSoA_t,
+          class ExecutionSpace = typename BinningDataType::execution_space>
+void permute(
+    const BinningDataType& binning_data, AoSoA_t& aosoa, ScratchPermuteTag,
+    typename std::enable_if<( is_binning_data<BinningDataType>::value &&
+                              is_aosoa<AoSoA_t>::value ),
+                            int>::type* = 0 )
+{
+    permute<BinningDataType, AoSoA_t, ExecutionSpace>( binning_data, aosoa );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Given binning data permute an AoSoA in place.
+
+  Follows each permutation cycle from its leader (the smallest tuple index in
+  the cycle) so every tuple is moved exactly once without a scratch copy of
+  the container. This halves the peak memory of applying a sort at the cost
+  of serializing the moves within each cycle.
+
+  \tparam BinningDataType The binning data type.
+  \tparam AoSoA_t The AoSoA type.
+  \param binning_data The binning data.
+  \param aosoa The AoSoA to permute.
+ */
+template <class BinningDataType, class AoSoA_t,
+          class ExecutionSpace = typename BinningDataType::execution_space>
+void permute(
+    const BinningDataType& binning_data, AoSoA_t& aosoa, InPlacePermuteTag,
+    typename std::enable_if<( is_binning_data<BinningDataType>::value &&
+                              is_aosoa<AoSoA_t>::value ),
+                            int>::type* = 0 )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::permute" );
+
+    using memory_space = typename BinningDataType::memory_space;
+    static_assert( is_accessible_from<memory_space, ExecutionSpace>{}, "" );
+
+    auto begin = binning_data.rangeBegin();
+    auto end = binning_data.rangeEnd();
+
+    auto follow_cycles = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        // Only the cycle leader moves the cycle.
+        std::size_t j = binning_data.permutation( i - begin );
+        while ( j != i )
+        {
+            if ( j < i )
+                return;
+            j = binning_data.permutation( j - begin );
+        }
+
+        // Move the cycle. Each tuple is read before it is overwritten
+        // because the source of every move is the next tuple in the cycle.
+        typename AoSoA_t::tuple_type leader_tuple = aosoa.getTuple( i );
+        j = i;
+        while ( true )
+        {
+            std::size_t k = binning_data.permutation( j - begin );
+            if ( k == i )
+            {
+                aosoa.setTuple( j, leader_tuple );
+                break;
+            }
+            aosoa.setTuple( j, aosoa.getTuple( k ) );
+            j = k;
+        }
+    };
+    Kokkos::parallel_for( "Cabana::permute::follow_cycles",
+                          Kokkos::RangePolicy<ExecutionSpace>( begin, end ),
+                          follow_cycles );
+    Kokkos::fence();
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Given binning data permute a slice.
@@ -0,0 +1,211 @@
+/****************************************************************************
+ * Copyright (c) 2018-2023 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_Topology.hpp
+  \brief Molecular topology (bond/angle/dihedral) storage and traversal
+*/
+#ifndef CABANA_TOPOLOGY_HPP
+#define CABANA_TOPOLOGY_HPP
+
+#include <Cabana_Sort.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Profiling_ScopedRegion.hpp>
+
+#include <string>
+#include <utility>
+
+namespace Cabana
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Fixed-arity connectivity list storing particle index tuples.
+
+  \tparam MemorySpace Kokkos memory space.
+  \tparam Arity Number of particles per topology entry (2 for bonds, 3 for
+  angles, 4 for dihedrals).
+
+  The particle indices are stored contiguously per entry for coalesced
+  multi-index loads in traversal. The list remaps itself through a
+  BinningData permutation so topology stays valid when permute() reorders
+  the particles, replacing ad-hoc index views that must be re-indexed by
+  hand after every sort.
+*/
+template <class MemorySpace, int Arity>
+class TopologyList
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = typename MemorySpace::memory_space;
+    //! Default execution space.
+    using execution_space = typename memory_space::execution_space;
+    //! Number of particles per entry.
+    static constexpr int arity = Arity;
+    //! Index storage type.
+    using index_view = Kokkos::View<int* [Arity], memory_space>;
+
+    //! Default constructor.
+    TopologyList() = default;
+
+    /*!
+      \brief Allocate a list with a number of entries.
+      \param label A label for the list.
+      \param num_entry The number of topology entries.
+    */
+    TopologyList( const std::string& label, const std::size_t num_entry )
+        : _indices( Kokkos::ViewAllocateWithoutInitializing( label ),
+                    num_entry )
+    {
+    }
+
+    //! Get the number of topology entries.
+    KOKKOS_INLINE_FUNCTION
+    std::size_t size() const { return _indices.extent( 0 ); }
+
+    //! Resize the list.
+    void resize( const std::size_t num_entry )
+    {
+        Kokkos::resize( _indices, num_entry );
+    }
+
+    //! Get the index storage.
+    index_view indices() const { return _indices; }
+
+    //! Get a particle index of an entry.
+    KOKKOS_INLINE_FUNCTION
+    int& operator()( const std::size_t entry, const int a ) const
+    {
+        return _indices( entry, a );
+    }
+
+    /*!
+      \brief Remap all particle indices through a binning permutation.
+
+      \param bin_data The binning data a permute() call was applied with.
+
+      Builds the inverse of the permutation once and rewrites every stored
+      index so the list refers to the particles' new storage locations.
+      Indices outside the permuted range are left unchanged.
+    */
+    template <class BinningDataType>
+    void remap( const BinningDataType& bin_data )
+    {
+        Kokkos::Profiling::ScopedRegion region(
+            "Cabana::TopologyList::remap" );
+
+        const std::size_t begin = bin_data.rangeBegin();
+        const std::size_t end = bin_data.rangeEnd();
+
+        // Invert the permutation: the particle that was at old index
+        // permutation(i) now lives at begin + i.
+        Kokkos::View<int*, memory_space> inverse(
+            Kokkos::ViewAllocateWithoutInitializing( "permute_inverse" ),
+            end );
+        Kokkos::parallel_for(
+            "Cabana::TopologyList::remap::invert",
+            Kokkos::RangePolicy<execution_space>( begin, end ),
+            KOKKOS_LAMBDA( const std::size_t i ) {
+                inverse( bin_data.permutation( i - begin ) ) =
+                    static_cast<int>( i );
+            } );
+
+        // Rewrite the stored indices.
+        auto indices = _indices;
+        Kokkos::parallel_for(
+            "Cabana::TopologyList::remap::rewrite",
+            Kokkos::RangePolicy<execution_space>( 0, size() ),
+            KOKKOS_LAMBDA( const std::size_t t ) {
+                for ( int a = 0; a < Arity; ++a )
+                {
+                    const int idx = indices( t, a );
+                    if ( idx >= static_cast<int>( begin ) &&
+                         idx < static_cast<int>( end ) )
+                        indices( t, a ) = inverse( idx );
+                }
+            } );
+        Kokkos::fence();
+    }
+
+  private:
+    index_view _indices;
+};
+
+//! Bond (pair) topology list.
+template <class MemorySpace>
+using BondList = TopologyList<MemorySpace, 2>;
+//! Angle (triplet) topology list.
+template <class MemorySpace>
+using AngleList = TopologyList<MemorySpace, 3>;
+//! Dihedral (quadruplet) topology list.
+template <class MemorySpace>
+using DihedralList = TopologyList<MemorySpace, 4>;
+
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+template <class FunctorType, class TopologyListType, std::size_t... A>
+KOKKOS_FORCEINLINE_FUNCTION void
+topologyApply( const FunctorType& functor, const TopologyListType& topology,
+               const std::size_t t, std::index_sequence<A...> )
+{
+    functor( t, topology( t, A )... );
+}
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute a functor in parallel over the entries of a topology list.
+
+  \tparam FunctorType The functor type to execute.
+  \tparam TopologyListType The topology list type.
+  \tparam ExecParams The Kokkos range policy parameters.
+
+  \param exec_policy The policy over which to execute the functor. The range
+  indexes topology entries.
+  \param functor The functor to execute in parallel. Invoked as
+  functor( entry, i, j, ... ) with one particle index per arity slot, loaded
+  coalesced from the entry.
+  \param topology The topology list to traverse.
+  \param str Optional name for the functor.
+*/
+template <class FunctorType, class TopologyListType, class... ExecParameters>
+inline void topology_parallel_for(
+    const Kokkos::RangePolicy<ExecParameters...>& exec_policy,
+    const FunctorType& functor, const TopologyListType& topology,
+    const std::string& str = "" )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::topology_parallel_for" );
+
+    using execution_space =
+        typename Kokkos::RangePolicy<ExecParameters...>::execution_space;
+
+    auto topo_func = KOKKOS_LAMBDA( const std::size_t t )
+    {
+        Impl::topologyApply(
+            functor, topology, t,
+            std::make_index_sequence<TopologyListType::arity>{} );
+    };
+    Kokkos::RangePolicy<execution_space> linear_exec_policy(
+        exec_policy.begin(), exec_policy.end() );
+    if ( str.empty() )
+        Kokkos::parallel_for( linear_exec_policy, topo_func );
+    else
+        Kokkos::parallel_for( str, linear_exec_policy, topo_func );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_TOPOLOGY_HPP
@@ -17,6 +17,7 @@
 #define CABANA_VERLETLIST_HPP
 
 #include <Cabana_LinkedCellList.hpp>
+#include <Cabana_MemoryTracker.hpp>
 #include <Cabana_NeighborList.hpp>
 #include <Cabana_Parallel.hpp>
 
@@ -24,6 +25,10 @@
 #include <Kokkos_Profiling_ScopedRegion.hpp>
 
 #include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
 
 namespace Cabana
 {
@@ -40,6 +45,21 @@ struct VerletLayout2D
 {
 };
 
+//---------------------------------------------------------------------------//
+// Verlet List Build Precision Tag.
+//---------------------------------------------------------------------------//
+//! Candidate distance math in the position precision.
+struct NativeBuildPrecision
+{
+};
+
+//! Candidate distance math in single precision. The skin absorbs the
+//! rounding error and the cutoff comparison is inflated by a few ulps so
+//! borderline pairs are never dropped; stored indices remain exact.
+struct FloatBuildPrecision
+{
+};
+
 //---------------------------------------------------------------------------//
 // Verlet List Data.
 //---------------------------------------------------------------------------//
@@ -62,12 +82,17 @@ struct VerletListData<MemorySpace, VerletLayoutCSR>
     //! Neighbor list.
     Kokkos::View<int*, memory_space> neighbors;
 
+    //! Uniform per-particle capacity during a single-pass build with
+    //! estimated allocation (zero when the offsets are exact).
+    int max_alloc = 0;
+
     //! Add a neighbor to the list.
     KOKKOS_INLINE_FUNCTION
     void addNeighbor( const int pid, const int nid ) const
     {
-        neighbors( offsets( pid ) +
-                   Kokkos::atomic_fetch_add( &counts( pid ), 1 ) ) = nid;
+        int count = Kokkos::atomic_fetch_add( &counts( pid ), 1 );
+        if ( 0 == max_alloc || count < max_alloc )
+            neighbors( offsets( pid ) + count ) = nid;
     }
 
     //! Modify a neighbor in the list.
@@ -76,6 +101,33 @@ struct VerletListData<MemorySpace, VerletLayoutCSR>
     {
         neighbors( offsets( pid ) + nid ) = new_id;
     }
+
+    //! Remove a neighbor from the list by swapping in the last entry.
+    KOKKOS_INLINE_FUNCTION
+    void removeNeighbor( const int pid, const int nid ) const
+    {
+        const int last = Kokkos::atomic_fetch_add( &counts( pid ), -1 ) - 1;
+        neighbors( offsets( pid ) + nid ) = neighbors( offsets( pid ) + last );
+    }
+
+    //! Optional periodic image shift codes per neighbor entry (2 bits per
+    //! dimension), allocated by computeImageShifts().
+    Kokkos::View<unsigned char*, memory_space> shifts;
+
+    //! Set the periodic image shift code of a neighbor.
+    KOKKOS_INLINE_FUNCTION
+    void setShift( const int pid, const int nid,
+                   const unsigned char code ) const
+    {
+        shifts( offsets( pid ) + nid ) = code;
+    }
+
+    //! Get the periodic image shift code of a neighbor.
+    KOKKOS_INLINE_FUNCTION
+    unsigned char getShift( const int pid, const int nid ) const
+    {
+        return shifts( offsets( pid ) + nid );
+    }
 };
 
 //! Store the VerletList 2D neighbor data.
@@ -110,6 +162,33 @@ struct VerletListData<MemorySpace, VerletLayout2D>
     {
         neighbors( pid, nid ) = new_id;
     }
+
+    //! Remove a neighbor from the list by swapping in the last entry.
+    KOKKOS_INLINE_FUNCTION
+    void removeNeighbor( const int pid, const int nid ) const
+    {
+        const int last = Kokkos::atomic_fetch_add( &counts( pid ), -1 ) - 1;
+        neighbors( pid, nid ) = neighbors( pid, last );
+    }
+
+    //! Optional periodic image shift codes per neighbor entry (2 bits per
+    //! dimension), allocated by computeImageShifts().
+    Kokkos::View<unsigned char**, memory_space> shifts;
+
+    //! Set the periodic image shift code of a neighbor.
+    KOKKOS_INLINE_FUNCTION
+    void setShift( const int pid, const int nid,
+                   const unsigned char code ) const
+    {
+        shifts( pid, nid ) = code;
+    }
+
+    //! Get the periodic image shift code of a neighbor.
+    KOKKOS_INLINE_FUNCTION
+    unsigned char getShift( const int pid, const int nid ) const
+    {
+        return shifts( pid, nid );
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -124,12 +203,18 @@ namespace Impl
 // Verlet List Builder
 //---------------------------------------------------------------------------//
 template <class DeviceType, class PositionType, class RandomAccessPositionType,
-          class AlgorithmTag, class LayoutTag, class BuildOpTag>
+          class AlgorithmTag, class LayoutTag, class BuildOpTag,
+          class BuildPrecision = NativeBuildPrecision>
 struct VerletListBuilder
 {
     // Types.
     using device = DeviceType;
     using PositionValueType = typename PositionType::value_type;
+    // Precision of the candidate distance math.
+    using BuildValueType =
+        typename std::conditional<std::is_same<BuildPrecision,
+                                               FloatBuildPrecision>::value,
+                                  float, PositionValueType>::type;
     using memory_space = typename device::memory_space;
     using execution_space = typename device::execution_space;
 
@@ -139,6 +224,18 @@ struct VerletListBuilder
     // Neighbor cutoff.
     PositionValueType rsqr;
 
+    // Cutoff in the build precision, inflated by a few ulps when the math
+    // runs below the position precision.
+    KOKKOS_INLINE_FUNCTION
+    BuildValueType inflatedCutoff( const PositionValueType cutoff_sqr ) const
+    {
+        BuildValueType cutoff = cutoff_sqr;
+        if ( !std::is_same<BuildValueType, PositionValueType>::value )
+            cutoff *= BuildValueType( 1 ) +
+                      8 * std::numeric_limits<BuildValueType>::epsilon();
+        return cutoff;
+    }
+
     // Positions.
     RandomAccessPositionType _position;
     std::size_t pid_begin, pid_end;
@@ -147,10 +244,17 @@ struct VerletListBuilder
     BinningData<memory_space> bin_data_1d;
     LinkedCellList<memory_space, PositionValueType> linked_cell_list;
 
+    // Optional per-particle cutoff radii. When allocated these override the
+    // scalar cutoff pair-by-pair.
+    Kokkos::View<PositionValueType*, memory_space> _radius;
+
     // Check to count or refill.
     bool refill;
     bool count;
 
+    // Whether the single-pass CSR fill into the estimated capacity has run.
+    bool single_pass_filled = false;
+
     // Maximum allocated neighbors per particle
     std::size_t alloc_n;
 
@@ -194,6 +298,56 @@ struct VerletListBuilder
         rsqr = neighborhood_radius * neighborhood_radius;
     }
 
+    // Constructor reusing an existing linked cell binning.
+    VerletListBuilder(
+        PositionType positions, const std::size_t begin, const std::size_t end,
+        const LinkedCellList<memory_space, PositionValueType>& lcl,
+        const PositionValueType neighborhood_radius,
+        const std::size_t max_neigh )
+        : pid_begin( begin )
+        , pid_end( end )
+        , alloc_n( max_neigh )
+    {
+        count = true;
+        refill = false;
+
+        // Create the count view.
+        _data.counts = Kokkos::View<int*, memory_space>( "num_neighbors",
+                                                         size( positions ) );
+
+        // Make a guess for the number of neighbors per particle for 2D lists.
+        initCounts( LayoutTag() );
+
+        // Shallow copy for random access read-only memory.
+        _position = positions;
+
+        // Use the binning that was already computed. The list must bin all
+        // particles with cells that cover the neighborhood radius.
+        linked_cell_list = lcl;
+        bin_data_1d = linked_cell_list.binningData();
+
+        // We will use the square of the distance for neighbor determination.
+        rsqr = neighborhood_radius * neighborhood_radius;
+    }
+
+    // Constructor with per-particle cutoff radii. The binning is performed
+    // at the given maximum radius and pairs are pruned with the actual
+    // per-particle radii.
+    VerletListBuilder( PositionType positions, const std::size_t begin,
+                       const std::size_t end,
+                       const Kokkos::View<PositionValueType*, memory_space>
+                           particle_radius,
+                       const PositionValueType max_radius,
+                       const PositionValueType cell_size_ratio,
+                       const PositionValueType grid_min[3],
+                       const PositionValueType grid_max[3],
+                       const std::size_t max_neigh )
+        : VerletListBuilder( positions, begin, end, max_radius,
+                             cell_size_ratio, grid_min, grid_max, max_neigh )
+    {
+        _radius = particle_radius;
+    }
+
     // Neighbor count team operator (only used for CSR lists).
     struct CountNeighborsTag
     {
@@ -313,14 +467,21 @@ struct VerletListBuilder
                  pid, x_p, y_p, z_p, nid, x_n, y_n, z_n ) )
         {
             // Calculate the distance between the particle and its candidate
-            // neighbor.
-            PositionValueType dx = x_p - x_n;
-            PositionValueType dy = y_p - y_n;
-            PositionValueType dz = z_p - z_n;
-            PositionValueType dist_sqr = dx * dx + dy * dy + dz * dz;
-
-            // If within the cutoff add to the count.
-            if ( dist_sqr <= rsqr )
+            // neighbor in the build precision.
+            BuildValueType dx = static_cast<BuildValueType>( x_p ) -
+                                static_cast<BuildValueType>( x_n );
+            BuildValueType dy = static_cast<BuildValueType>( y_p ) -
+                                static_cast<BuildValueType>( y_n );
+            BuildValueType dz = static_cast<BuildValueType>( z_p ) -
+                                static_cast<BuildValueType>( z_n );
+            BuildValueType dist_sqr = dx * dx + dy * dy + dz * dz;
+
+            // If within the cutoff add to the count. Per-particle radii
+            // override the scalar cutoff when present.
+            PositionValueType cutoff_sqr = rsqr;
+            if ( _radius.extent( 0 ) > 0 )
+                cutoff_sqr = _radius( pid ) * _radius( pid );
+            if ( dist_sqr <= inflatedCutoff( cutoff_sqr ) )
                 local_count += 1;
         }
     }
@@ -342,7 +503,31 @@ struct VerletListBuilder
         }
     };
 
-    void initCounts( VerletLayoutCSR ) {}
+    // Single-pass CSR build: fill directly into an estimated-capacity
+    // uniform-stride allocation and skip the separate count traversal. An
+    // overflow of the estimate falls back to an exact refill.
+    void initCounts( VerletLayoutCSR )
+    {
+        if ( alloc_n > 0 )
+        {
+            count = false;
+
+            _data.max_alloc = alloc_n;
+            _data.offsets = Kokkos::View<int*, memory_space>(
+                Kokkos::ViewAllocateWithoutInitializing( "neighbor_offsets" ),
+                _data.counts.size() );
+            auto offsets = _data.offsets;
+            int stride = alloc_n;
+            Kokkos::parallel_for(
+                "Cabana::VerletListBuilder::init_offsets",
+                Kokkos::RangePolicy<execution_space>( 0,
+                                                      _data.counts.size() ),
+                KOKKOS_LAMBDA( const int p ) { offsets( p ) = p * stride; } );
+            _data.neighbors = Kokkos::View<int*, memory_space>(
+                Kokkos::ViewAllocateWithoutInitializing( "neighbors" ),
+                _data.counts.size() * alloc_n );
+        }
+    }
 
     void initCounts( VerletLayout2D )
     {
@@ -357,6 +542,78 @@ struct VerletListBuilder
     }
 
     void processCounts( VerletLayoutCSR )
+    {
+        // Single-pass build with estimated capacity.
+        if ( _data.max_alloc > 0 )
+        {
+            // Before the fill there is nothing to process - the offsets and
+            // capacity were set when the counts were initialized.
+            if ( !single_pass_filled )
+            {
+                single_pass_filled = true;
+                return;
+            }
+
+            // After the fill, find the maximum count to detect overflow of
+            // the estimated capacity.
+            auto counts = _data.counts;
+            int max;
+            Kokkos::Max<int> max_reduce( max );
+            Kokkos::parallel_reduce(
+                "Cabana::VerletListBuilder::reduce_max",
+                Kokkos::RangePolicy<execution_space>( 0,
+                                                      _data.counts.size() ),
+                KOKKOS_LAMBDA( const int i, int& value ) {
+                    if ( counts( i ) > value )
+                        value = counts( i );
+                },
+                max_reduce );
+            Kokkos::fence();
+
+            if ( max <= static_cast<int>( alloc_n ) )
+            {
+                // The estimate held. Compact the uniform-stride data into an
+                // exact CSR allocation - memory traffic only, no second
+                // stencil traversal.
+                auto old_offsets = _data.offsets;
+                auto old_neighbors = _data.neighbors;
+                _data.max_alloc = 0;
+                processCountsExact();
+                auto new_offsets = _data.offsets;
+                auto new_neighbors = _data.neighbors;
+                Kokkos::parallel_for(
+                    "Cabana::VerletListBuilder::compact_neighbors",
+                    Kokkos::RangePolicy<execution_space>( 0, counts.size() ),
+                    KOKKOS_LAMBDA( const int p ) {
+                        for ( int n = old_offsets( p );
+                              n < old_offsets( p ) + counts( p ); ++n )
+                            new_neighbors( new_offsets( p ) + n -
+                                           old_offsets( p ) ) =
+                                old_neighbors( n );
+                    } );
+                Kokkos::fence();
+            }
+            else
+            {
+                // The estimate overflowed. The counts are exact, so compute
+                // exact offsets and refill.
+                _data.max_alloc = 0;
+                refill = true;
+                processCountsExact();
+                Kokkos::deep_copy( _data.counts, 0 );
+            }
+            return;
+        }
+
+        processCountsExact();
+
+        // Reset the counts. We count again when we fill.
+        Kokkos::deep_copy( _data.counts, 0 );
+    }
+
+    // Compute exact offsets from the counts and allocate the exact neighbor
+    // list.
+    void processCountsExact()
     {
         // Allocate offsets.
         _data.offsets = Kokkos::View<int*, memory_space>(
@@ -375,12 +632,13 @@ struct VerletListBuilder
         Kokkos::fence();
 
         // Allocate the neighbor list.
+        MemoryTracker::instance().deallocate(
+            "NeighborList", _data.neighbors.size() * sizeof( int ) );
+        MemoryTracker::instance().allocate(
+            "NeighborList", total_num_neighbor * sizeof( int ) );
         _data.neighbors = Kokkos::View<int*, memory_space>(
             Kokkos::ViewAllocateWithoutInitializing( "neighbors" ),
             total_num_neighbor );
-
-        // Reset the counts. We count again when we fill.
-        Kokkos::deep_copy( _data.counts, 0 );
     }
 
     // Process 2D counts by computing the maximum number of neighbors and
@@ -522,15 +780,22 @@ struct VerletListBuilder
                  pid, x_p, y_p, z_p, nid, x_n, y_n, z_n ) )
         {
             // Calculate the distance between the particle and its candidate
-            // neighbor.
-            PositionValueType dx = x_p - x_n;
-            PositionValueType dy = y_p - y_n;
-            PositionValueType dz = z_p - z_n;
-            PositionValueType dist_sqr = dx * dx + dy * dy + dz * dz;
+            // neighbor in the build precision.
+            BuildValueType dx = static_cast<BuildValueType>( x_p ) -
+                                static_cast<BuildValueType>( x_n );
+            BuildValueType dy = static_cast<BuildValueType>( y_p ) -
+                                static_cast<BuildValueType>( y_n );
+            BuildValueType dz = static_cast<BuildValueType>( z_p ) -
+                                static_cast<BuildValueType>( z_n );
+            BuildValueType dist_sqr = dx * dx + dy * dy + dz * dz;
 
             // If within the cutoff increment the neighbor count and add as a
-            // neighbor at that index.
-            if ( dist_sqr <= rsqr )
+            // neighbor at that index. Per-particle radii override the scalar
+            // cutoff when present.
+            PositionValueType cutoff_sqr = rsqr;
+            if ( _radius.extent( 0 ) > 0 )
+                cutoff_sqr = _radius( pid ) * _radius( pid );
+            if ( dist_sqr <= inflatedCutoff( cutoff_sqr ) )
             {
                 _data.addNeighbor( pid, nid );
             }
@@ -541,7 +806,8 @@ struct VerletListBuilder
 // Builder creation functions. This is only necessary to define the different
 // random access types.
 template <class DeviceType, class PositionType, class AlgorithmTag,
-          class LayoutTag, class BuildOpTag>
+          class LayoutTag, class BuildOpTag,
+          class BuildPrecision = NativeBuildPrecision>
 auto createVerletListBuilder(
     PositionType x, const std::size_t begin, const std::size_t end,
     const typename PositionType::value_type radius,
@@ -553,12 +819,14 @@ auto createVerletListBuilder(
 {
     using RandomAccessPositionType = typename PositionType::random_access_slice;
     return VerletListBuilder<DeviceType, PositionType, RandomAccessPositionType,
-                             AlgorithmTag, LayoutTag, BuildOpTag>(
+                             AlgorithmTag, LayoutTag, BuildOpTag,
+                             BuildPrecision>(
         x, begin, end, radius, cell_size_ratio, grid_min, grid_max, max_neigh );
 }
 
 template <class DeviceType, class PositionType, class AlgorithmTag,
-          class LayoutTag, class BuildOpTag>
+          class LayoutTag, class BuildOpTag,
+          class BuildPrecision = NativeBuildPrecision>
 auto createVerletListBuilder(
     PositionType x, const std::size_t begin, const std::size_t end,
     const typename PositionType::value_type radius,
@@ -573,10 +841,95 @@ auto createVerletListBuilder(
         Kokkos::View<typename PositionType::value_type**, DeviceType,
                      Kokkos::MemoryTraits<Kokkos::RandomAccess>>;
     return VerletListBuilder<DeviceType, PositionType, RandomAccessPositionType,
-                             AlgorithmTag, LayoutTag, BuildOpTag>(
+                             AlgorithmTag, LayoutTag, BuildOpTag,
+                             BuildPrecision>(
         x, begin, end, radius, cell_size_ratio, grid_min, grid_max, max_neigh );
 }
 
+// Builder creation functions reusing an existing linked cell binning.
+template <class DeviceType, class PositionType, class AlgorithmTag,
+          class LayoutTag, class BuildOpTag,
+          class BuildPrecision = NativeBuildPrecision, class LinkedCellType>
+auto createVerletListBuilder(
+    PositionType x, const std::size_t begin, const std::size_t end,
+    const LinkedCellType& linked_cell_list,
+    const typename PositionType::value_type radius,
+    const std::size_t max_neigh,
+    typename std::enable_if<( is_slice<PositionType>::value ), int>::type* = 0 )
+{
+    using RandomAccessPositionType = typename PositionType::random_access_slice;
+    return VerletListBuilder<DeviceType, PositionType, RandomAccessPositionType,
+                             AlgorithmTag, LayoutTag, BuildOpTag,
+                             BuildPrecision>(
+        x, begin, end, linked_cell_list, radius, max_neigh );
+}
+
+template <class DeviceType, class PositionType, class AlgorithmTag,
+          class LayoutTag, class BuildOpTag,
+          class BuildPrecision = NativeBuildPrecision, class LinkedCellType>
+auto createVerletListBuilder(
+    PositionType x, const std::size_t begin, const std::size_t end,
+    const LinkedCellType& linked_cell_list,
+    const typename PositionType::value_type radius,
+    const std::size_t max_neigh,
+    typename std::enable_if<( Kokkos::is_view<PositionType>::value ),
+                            int>::type* = 0 )
+{
+    using RandomAccessPositionType =
+        Kokkos::View<typename PositionType::value_type**, DeviceType,
+                     Kokkos::MemoryTraits<Kokkos::RandomAccess>>;
+    return VerletListBuilder<DeviceType, PositionType, RandomAccessPositionType,
+                             AlgorithmTag, LayoutTag, BuildOpTag,
+                             BuildPrecision>(
+        x, begin, end, linked_cell_list, radius, max_neigh );
+}
+
+// Builder creation functions with per-particle cutoff radii.
+template <class DeviceType, class PositionType, class AlgorithmTag,
+          class LayoutTag, class BuildOpTag,
+          class BuildPrecision = NativeBuildPrecision, class RadiusViewType>
+auto createVerletListBuilder(
+    PositionType x, const std::size_t begin, const std::size_t end,
+    const RadiusViewType particle_radius,
+    const typename PositionType::value_type max_radius,
+    const typename PositionType::value_type cell_size_ratio,
+    const typename PositionType::value_type grid_min[3],
+    const typename PositionType::value_type grid_max[3],
+    const std::size_t max_neigh,
+    typename std::enable_if<( is_slice<PositionType>::value ), int>::type* = 0 )
+{
+    using RandomAccessPositionType = typename PositionType::random_access_slice;
+    return VerletListBuilder<DeviceType, PositionType, RandomAccessPositionType,
+                             AlgorithmTag, LayoutTag, BuildOpTag,
+                             BuildPrecision>(
+        x, begin, end, particle_radius, max_radius, cell_size_ratio, grid_min,
+        grid_max, max_neigh );
+}
+
+template <class DeviceType, class PositionType, class AlgorithmTag,
+          class LayoutTag, class BuildOpTag,
+          class BuildPrecision = NativeBuildPrecision, class RadiusViewType>
+auto createVerletListBuilder(
+    PositionType x, const std::size_t begin, const std::size_t end,
+    const RadiusViewType particle_radius,
+    const typename PositionType::value_type max_radius,
+    const typename PositionType::value_type cell_size_ratio,
+    const typename PositionType::value_type grid_min[3],
+    const typename PositionType::value_type grid_max[3],
+    const std::size_t max_neigh,
+    typename std::enable_if<( Kokkos::is_view<PositionType>::value ),
+                            int>::type* = 0 )
+{
+    using RandomAccessPositionType =
+        Kokkos::View<typename PositionType::value_type**, DeviceType,
+                     Kokkos::MemoryTraits<Kokkos::RandomAccess>>;
+    return VerletListBuilder<DeviceType, PositionType, RandomAccessPositionType,
+                             AlgorithmTag, LayoutTag, BuildOpTag,
+                             BuildPrecision>(
+        x, begin, end, particle_radius, max_radius, cell_size_ratio, grid_min,
+        grid_max, max_neigh );
+}
+
 //---------------------------------------------------------------------------//
 
 //! \endcond
@@ -601,7 +954,8 @@ auto createVerletListBuilder(
   distributed particles due to the use of a Cartesian grid.
 */
 template <class MemorySpace, class AlgorithmTag, class LayoutTag,
-          class BuildTag = TeamVectorOpTag>
+          class BuildTag = TeamVectorOpTag,
+          class BuildPrecision = NativeBuildPrecision>
 class VerletList
 {
   public:
@@ -647,8 +1001,9 @@ class VerletList
       in each dimension.
 
       \param max_neigh Optional maximum number of neighbors per particle to
-      pre-allocate the neighbor list. Potentially avoids recounting with 2D
-      layout only.
+      pre-allocate the neighbor list. Potentially avoids recounting with the
+      2D layout and enables the single-pass estimated-capacity build with the
+      CSR layout.
 
       Particles outside of the neighborhood radius will not be considered
       neighbors. Only compute the neighbors of those that are within the given
@@ -720,7 +1075,8 @@ class VerletList
         // Create a builder functor.
         auto builder =
             Impl::createVerletListBuilder<device_type, PositionType,
-                                          AlgorithmTag, LayoutTag, BuildTag>(
+                                          AlgorithmTag, LayoutTag, BuildTag,
+                                          BuildPrecision>(
                 x, begin, end, neighborhood_radius, cell_size_ratio, grid_min,
                 grid_max, max_neigh );
 
@@ -765,60 +1121,1149 @@ class VerletList
         _data = builder._data;
     }
 
-    //! Modify a neighbor in the list; for example, mark it as a broken bond.
-    KOKKOS_INLINE_FUNCTION
-    void setNeighbor( const std::size_t particle_index,
-                      const std::size_t neighbor_index,
-                      const int new_index ) const
+    /*!
+      \brief Given particle positions and per-particle cutoff radii
+      calculate the neighbor list.
+
+      \param x The particle positions.
+      \param begin The beginning particle index to compute neighbors for.
+      \param end The end particle index to compute neighbors for.
+      \param particle_radius Per-particle neighborhood radii.
+      \param max_radius The maximum of the per-particle radii. Binning is
+      performed at this radius and pairs are pruned with the per-particle
+      values, so stored lists are exact for adaptive cutoffs (e.g. SPH
+      smoothing lengths).
+      \param cell_size_ratio The ratio of the cell size in the Cartesian
+      grid to the maximum radius.
+      \param grid_min The minimum value of the grid containing the
+      particles in each dimension.
+      \param grid_max The maximum value of the grid containing the
+      particles in each dimension.
+      \param max_neigh Optional maximum number of neighbors per particle to
+      pre-allocate the neighbor list.
+    */
+    template <class PositionType, class RadiusViewType>
+    void
+    build( PositionType x, const std::size_t begin, const std::size_t end,
+           const RadiusViewType& particle_radius,
+           const typename PositionType::value_type max_radius,
+           const typename PositionType::value_type cell_size_ratio,
+           const typename PositionType::value_type grid_min[3],
+           const typename PositionType::value_type grid_max[3],
+           const std::size_t max_neigh = 0,
+           typename std::enable_if<( Kokkos::is_view<RadiusViewType>::value &&
+                                     ( is_slice<PositionType>::value ||
+                                       Kokkos::is_view<PositionType>::value ) ),
+                                   int>::type* = 0 )
     {
-        _data.setNeighbor( particle_index, neighbor_index, new_index );
-    }
-};
+        Kokkos::Profiling::ScopedRegion region( "Cabana::VerletList::build" );
 
-//---------------------------------------------------------------------------//
-// Neighbor list interface implementation.
-//---------------------------------------------------------------------------//
-//! CSR VerletList NeighborList interface.
-template <class MemorySpace, class AlgorithmTag, class BuildTag>
-class NeighborList<
-    VerletList<MemorySpace, AlgorithmTag, VerletLayoutCSR, BuildTag>>
-{
-  public:
-    //! Kokkos memory space.
-    using memory_space = MemorySpace;
-    //! Neighbor list type.
-    using list_type =
-        VerletList<MemorySpace, AlgorithmTag, VerletLayoutCSR, BuildTag>;
+        using device_type = Kokkos::Device<execution_space, memory_space>;
 
-    //! Get the total number of neighbors across all particles.
-    KOKKOS_INLINE_FUNCTION
-    static std::size_t totalNeighbor( const list_type& list )
-    {
-        // Size of the allocated memory gives total neighbors.
-        return list._data.neighbors.extent( 0 );
-    }
+        assert( end >= begin );
+        assert( end <= size( x ) );
 
-    //! Get the maximum number of neighbors across all particles.
-    KOKKOS_INLINE_FUNCTION
-    static std::size_t maxNeighbor( const list_type& list )
-    {
-        std::size_t num_p = list._data.counts.size();
-        return Impl::maxNeighbor( list, num_p );
+        // Create a builder functor pruning with the per-particle radii.
+        auto builder =
+            Impl::createVerletListBuilder<device_type, PositionType,
+                                          AlgorithmTag, LayoutTag, BuildTag,
+                                          BuildPrecision>(
+                x, begin, end, particle_radius, max_radius, cell_size_ratio,
+                grid_min, grid_max, max_neigh );
+
+        // Run the same count/fill pipeline as the scalar-cutoff build.
+        typename decltype( builder )::FillNeighborsPolicy fill_policy(
+            builder.bin_data_1d.numBin(), Kokkos::AUTO, 4 );
+        if ( builder.count )
+        {
+            typename decltype( builder )::CountNeighborsPolicy count_policy(
+                builder.bin_data_1d.numBin(), Kokkos::AUTO, 4 );
+            Kokkos::parallel_for( "Cabana::VerletList::count_neighbors",
+                                  count_policy, builder );
+        }
+        else
+        {
+            builder.processCounts( LayoutTag() );
+            Kokkos::parallel_for( "Cabana::VerletList::fill_neighbors",
+                                  fill_policy, builder );
+        }
+        Kokkos::fence();
+
+        builder.processCounts( LayoutTag() );
+
+        if ( builder.count or builder.refill )
+        {
+            Kokkos::parallel_for( "Cabana::VerletList::fill_neighbors",
+                                  fill_policy, builder );
+            Kokkos::fence();
+        }
+
+        // Get the data from the builder.
+        _data = builder._data;
     }
 
-    //! Get the number of neighbors for a given particle index.
-    KOKKOS_INLINE_FUNCTION
-    static std::size_t numNeighbor( const list_type& list,
-                                    const std::size_t particle_index )
+    /*!
+      \brief Given a list of particle positions, a neighborhood radius, and
+      an existing linked cell list calculate the neighbor list.
+
+      The linked cell list binning is reused rather than rebuilt, so the
+      binning computed once per step can be shared between sorting, cell
+      traversal, and Verlet construction. The list must bin all particles
+      with cells that cover the neighborhood radius.
+    */
+    template <class PositionType, class LinkedCellType>
+    void
+    build( PositionType x, const std::size_t begin, const std::size_t end,
+           const LinkedCellType& linked_cell_list,
+           const typename PositionType::value_type neighborhood_radius,
+           const std::size_t max_neigh = 0,
+           typename std::enable_if<( is_linked_cell_list<LinkedCellType>::value &&
+                                     ( is_slice<PositionType>::value ||
+                                       Kokkos::is_view<PositionType>::value ) ),
+                                   int>::type* = 0 )
     {
-        return list._data.counts( particle_index );
+        // Use the default execution space.
+        build( execution_space{}, x, begin, end, linked_cell_list,
+               neighborhood_radius, max_neigh );
     }
 
-    //! Get the id for a neighbor for a given particle index and the index of
-    //! the neighbor relative to the particle.
-    KOKKOS_INLINE_FUNCTION
-    static std::size_t getNeighbor( const list_type& list,
-                                    const std::size_t particle_index,
+    /*!
+      \brief Given a list of particle positions, a neighborhood radius, and
+      an existing linked cell list calculate the neighbor list.
+    */
+    template <class PositionType, class LinkedCellType, class ExecutionSpace>
+    void
+    build( ExecutionSpace, PositionType x, const std::size_t begin,
+           const std::size_t end, const LinkedCellType& linked_cell_list,
+           const typename PositionType::value_type neighborhood_radius,
+           const std::size_t max_neigh = 0,
+           typename std::enable_if<( is_linked_cell_list<LinkedCellType>::value &&
+                                     ( is_slice<PositionType>::value ||
+                                       Kokkos::is_view<PositionType>::value ) ),
+                                   int>::type* = 0 )
+    {
+        Kokkos::Profiling::ScopedRegion region( "Cabana::VerletList::build" );
+
+        static_assert( is_accessible_from<memory_space, ExecutionSpace>{}, "" );
+
+        assert( end >= begin );
+        assert( end <= size( x ) );
+
+        using device_type = Kokkos::Device<ExecutionSpace, memory_space>;
+
+        // Create a builder functor over the existing binning.
+        auto builder =
+            Impl::createVerletListBuilder<device_type, PositionType,
+                                          AlgorithmTag, LayoutTag, BuildTag,
+                                          BuildPrecision>(
+                x, begin, end, linked_cell_list, neighborhood_radius,
+                max_neigh );
+
+        // Run the same count/fill pipeline as a build with internal binning.
+        typename decltype( builder )::FillNeighborsPolicy fill_policy(
+            builder.bin_data_1d.numBin(), Kokkos::AUTO, 4 );
+        if ( builder.count )
+        {
+            typename decltype( builder )::CountNeighborsPolicy count_policy(
+                builder.bin_data_1d.numBin(), Kokkos::AUTO, 4 );
+            Kokkos::parallel_for( "Cabana::VerletList::count_neighbors",
+                                  count_policy, builder );
+        }
+        else
+        {
+            builder.processCounts( LayoutTag() );
+            Kokkos::parallel_for( "Cabana::VerletList::fill_neighbors",
+                                  fill_policy, builder );
+        }
+        Kokkos::fence();
+
+        builder.processCounts( LayoutTag() );
+
+        if ( builder.count or builder.refill )
+        {
+            Kokkos::parallel_for( "Cabana::VerletList::fill_neighbors",
+                                  fill_policy, builder );
+            Kokkos::fence();
+        }
+
+        // Get the data from the builder.
+        _data = builder._data;
+    }
+
+    //! Modify a neighbor in the list; for example, mark it as a broken bond.
+    KOKKOS_INLINE_FUNCTION
+    void setNeighbor( const std::size_t particle_index,
+                      const std::size_t neighbor_index,
+                      const int new_index ) const
+    {
+        _data.setNeighbor( particle_index, neighbor_index, new_index );
+    }
+
+    //! Remove a neighbor from the list by swapping in the particle's last
+    //! entry; for example, to tombstone a deleted particle's pairings.
+    KOKKOS_INLINE_FUNCTION
+    void removeNeighbor( const std::size_t particle_index,
+                         const std::size_t neighbor_index ) const
+    {
+        _data.removeNeighbor( particle_index, neighbor_index );
+    }
+
+    /*!
+      \brief Append list entries for newly inserted particles without a full
+      rebuild. 2D layout and full lists only.
+
+      \param x The particle positions including the inserted particles.
+      \param old_size The particle count before insertion.
+      \param new_size The particle count after insertion.
+      \param linked_cell_list A linked cell list binning all new_size
+      particles with cells covering the neighborhood radius.
+      \param neighborhood_radius The radius of the neighborhood.
+      \return False if a particle's row capacity was exceeded, in which case
+      the list is stale and a full build is required.
+
+      Each inserted particle queries the binning for its neighbors and also
+      appends itself to the rows of the pre-existing particles it pairs
+      with, so injection events stop costing a full rebuild. Deletions are
+      handled with removeNeighbor(); the displacement trigger still governs
+      full rebuilds.
+    */
+    template <class PositionType, class LinkedCellType, class LT = LayoutTag>
+    std::enable_if_t<std::is_same<LT, VerletLayout2D>::value, bool>
+    addParticles( PositionType x, const std::size_t old_size,
+                  const std::size_t new_size,
+                  const LinkedCellType& linked_cell_list,
+                  const typename PositionType::value_type neighborhood_radius )
+    {
+        Kokkos::Profiling::ScopedRegion region(
+            "Cabana::VerletList::addParticles" );
+
+        using value_type = typename PositionType::value_type;
+
+        // Grow the list data, preserving the existing rows.
+        const std::size_t capacity = _data.neighbors.extent( 1 );
+        Kokkos::resize( _data.counts, new_size );
+        Kokkos::resize( _data.neighbors, new_size, capacity );
+
+        auto data = _data;
+        const value_type rsqr = neighborhood_radius * neighborhood_radius;
+        Kokkos::parallel_for(
+            "Cabana::VerletList::addParticles",
+            Kokkos::RangePolicy<execution_space>( old_size, new_size ),
+            KOKKOS_LAMBDA( const std::size_t p ) {
+                const value_type x_p = x( p, 0 );
+                const value_type y_p = x( p, 1 );
+                const value_type z_p = x( p, 2 );
+
+                int imin, imax, jmin, jmax, kmin, kmax;
+                linked_cell_list.getStencilCells(
+                    linked_cell_list.getParticleBin( p ), imin, imax, jmin,
+                    jmax, kmin, kmax );
+                for ( int i = imin; i < imax; ++i )
+                    for ( int j = jmin; j < jmax; ++j )
+                        for ( int k = kmin; k < kmax; ++k )
+                        {
+                            const std::size_t n_offset =
+                                linked_cell_list.binOffset( i, j, k );
+                            const int num_n =
+                                linked_cell_list.binSize( i, j, k );
+                            for ( int n = 0; n < num_n; ++n )
+                            {
+                                const std::size_t q =
+                                    linked_cell_list.getParticle( n_offset +
+                                                                  n );
+                                if ( q == p )
+                                    continue;
+                                const value_type dx = x_p - x( q, 0 );
+                                const value_type dy = y_p - x( q, 1 );
+                                const value_type dz = z_p - x( q, 2 );
+                                if ( dx * dx + dy * dy + dz * dz <= rsqr )
+                                {
+                                    // Our own row, and the row of any
+                                    // pre-existing pair partner. Inserted
+                                    // partners handle their own rows.
+                                    data.addNeighbor( p, q );
+                                    if ( q < old_size )
+                                        data.addNeighbor( q, p );
+                                }
+                            }
+                        }
+            } );
+        Kokkos::fence();
+
+        // Detect row capacity overflow and update the maximum count.
+        auto counts = _data.counts;
+        int max;
+        Kokkos::Max<int> max_reduce( max );
+        Kokkos::parallel_reduce(
+            "Cabana::VerletList::addParticles::max",
+            Kokkos::RangePolicy<execution_space>( 0, new_size ),
+            KOKKOS_LAMBDA( const int i, int& value ) {
+                if ( counts( i ) > value )
+                    value = counts( i );
+            },
+            max_reduce );
+        Kokkos::fence();
+        if ( max > static_cast<int>( capacity ) )
+            return false;
+        _data.max_n = static_cast<std::size_t>( max );
+        return true;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Neighbor list memory and quality statistics.
+*/
+struct NeighborListStatistics
+{
+    //! Number of particles with rows in the list.
+    std::size_t num_particle;
+    //! Total stored neighbors.
+    std::size_t total_neighbor;
+    //! Maximum neighbors of any particle.
+    std::size_t max_neighbor;
+    //! Mean neighbors per particle.
+    double mean_neighbor;
+    //! Bytes of neighbor index storage allocated.
+    std::size_t allocated_bytes;
+    //! Fraction of the allocated neighbor storage holding real entries.
+    double fill_factor;
+    //! Histogram of per-particle neighbor counts (uniform bins over
+    //! [0, max_neighbor]).
+    std::vector<std::size_t> histogram;
+};
+
+//! \cond Impl
+namespace Impl
+{
+template <class MemorySpace>
+std::size_t neighborAllocatedBytes(
+    const VerletListData<MemorySpace, VerletLayoutCSR>& data )
+{
+    return ( data.neighbors.extent( 0 ) + data.offsets.extent( 0 ) +
+             data.counts.extent( 0 ) ) *
+           sizeof( int );
+}
+
+template <class MemorySpace>
+std::size_t neighborAllocatedBytes(
+    const VerletListData<MemorySpace, VerletLayout2D>& data )
+{
+    return ( data.neighbors.extent( 0 ) * data.neighbors.extent( 1 ) +
+             data.counts.extent( 0 ) ) *
+           sizeof( int );
+}
+} // end namespace Impl
+//! \endcond
+
+/*!
+  \brief Compute memory and quality statistics of a Verlet list on device.
+
+  \param list The list to analyze.
+  \param num_histogram_bin Number of neighbor count histogram bins.
+  \return The statistics.
+
+  Surfaces the padding waste of the 2D layout (fill factor), neighbor count
+  spread, and storage breakdown that previously required manual dumps to
+  discover.
+*/
+template <class MemorySpace, class AlgorithmTag, class LayoutTag,
+          class BuildTag, class BuildPrecision>
+NeighborListStatistics neighborListStatistics(
+    const VerletList<MemorySpace, AlgorithmTag, LayoutTag, BuildTag,
+                     BuildPrecision>& list,
+    const int num_histogram_bin = 10 )
+{
+    using execution_space = typename MemorySpace::execution_space;
+
+    NeighborListStatistics stats;
+    auto counts = list._data.counts;
+    stats.num_particle = counts.extent( 0 );
+
+    // Total and max counts.
+    long total = 0;
+    int max = 0;
+    Kokkos::parallel_reduce(
+        "Cabana::neighborListStatistics::reduce",
+        Kokkos::RangePolicy<execution_space>( 0, stats.num_particle ),
+        KOKKOS_LAMBDA( const int p, long& t, int& m ) {
+            t += counts( p );
+            if ( counts( p ) > m )
+                m = counts( p );
+        },
+        total, Kokkos::Max<int>( max ) );
+    Kokkos::fence();
+    stats.total_neighbor = total;
+    stats.max_neighbor = max;
+    stats.mean_neighbor =
+        stats.num_particle > 0
+            ? static_cast<double>( total ) / stats.num_particle
+            : 0.0;
+
+    // Count histogram.
+    Kokkos::View<std::size_t*, MemorySpace> histogram( "count_histogram",
+                                                       num_histogram_bin );
+    const double bin_scale =
+        ( max > 0 ) ? static_cast<double>( num_histogram_bin ) / ( max + 1 )
+                    : 0.0;
+    Kokkos::parallel_for(
+        "Cabana::neighborListStatistics::histogram",
+        Kokkos::RangePolicy<execution_space>( 0, stats.num_particle ),
+        KOKKOS_LAMBDA( const int p ) {
+            int bin = static_cast<int>( counts( p ) * bin_scale );
+            if ( bin >= num_histogram_bin )
+                bin = num_histogram_bin - 1;
+            Kokkos::atomic_increment( &histogram( bin ) );
+        } );
+    Kokkos::fence();
+    auto histogram_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), histogram );
+    stats.histogram.resize( num_histogram_bin );
+    for ( int b = 0; b < num_histogram_bin; ++b )
+        stats.histogram[b] = histogram_host( b );
+
+    // Memory breakdown.
+    stats.allocated_bytes = Impl::neighborAllocatedBytes( list._data );
+    stats.fill_factor =
+        stats.allocated_bytes > 0
+            ? static_cast<double>( stats.total_neighbor * sizeof( int ) ) /
+                  stats.allocated_bytes
+            : 0.0;
+
+    return stats;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Convert CSR neighbor data to the 2D layout without rebuilding.
+
+  \param csr The CSR neighbor data.
+  \return Equivalent 2D neighbor data. The counts view is shared; only the
+  neighbor storage is expanded, costing one copy pass instead of a full
+  list rebuild.
+*/
+template <class MemorySpace>
+auto convertNeighborLayout(
+    const VerletListData<MemorySpace, VerletLayoutCSR>& csr )
+{
+    using execution_space = typename MemorySpace::execution_space;
+
+    VerletListData<MemorySpace, VerletLayout2D> data_2d;
+    data_2d.counts = Kokkos::View<int*, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "num_neighbors" ),
+        csr.counts.extent( 0 ) );
+    Kokkos::deep_copy( data_2d.counts, csr.counts );
+
+    // Find the maximum row size.
+    const std::size_t num_p = csr.counts.extent( 0 );
+    auto counts = csr.counts;
+    int max;
+    Kokkos::Max<int> max_reduce( max );
+    Kokkos::parallel_reduce(
+        "Cabana::convertNeighborLayout::max",
+        Kokkos::RangePolicy<execution_space>( 0, num_p ),
+        KOKKOS_LAMBDA( const int i, int& value ) {
+            if ( counts( i ) > value )
+                value = counts( i );
+        },
+        max_reduce );
+    Kokkos::fence();
+    data_2d.max_n = static_cast<std::size_t>( max );
+
+    // Expand the rows.
+    data_2d.neighbors = Kokkos::View<int**, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "neighbors" ), num_p,
+        data_2d.max_n );
+    auto offsets = csr.offsets;
+    auto csr_neighbors = csr.neighbors;
+    auto neighbors_2d = data_2d.neighbors;
+    Kokkos::parallel_for(
+        "Cabana::convertNeighborLayout::expand",
+        Kokkos::RangePolicy<execution_space>( 0, num_p ),
+        KOKKOS_LAMBDA( const int p ) {
+            for ( int n = 0; n < counts( p ); ++n )
+                neighbors_2d( p, n ) = csr_neighbors( offsets( p ) + n );
+        } );
+    Kokkos::fence();
+
+    return data_2d;
+}
+
+/*!
+  \brief Convert 2D neighbor data to the CSR layout without rebuilding.
+
+  \param data_2d The 2D neighbor data.
+  \return Equivalent CSR neighbor data. The counts view is shared; the
+  padded rows are compacted with one scan and one copy pass instead of a
+  full list rebuild.
+*/
+template <class MemorySpace>
+auto convertNeighborLayout(
+    const VerletListData<MemorySpace, VerletLayout2D>& data_2d )
+{
+    using execution_space = typename MemorySpace::execution_space;
+
+    VerletListData<MemorySpace, VerletLayoutCSR> csr;
+    csr.counts = Kokkos::View<int*, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "num_neighbors" ),
+        data_2d.counts.extent( 0 ) );
+    Kokkos::deep_copy( csr.counts, data_2d.counts );
+
+    // Compute exact offsets.
+    const std::size_t num_p = data_2d.counts.extent( 0 );
+    auto counts = data_2d.counts;
+    csr.offsets = Kokkos::View<int*, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "neighbor_offsets" ),
+        num_p );
+    auto offsets = csr.offsets;
+    int total_num_neighbor;
+    Kokkos::parallel_scan(
+        "Cabana::convertNeighborLayout::scan",
+        Kokkos::RangePolicy<execution_space>( 0, num_p ),
+        KOKKOS_LAMBDA( const int p, int& update, const bool final_pass ) {
+            if ( final_pass )
+                offsets( p ) = update;
+            update += counts( p );
+        },
+        total_num_neighbor );
+    Kokkos::fence();
+
+    // Compact the rows.
+    csr.neighbors = Kokkos::View<int*, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "neighbors" ),
+        total_num_neighbor );
+    auto neighbors_2d = data_2d.neighbors;
+    auto csr_neighbors = csr.neighbors;
+    Kokkos::parallel_for(
+        "Cabana::convertNeighborLayout::compact",
+        Kokkos::RangePolicy<execution_space>( 0, num_p ),
+        KOKKOS_LAMBDA( const int p ) {
+            for ( int n = 0; n < counts( p ); ++n )
+                csr_neighbors( offsets( p ) + n ) = neighbors_2d( p, n );
+        } );
+    Kokkos::fence();
+
+    return csr;
+}
+
+/*!
+  \brief Convert a Verlet list to the other memory layout without
+  rebuilding.
+
+  \param list The list to convert.
+  \return A Verlet list with identical neighbors in the other layout.
+*/
+template <class MemorySpace, class AlgorithmTag, class LayoutTag,
+          class BuildTag, class BuildPrecision>
+auto convertNeighborList(
+    const VerletList<MemorySpace, AlgorithmTag, LayoutTag, BuildTag,
+                     BuildPrecision>& list )
+{
+    using other_layout =
+        std::conditional_t<std::is_same<LayoutTag, VerletLayoutCSR>::value,
+                           VerletLayout2D, VerletLayoutCSR>;
+    VerletList<MemorySpace, AlgorithmTag, other_layout, BuildTag,
+               BuildPrecision>
+        converted;
+    converted._data = convertNeighborLayout( list._data );
+    return converted;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Hierarchical multi-cutoff neighbor list.
+
+  \tparam MemorySpace The Kokkos memory space for storing the neighbor
+  lists.
+  \tparam AlgorithmTag Tag indicating whether to build full or half
+  neighbor lists.
+  \tparam LayoutTag Tag indicating whether to use a CSR or 2D data layout.
+  \tparam BuildTag Tag indicating the build parallelism.
+
+  One list per cutoff class, all built from a single linked cell binning at
+  the largest cutoff. Polydisperse and multi-species systems traverse each
+  pair class over the list matching its actual cutoff instead of wading
+  through the neighbors of the global maximum cutoff; any
+  neighbor_parallel_for overload applies to the per-class lists directly.
+*/
+template <class MemorySpace, class AlgorithmTag, class LayoutTag,
+          class BuildTag = TeamVectorOpTag>
+class MultiCutoffVerletList
+{
+  public:
+    //! Kokkos memory space in which the neighbor list data resides.
+    using memory_space = MemorySpace;
+    //! Single-cutoff list type.
+    using list_type = VerletList<MemorySpace, AlgorithmTag, LayoutTag,
+                                 BuildTag>;
+
+    //! Default constructor.
+    MultiCutoffVerletList() = default;
+
+    /*!
+      \brief Build one list per cutoff class over a shared binning.
+
+      \param x The particle positions.
+      \param begin The beginning particle index to compute neighbors for.
+      \param end The end particle index to compute neighbors for.
+      \param cutoffs The neighborhood radius of each cutoff class, in
+      ascending order. The binning is built at the largest cutoff.
+      \param cell_size_ratio The ratio of the cell size in the Cartesian
+      grid to the largest cutoff.
+      \param grid_min The minimum value of the grid containing the particles
+      in each dimension.
+      \param grid_max The maximum value of the grid containing the particles
+      in each dimension.
+    */
+    template <class PositionType, class Scalar>
+    void build( PositionType x, const std::size_t begin,
+                const std::size_t end, const std::vector<Scalar>& cutoffs,
+                const Scalar cell_size_ratio, const Scalar grid_min[3],
+                const Scalar grid_max[3] )
+    {
+        Kokkos::Profiling::ScopedRegion region(
+            "Cabana::MultiCutoffVerletList::build" );
+
+        // Bin once at the largest cutoff.
+        const Scalar max_cutoff = cutoffs.back();
+        Scalar grid_size = cell_size_ratio * max_cutoff;
+        Scalar grid_delta[3] = { grid_size, grid_size, grid_size };
+        auto linked_cell_list = createLinkedCellList<memory_space>(
+            x, grid_delta, grid_min, grid_max, max_cutoff, cell_size_ratio );
+
+        // Build each cutoff class from the shared binning.
+        _lists.resize( cutoffs.size() );
+        for ( std::size_t c = 0; c < cutoffs.size(); ++c )
+            _lists[c].build( x, begin, end, linked_cell_list, cutoffs[c] );
+    }
+
+    //! Get the number of cutoff classes.
+    std::size_t numCutoff() const { return _lists.size(); }
+
+    //! Get the neighbor list of a cutoff class.
+    list_type& list( const std::size_t cutoff_class )
+    {
+        return _lists[cutoff_class];
+    }
+    //! Get the neighbor list of a cutoff class.
+    const list_type& list( const std::size_t cutoff_class ) const
+    {
+        return _lists[cutoff_class];
+    }
+
+  private:
+    std::vector<list_type> _lists;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Compressed sparse row neighbor list with delta-encoded, bit-packed
+  neighbor indices.
+
+  \tparam MemorySpace The Kokkos memory space for storing the neighbor list.
+
+  Each neighbor index is stored as the zig-zag encoded offset from its
+  particle index, bit-packed with a fixed per-particle width chosen from the
+  largest offset in that particle's block. For spatially ordered (e.g.
+  Morton sorted) particles the offsets are small and the packed list is
+  typically half the size of 32-bit absolute indices or less, with a
+  matching reduction in read traffic during traversal. Decoding is a
+  constant-time shift-and-mask so the list works with all
+  neighbor_parallel_for patterns through the NeighborList interface.
+*/
+template <class MemorySpace>
+class CompressedNeighborList
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = MemorySpace;
+
+    //! Number of neighbors per particle.
+    Kokkos::View<int*, memory_space> counts;
+    //! Starting bit of each particle's packed neighbor block.
+    Kokkos::View<std::size_t*, memory_space> bit_offsets;
+    //! Bit width of the packed offsets in each particle's block.
+    Kokkos::View<int*, memory_space> widths;
+    //! Bit-packed zig-zag encoded neighbor offsets.
+    Kokkos::View<std::uint32_t*, memory_space> packed;
+    //! Total number of neighbors.
+    std::size_t total_neighbors = 0;
+
+    //! Decode the neighbor index at a given position in a particle's block.
+    KOKKOS_INLINE_FUNCTION
+    std::size_t decode( const std::size_t particle_index,
+                        const std::size_t neighbor_index ) const
+    {
+        int width = widths( particle_index );
+        std::size_t bit =
+            bit_offsets( particle_index ) + neighbor_index * width;
+        std::size_t word = bit / 32;
+        int shift = bit % 32;
+        std::uint64_t bits = packed( word );
+        if ( shift + width > 32 )
+            bits |= static_cast<std::uint64_t>( packed( word + 1 ) ) << 32;
+        std::uint32_t mask = ( width < 32 ) ? ( ( 1u << width ) - 1u ) : ~0u;
+        std::uint32_t zig_zag =
+            static_cast<std::uint32_t>( bits >> shift ) & mask;
+        int delta = static_cast<int>( zig_zag >> 1 ) ^
+                    -static_cast<int>( zig_zag & 1u );
+        return particle_index + delta;
+    }
+};
+
+/*!
+  \brief Compress a CSR Verlet list into delta-encoded, bit-packed storage.
+  \param list The CSR Verlet list to compress.
+  \return CompressedNeighborList with the same neighbors.
+*/
+template <class MemorySpace, class AlgorithmTag, class BuildTag,
+          class BuildPrecision>
+auto createCompressedNeighborList(
+    const VerletList<MemorySpace, AlgorithmTag, VerletLayoutCSR, BuildTag,
+                     BuildPrecision>& list )
+{
+    Kokkos::Profiling::ScopedRegion region(
+        "Cabana::createCompressedNeighborList" );
+
+    using execution_space = typename MemorySpace::execution_space;
+
+    auto counts = list._data.counts;
+    auto offsets = list._data.offsets;
+    auto neighbors = list._data.neighbors;
+    std::size_t num_p = counts.extent( 0 );
+
+    CompressedNeighborList<MemorySpace> compressed;
+    compressed.counts = counts;
+    compressed.total_neighbors = neighbors.extent( 0 );
+    compressed.widths = Kokkos::View<int*, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "neighbor_widths" ), num_p );
+    compressed.bit_offsets = Kokkos::View<std::size_t*, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "neighbor_bit_offsets" ),
+        num_p );
+    auto widths = compressed.widths;
+    auto bit_offsets = compressed.bit_offsets;
+
+    // Find the bit width needed for the largest encoded offset in each
+    // particle's block.
+    Kokkos::parallel_for(
+        "Cabana::createCompressedNeighborList::widths",
+        Kokkos::RangePolicy<execution_space>( 0, num_p ),
+        KOKKOS_LAMBDA( const std::size_t p ) {
+            std::uint32_t max_zig_zag = 0;
+            for ( int n = 0; n < counts( p ); ++n )
+            {
+                int delta = neighbors( offsets( p ) + n ) -
+                            static_cast<int>( p );
+                std::uint32_t zig_zag =
+                    ( static_cast<std::uint32_t>( delta ) << 1 ) ^
+                    static_cast<std::uint32_t>( delta >> 31 );
+                if ( zig_zag > max_zig_zag )
+                    max_zig_zag = zig_zag;
+            }
+            int width = 1;
+            while ( max_zig_zag >>= 1 )
+                ++width;
+            widths( p ) = width;
+        } );
+
+    // Compute the starting bit of each block and the total packed size.
+    std::size_t total_bits;
+    Kokkos::parallel_scan(
+        "Cabana::createCompressedNeighborList::bit_scan",
+        Kokkos::RangePolicy<execution_space>( 0, num_p ),
+        KOKKOS_LAMBDA( const std::size_t p, std::size_t& update,
+                       const bool final_pass ) {
+            if ( final_pass )
+                bit_offsets( p ) = update;
+            update += static_cast<std::size_t>( counts( p ) ) * widths( p );
+        },
+        total_bits );
+    Kokkos::fence();
+
+    // Pack the encoded offsets. The words must be zero-initialized because
+    // packing merges with atomic-or.
+    compressed.packed = Kokkos::View<std::uint32_t*, MemorySpace>(
+        "packed_neighbors", ( total_bits + 31 ) / 32 );
+    auto packed = compressed.packed;
+    Kokkos::parallel_for(
+        "Cabana::createCompressedNeighborList::pack",
+        Kokkos::RangePolicy<execution_space>( 0, num_p ),
+        KOKKOS_LAMBDA( const std::size_t p ) {
+            int width = widths( p );
+            for ( int n = 0; n < counts( p ); ++n )
+            {
+                int delta = neighbors( offsets( p ) + n ) -
+                            static_cast<int>( p );
+                std::uint64_t zig_zag =
+                    ( static_cast<std::uint32_t>( delta ) << 1 ) ^
+                    static_cast<std::uint32_t>( delta >> 31 );
+                std::size_t bit = bit_offsets( p ) + n * width;
+                std::size_t word = bit / 32;
+                int shift = bit % 32;
+                Kokkos::atomic_or(
+                    &packed( word ),
+                    static_cast<std::uint32_t>( zig_zag << shift ) );
+                if ( shift + width > 32 )
+                    Kokkos::atomic_or( &packed( word + 1 ),
+                                       static_cast<std::uint32_t>(
+                                           zig_zag >> ( 32 - shift ) ) );
+            }
+        } );
+    Kokkos::fence();
+
+    return compressed;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Manager that rebuilds a VerletList only when particle motion
+  requires it.
+
+  \tparam ListType The VerletList type to manage.
+
+  \tparam Scalar Position value type.
+
+  The underlying list is built with an extended radius (the cutoff plus a
+  skin distance) and the positions at build time are saved. The list remains
+  valid until some particle has moved more than half the skin since the last
+  build. update() performs that check with a single max-displacement
+  reduction and rebuilds only when required.
+
+  The skin can optionally be auto-tuned against a target number of steps
+  between rebuilds: if rebuilds trigger more often than the target the skin
+  is grown (fewer, more expensive rebuilds), and if they trigger much less
+  often it is shrunk (cheaper traversal from fewer skin neighbors).
+*/
+template <class ListType, class Scalar = double>
+class VerletListManager
+{
+  public:
+    //! Kokkos memory space in which the neighbor list data resides.
+    using memory_space = typename ListType::memory_space;
+
+    //! Kokkos default execution space for this memory space.
+    using execution_space = typename memory_space::execution_space;
+
+    /*!
+      \brief Constructor. Builds the managed list with the extended radius.
+
+      \param x The particle positions.
+      \param begin The beginning particle index to compute neighbors for.
+      \param end The end particle index to compute neighbors for.
+      \param cutoff The interaction cutoff distance.
+      \param skin The skin distance added to the cutoff when building.
+      \param cell_size_ratio The ratio of the cell size in the Cartesian grid
+      to the extended radius.
+      \param grid_min The minimum value of the grid containing the particles
+      in each dimension.
+      \param grid_max The maximum value of the grid containing the particles
+      in each dimension.
+      \param max_neigh Optional maximum number of neighbors per particle to
+      pre-allocate the neighbor list.
+    */
+    template <class PositionType>
+    VerletListManager(
+        PositionType x, const std::size_t begin, const std::size_t end,
+        const Scalar cutoff, const Scalar skin, const Scalar cell_size_ratio,
+        const Scalar grid_min[3], const Scalar grid_max[3],
+        const std::size_t max_neigh = 0,
+        typename std::enable_if<( is_slice<PositionType>::value ||
+                                  Kokkos::is_view<PositionType>::value ),
+                                int>::type* = 0 )
+        : _begin( begin )
+        , _end( end )
+        , _cutoff( cutoff )
+        , _skin( skin )
+        , _cell_size_ratio( cell_size_ratio )
+        , _max_neigh( max_neigh )
+    {
+        for ( int d = 0; d < 3; ++d )
+        {
+            _grid_min[d] = grid_min[d];
+            _grid_max[d] = grid_max[d];
+        }
+        _x0 = Kokkos::View<Scalar* [3], memory_space>(
+            Kokkos::ViewAllocateWithoutInitializing( "reference_positions" ),
+            size( x ) );
+        rebuild( x );
+    }
+
+    //! Get the managed neighbor list.
+    ListType& list() { return _list; }
+    //! Get the managed neighbor list.
+    const ListType& list() const { return _list; }
+
+    //! Get the current skin distance.
+    Scalar skin() const { return _skin; }
+
+    //! Get the number of update() calls since the last rebuild.
+    int stepsSinceRebuild() const { return _steps_since_rebuild; }
+
+    /*!
+      \brief Set the target number of steps between rebuilds for skin
+      auto-tuning. A target of zero (the default) disables tuning.
+    */
+    void setTargetRebuildInterval( const int target )
+    {
+        _target_rebuild_interval = target;
+    }
+
+    /*!
+      \brief Check whether particle motion has invalidated the list.
+
+      \param x The current particle positions.
+      \return True if some particle moved more than half the skin since the
+      last build.
+    */
+    template <class PositionType>
+    bool needsRebuild( PositionType x ) const
+    {
+        auto x0 = _x0;
+        Scalar max_dist_sqr = 0.0;
+        Kokkos::parallel_reduce(
+            "Cabana::VerletListManager::max_displacement",
+            Kokkos::RangePolicy<execution_space>( _begin, _end ),
+            KOKKOS_LAMBDA( const std::size_t p, Scalar& max_sqr ) {
+                Scalar dx = x( p, 0 ) - x0( p, 0 );
+                Scalar dy = x( p, 1 ) - x0( p, 1 );
+                Scalar dz = x( p, 2 ) - x0( p, 2 );
+                Scalar dist_sqr = dx * dx + dy * dy + dz * dz;
+                if ( dist_sqr > max_sqr )
+                    max_sqr = dist_sqr;
+            },
+            Kokkos::Max<Scalar>( max_dist_sqr ) );
+        Kokkos::fence();
+
+        Scalar half_skin = 0.5 * _skin;
+        return max_dist_sqr > half_skin * half_skin;
+    }
+
+    /*!
+      \brief Rebuild the list if particle motion requires it.
+
+      \param x The current particle positions.
+      \return True if a rebuild was performed.
+    */
+    template <class PositionType>
+    bool update( PositionType x )
+    {
+        ++_steps_since_rebuild;
+        // Uncertified motion exhausts the bounding-motion budget.
+        _displacement_bound = 0.5 * _skin;
+        _certified_steps = 0;
+        if ( !needsRebuild( x ) )
+            return false;
+
+        tuneSkin();
+        rebuild( x );
+        return true;
+    }
+
+    /*!
+      \brief Certify list validity for future steps from a velocity bound.
+
+      \param v The current particle velocities, indexed as (particle,dim).
+      \param dt The time step size.
+      \return The number of steps the list is provably valid for.
+
+      One max-speed reduction bounds the per-step motion; the list stays
+      valid while the accumulated motion bound is below half the skin, so
+      the certified steps skip even the displacement-check kernel.
+    */
+    template <class VelocityType>
+    int certifySteps( const VelocityType& v, const Scalar dt )
+    {
+        Scalar max_v_sqr = 0.0;
+        Kokkos::parallel_reduce(
+            "Cabana::VerletListManager::max_velocity",
+            Kokkos::RangePolicy<execution_space>( _begin, _end ),
+            KOKKOS_LAMBDA( const std::size_t p, Scalar& max_sqr ) {
+                Scalar v_sqr = v( p, 0 ) * v( p, 0 ) + v( p, 1 ) * v( p, 1 ) +
+                               v( p, 2 ) * v( p, 2 );
+                if ( v_sqr > max_sqr )
+                    max_sqr = v_sqr;
+            },
+            Kokkos::Max<Scalar>( max_v_sqr ) );
+        Kokkos::fence();
+
+        _certified_step_motion = std::sqrt( max_v_sqr ) * dt;
+        const Scalar budget = 0.5 * _skin - _displacement_bound;
+        if ( _certified_step_motion <= 0.0 )
+            _certified_steps =
+                ( budget > 0.0 ) ? std::numeric_limits<int>::max() : 0;
+        else
+            _certified_steps =
+                ( budget > 0.0 )
+                    ? static_cast<int>( budget / _certified_step_motion )
+                    : 0;
+        return _certified_steps;
+    }
+
+    //! Get the remaining certified-valid steps.
+    int certifiedSteps() const { return _certified_steps; }
+
+    /*!
+      \brief Advance one step using bounding-motion certificates.
+
+      \param x The current particle positions.
+      \param v The current particle velocities.
+      \param dt The time step size.
+      \return True if a rebuild was performed.
+
+      While a certificate holds, neither the displacement-check kernel nor
+      the rebuild runs - the step costs one counter update. When the
+      certificate is exhausted a new one is computed from the current
+      velocity bound, and only if that also fails does the exact
+      displacement check (and possibly the rebuild) run.
+    */
+    template <class PositionType, class VelocityType>
+    bool update( PositionType x, const VelocityType& v, const Scalar dt )
+    {
+        ++_steps_since_rebuild;
+        if ( 0 == _certified_steps )
+            certifySteps( v, dt );
+        if ( _certified_steps > 0 )
+        {
+            --_certified_steps;
+            _displacement_bound += _certified_step_motion;
+            return false;
+        }
+
+        // Certificate exhausted: fall back to the exact check.
+        if ( !needsRebuild( x ) )
+        {
+            // The exact check passed; reopen the motion budget from the
+            // true displacement rather than the conservative bound.
+            _displacement_bound = 0.5 * _skin;
+            return false;
+        }
+
+        tuneSkin();
+        rebuild( x );
+        return true;
+    }
+
+  private:
+    // Rebuild the list with the extended radius and save the positions.
+    template <class PositionType>
+    void rebuild( PositionType x )
+    {
+        _list.build( x, _begin, _end, _cutoff + _skin, _cell_size_ratio,
+                     _grid_min, _grid_max, _max_neigh );
+
+        if ( _x0.extent( 0 ) != size( x ) )
+            Kokkos::realloc( Kokkos::WithoutInitializing, _x0, size( x ) );
+        auto x0 = _x0;
+        Kokkos::parallel_for(
+            "Cabana::VerletListManager::save_positions",
+            Kokkos::RangePolicy<execution_space>( _begin, _end ),
+            KOKKOS_LAMBDA( const std::size_t p ) {
+                for ( int d = 0; d < 3; ++d )
+                    x0( p, d ) = x( p, d );
+            } );
+        Kokkos::fence();
+
+        _steps_since_rebuild = 0;
+        _displacement_bound = 0.0;
+        _certified_steps = 0;
+    }
+
+    // Adjust the skin toward the target rebuild interval. Measured rebuild
+    // frequency is the library-side proxy for the rebuild vs. traversal cost
+    // balance.
+    void tuneSkin()
+    {
+        if ( 0 == _target_rebuild_interval )
+            return;
+
+        if ( _steps_since_rebuild < _target_rebuild_interval )
+            _skin *= 1.1;
+        else if ( _steps_since_rebuild > 2 * _target_rebuild_interval )
+            _skin *= 0.9;
+    }
+
+    ListType _list;
+    Kokkos::View<Scalar* [3], memory_space> _x0;
+
+    std::size_t _begin;
+    std::size_t _end;
+    Scalar _cutoff;
+    Scalar _skin;
+    Scalar _cell_size_ratio;
+    Scalar _grid_min[3];
+    Scalar _grid_max[3];
+    std::size_t _max_neigh;
+
+    int _steps_since_rebuild = 0;
+    int _target_rebuild_interval = 0;
+    int _certified_steps = 0;
+    Scalar _certified_step_motion = 0.0;
+    Scalar _displacement_bound = 0.0;
+};
+
+/*!
+  \brief Creation function for a VerletListManager.
+  \return VerletListManager over the given list type.
+*/
+template <class ListType, class PositionType, class Scalar>
+auto createVerletListManager( PositionType x, const std::size_t begin,
+                              const std::size_t end, const Scalar cutoff,
+                              const Scalar skin, const Scalar cell_size_ratio,
+                              const Scalar grid_min[3],
+                              const Scalar grid_max[3],
+                              const std::size_t max_neigh = 0 )
+{
+    return VerletListManager<ListType, Scalar>( x, begin, end, cutoff, skin,
+                                                cell_size_ratio, grid_min,
+                                                grid_max, max_neigh );
+}
+
+//---------------------------------------------------------------------------//
+// Neighbor list interface implementation.
+//---------------------------------------------------------------------------//
+//! CSR VerletList NeighborList interface.
+template <class MemorySpace, class AlgorithmTag, class BuildTag,
+          class BuildPrecision>
+class NeighborList<VerletList<MemorySpace, AlgorithmTag, VerletLayoutCSR,
+                              BuildTag, BuildPrecision>>
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = MemorySpace;
+    //! Neighbor list type.
+    using list_type =
+        VerletList<MemorySpace, AlgorithmTag, VerletLayoutCSR, BuildTag,
+                   BuildPrecision>;
+
+    //! Get the total number of neighbors across all particles.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t totalNeighbor( const list_type& list )
+    {
+        // Size of the allocated memory gives total neighbors.
+        return list._data.neighbors.extent( 0 );
+    }
+
+    //! Get the maximum number of neighbors across all particles.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t maxNeighbor( const list_type& list )
+    {
+        std::size_t num_p = list._data.counts.size();
+        return Impl::maxNeighbor( list, num_p );
+    }
+
+    //! Get the number of neighbors for a given particle index.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t numNeighbor( const list_type& list,
+                                    const std::size_t particle_index )
+    {
+        return list._data.counts( particle_index );
+    }
+
+    //! Get the id for a neighbor for a given particle index and the index of
+    //! the neighbor relative to the particle.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t getNeighbor( const list_type& list,
+                                    const std::size_t particle_index,
                                     const std::size_t neighbor_index )
     {
         return list._data.neighbors( list._data.offsets( particle_index ) +
@@ -826,18 +2271,65 @@ class NeighborList<
     }
 };
 
+//---------------------------------------------------------------------------//
+//! CompressedNeighborList NeighborList interface.
+template <class MemorySpace>
+class NeighborList<CompressedNeighborList<MemorySpace>>
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = MemorySpace;
+    //! Neighbor list type.
+    using list_type = CompressedNeighborList<MemorySpace>;
+
+    //! Get the total number of neighbors across all particles.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t totalNeighbor( const list_type& list )
+    {
+        return list.total_neighbors;
+    }
+
+    //! Get the maximum number of neighbors across all particles.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t maxNeighbor( const list_type& list )
+    {
+        std::size_t num_p = list.counts.size();
+        return Impl::maxNeighbor( list, num_p );
+    }
+
+    //! Get the number of neighbors for a given particle index.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t numNeighbor( const list_type& list,
+                                    const std::size_t particle_index )
+    {
+        return list.counts( particle_index );
+    }
+
+    //! Get the id for a neighbor for a given particle index and the index of
+    //! the neighbor relative to the particle.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t getNeighbor( const list_type& list,
+                                    const std::size_t particle_index,
+                                    const std::size_t neighbor_index )
+    {
+        return list.decode( particle_index, neighbor_index );
+    }
+};
+
 //---------------------------------------------------------------------------//
 //! 2D VerletList NeighborList interface.
-template <class MemorySpace, class AlgorithmTag, class BuildTag>
-class NeighborList<
-    VerletList<MemorySpace, AlgorithmTag, VerletLayout2D, BuildTag>>
+template <class MemorySpace, class AlgorithmTag, class BuildTag,
+          class BuildPrecision>
+class NeighborList<VerletList<MemorySpace, AlgorithmTag, VerletLayout2D,
+                              BuildTag, BuildPrecision>>
 {
   public:
     //! Kokkos memory space.
     using memory_space = MemorySpace;
     //! Neighbor list type.
     using list_type =
-        VerletList<MemorySpace, AlgorithmTag, VerletLayout2D, BuildTag>;
+        VerletList<MemorySpace, AlgorithmTag, VerletLayout2D, BuildTag,
+                   BuildPrecision>;
 
     //! Get the total number of neighbors across all particles.
     KOKKOS_INLINE_FUNCTION
@@ -874,6 +2366,101 @@ class NeighborList<
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Precompute periodic minimum-image shift codes for every neighbor
+  entry of a Verlet list.
+
+  \param exec_space Kokkos execution space.
+  \param list The Verlet list. Shift storage is allocated to match the
+  neighbor storage.
+  \param positions Particle positions the list was built with.
+  \param global_low Global domain lower corner in each dimension.
+  \param global_high Global domain upper corner in each dimension.
+  \param periodic Periodicity of each dimension.
+
+  The branchy minimum-image decision is paid once per pair at build time
+  and encoded in 2 bits per dimension (0: shift by -extent, 1: no shift,
+  2: shift by +extent); traversal applies the stored code with
+  applyImageShift() - two adds per dimension, no branches.
+*/
+template <class ExecutionSpace, class ListType, class PositionType>
+void computeImageShifts( ExecutionSpace exec_space, ListType& list,
+                         const PositionType& positions,
+                         const Kokkos::Array<double, 3> global_low,
+                         const Kokkos::Array<double, 3> global_high,
+                         const Kokkos::Array<bool, 3> periodic )
+{
+    Kokkos::Profiling::ScopedRegion region( "Cabana::computeImageShifts" );
+
+    using memory_space = typename ListType::memory_space;
+    static_assert( is_accessible_from<memory_space, ExecutionSpace>{}, "" );
+
+    auto& data = list._data;
+    if constexpr ( 2 == decltype( data.neighbors )::rank )
+        Kokkos::realloc( Kokkos::WithoutInitializing, data.shifts,
+                         data.neighbors.extent( 0 ),
+                         data.neighbors.extent( 1 ) );
+    else
+        Kokkos::realloc( Kokkos::WithoutInitializing, data.shifts,
+                         data.neighbors.extent( 0 ) );
+
+    Kokkos::Array<double, 3> extent;
+    for ( int d = 0; d < 3; ++d )
+        extent[d] = global_high[d] - global_low[d];
+
+    auto list_data = data;
+    Kokkos::parallel_for(
+        "Cabana::computeImageShifts",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0,
+                                             data.counts.extent( 0 ) ),
+        KOKKOS_LAMBDA( const int p ) {
+            for ( int n = 0; n < list_data.counts( p ); ++n )
+            {
+                int j;
+                if constexpr ( 2 == decltype( list_data.neighbors )::rank )
+                    j = list_data.neighbors( p, n );
+                else
+                    j = list_data.neighbors( list_data.offsets( p ) + n );
+                unsigned char code = 0;
+                for ( int d = 0; d < 3; ++d )
+                {
+                    unsigned char code_d = 1;
+                    if ( periodic[d] )
+                    {
+                        const double delta =
+                            positions( j, d ) - positions( p, d );
+                        if ( delta > 0.5 * extent[d] )
+                            code_d = 0;
+                        else if ( delta < -0.5 * extent[d] )
+                            code_d = 2;
+                    }
+                    code |= code_d << ( 2 * d );
+                }
+                list_data.setShift( p, n, code );
+            }
+        } );
+    Kokkos::fence();
+}
+
+/*!
+  \brief Apply a precomputed periodic image shift code to a neighbor
+  coordinate.
+
+  \param code Shift code from VerletListData::getShift().
+  \param extent Global domain extent in each dimension.
+  \param x Neighbor coordinates, shifted in place into the minimum image
+  frame of the central particle.
+*/
+KOKKOS_INLINE_FUNCTION
+void applyImageShift( const unsigned char code,
+                      const Kokkos::Array<double, 3>& extent, double x[3] )
+{
+    for ( int d = 0; d < 3; ++d )
+        x[d] += ( static_cast<int>( ( code >> ( 2 * d ) ) & 3 ) - 1 ) *
+                extent[d];
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Cabana
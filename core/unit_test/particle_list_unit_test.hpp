@@ -188,6 +188,44 @@ void particleViewTest( ListType plist )
     checkParticleListFinal( plist );
 }
 
+//---------------------------------------------------------------------------//
+template <class ListType>
+void injectionBufferTest( ListType plist )
+{
+    setParticleListTestData( plist );
+    auto old_size = plist.size();
+
+    // Stage new particles in the injection buffer.
+    std::size_t num_inject = 6;
+    auto buffer = Cabana::createInjectionBuffer( plist, num_inject );
+    Kokkos::parallel_for(
+        "inject", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_inject ),
+        KOKKOS_LAMBDA( const int ) {
+            typename ListType::particle_type particle;
+            for ( int d = 0; d < 3; ++d )
+                get( particle, Cabana::Field::Position<3>(), d ) = 1.23;
+            get( particle, Foo() ) = 3.3;
+            get( particle, CommRank() ) = 5;
+            for ( int i = 0; i < 3; ++i )
+                for ( int j = 0; j < 3; ++j )
+                    get( particle, Bar(), i, j ) = -1.2;
+            buffer.stage( particle );
+        } );
+    Kokkos::fence();
+    EXPECT_EQ( buffer.numStaged(), num_inject );
+
+    // List is unchanged until the staged particles are applied in one
+    // batched append.
+    EXPECT_EQ( plist.size(), old_size );
+    auto num_appended = buffer.apply( TEST_EXECSPACE{}, plist );
+    EXPECT_EQ( num_appended, num_inject );
+    EXPECT_EQ( plist.size(), old_size + num_inject );
+    EXPECT_EQ( buffer.numStaged(), 0 );
+
+    // All particles now hold the initial values.
+    checkParticleListInitial( plist );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
@@ -0,0 +1,155 @@
+/****************************************************************************
+ * Copyright (c) 2018-2023 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_Algorithms.hpp>
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_DeepCopy.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace Test
+{
+
+// Predicate selecting even indices.
+struct EvenPredicate
+{
+    KOKKOS_INLINE_FUNCTION
+    bool operator()( const int i ) const { return 0 == i % 2; }
+};
+
+// Predicate selecting nothing.
+struct NonePredicate
+{
+    KOKKOS_INLINE_FUNCTION
+    bool operator()( const int ) const { return false; }
+};
+
+void testSelect()
+{
+    int num_element = 100;
+
+    EXPECT_EQ(
+        Cabana::countSelected( TEST_EXECSPACE{}, EvenPredicate{},
+                               num_element ),
+        num_element / 2 );
+
+    auto indices = Cabana::selectIndices<TEST_MEMSPACE>(
+        TEST_EXECSPACE{}, EvenPredicate{}, num_element );
+    EXPECT_EQ( indices.extent( 0 ), num_element / 2 );
+    auto indices_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), indices );
+    for ( std::size_t j = 0; j < indices_host.extent( 0 ); ++j )
+        EXPECT_EQ( indices_host( j ), 2 * static_cast<int>( j ) );
+}
+
+void testPartition()
+{
+    int num_element = 100;
+
+    auto result = Cabana::partitionIndices<TEST_MEMSPACE>(
+        TEST_EXECSPACE{}, EvenPredicate{}, num_element );
+    auto indices = result.first;
+    int split = result.second;
+    EXPECT_EQ( split, num_element / 2 );
+    EXPECT_EQ( indices.extent( 0 ), num_element );
+
+    auto indices_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), indices );
+    for ( int j = 0; j < split; ++j )
+        EXPECT_EQ( indices_host( j ), 2 * j );
+    for ( int j = split; j < num_element; ++j )
+        EXPECT_EQ( indices_host( j ), 2 * ( j - split ) + 1 );
+}
+
+void testCompactSlice()
+{
+    int num_element = 100;
+    Cabana::AoSoA<Cabana::MemberTypes<int, double[2]>, TEST_MEMSPACE> src(
+        "src", num_element );
+    Cabana::AoSoA<Cabana::MemberTypes<int, double[2]>, TEST_MEMSPACE> dst(
+        "dst", num_element / 2 );
+
+    auto src_id = Cabana::slice<0>( src );
+    auto src_x = Cabana::slice<1>( src );
+    Kokkos::parallel_for(
+        "init", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_element ),
+        KOKKOS_LAMBDA( const int p ) {
+            src_id( p ) = p;
+            for ( int d = 0; d < 2; ++d )
+                src_x( p, d ) = p + d;
+        } );
+
+    auto indices = Cabana::selectIndices<TEST_MEMSPACE>(
+        TEST_EXECSPACE{}, EvenPredicate{}, num_element );
+    auto dst_id = Cabana::slice<0>( dst );
+    auto dst_x = Cabana::slice<1>( dst );
+    Cabana::compactSlice( TEST_EXECSPACE{}, dst_id, src_id, indices );
+    Cabana::compactSlice( TEST_EXECSPACE{}, dst_x, src_x, indices );
+
+    auto dst_host =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), dst );
+    auto dst_id_host = Cabana::slice<0>( dst_host );
+    auto dst_x_host = Cabana::slice<1>( dst_host );
+    for ( std::size_t j = 0; j < dst_host.size(); ++j )
+    {
+        EXPECT_EQ( dst_id_host( j ), 2 * static_cast<int>( j ) );
+        for ( int d = 0; d < 2; ++d )
+            EXPECT_DOUBLE_EQ( dst_x_host( j, d ), 2.0 * j + d );
+    }
+}
+
+void testCompact()
+{
+    int num_element = 200;
+    Cabana::AoSoA<Cabana::MemberTypes<int>, TEST_MEMSPACE> aosoa(
+        "compact", num_element );
+    auto id = Cabana::slice<0>( aosoa );
+    Kokkos::parallel_for(
+        "init", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_element ),
+        KOKKOS_LAMBDA( const int p ) { id( p ) = p; } );
+
+    int num_kept =
+        Cabana::compact( TEST_EXECSPACE{}, EvenPredicate{}, aosoa );
+    EXPECT_EQ( num_kept, num_element / 2 );
+    EXPECT_EQ( aosoa.size(), num_element / 2 );
+
+    // Every surviving element is even and appears once.
+    auto aosoa_host =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto id_host = Cabana::slice<0>( aosoa_host );
+    std::vector<int> found( num_element, 0 );
+    for ( std::size_t p = 0; p < aosoa_host.size(); ++p )
+    {
+        EXPECT_EQ( 0, id_host( p ) % 2 );
+        ++found[id_host( p )];
+    }
+    for ( int i = 0; i < num_element; i += 2 )
+        EXPECT_EQ( found[i], 1 );
+
+    // Compacting with nothing selected empties the container.
+    EXPECT_EQ( 0,
+               Cabana::compact( TEST_EXECSPACE{}, NonePredicate{}, aosoa ) );
+    EXPECT_EQ( aosoa.size(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, select_test ) { testSelect(); }
+TEST( TEST_CATEGORY, partition_test ) { testPartition(); }
+TEST( TEST_CATEGORY, compact_slice_test ) { testCompactSlice(); }
+TEST( TEST_CATEGORY, compact_test ) { testCompact(); }
+
+} // end namespace Test
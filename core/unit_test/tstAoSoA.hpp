@@ -603,6 +603,35 @@ void testUnmanaged()
     checkDataMembers( aosoa, fval, dval, ival, dim_1, dim_2, dim_3 );
 }
 
+//---------------------------------------------------------------------------//
+// Test amortized growth with an overallocation factor.
+void testOverallocation()
+{
+    const int vector_length = 16;
+    using DataTypes = Cabana::MemberTypes<double[3], int>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE, vector_length>;
+
+    AoSoA_t aosoa( "overalloc_aosoa" );
+    EXPECT_DOUBLE_EQ( aosoa.overallocation(), 1.0 );
+
+    // Growing with a factor of 2 should leave slack in the container.
+    aosoa.setOverallocation( 2.0 );
+    aosoa.resize( 100 );
+    EXPECT_EQ( aosoa.size(), 100 );
+    EXPECT_EQ( aosoa.capacity(), 208 );
+
+    // Fluctuating within the slack must not reallocate.
+    auto ptr = aosoa.data();
+    aosoa.resize( 60 );
+    aosoa.resize( 200 );
+    EXPECT_EQ( aosoa.size(), 200 );
+    EXPECT_EQ( aosoa.capacity(), 208 );
+    EXPECT_EQ( aosoa.data(), ptr );
+
+    // An overallocation factor less than one is not allowed.
+    EXPECT_THROW( aosoa.setOverallocation( 0.5 ), std::runtime_error );
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
@@ -620,6 +649,9 @@ TEST( AoSoA, Access ) { testAccess(); }
 //---------------------------------------------------------------------------//
 TEST( AoSoA, Unmanaged ) { testUnmanaged(); }
 
+//---------------------------------------------------------------------------//
+TEST( AoSoA, Overallocation ) { testOverallocation(); }
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
+
 #include <mpi.h>
 
 #include <algorithm>
@@ -625,6 +627,46 @@ TEST( CommPlan, Test7NoTopo ) { test7( false ); }
 
 TEST( CommPlan, TestTopology ) { testTopology(); }
 
+TEST( CommPlan, AggregatedExchange )
+{
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+    int my_size = -1;
+    MPI_Comm_size( MPI_COMM_WORLD, &my_size );
+
+    // Send a small tagged payload to every rank through the two-hop
+    // router.
+    std::vector<int> destinations( my_size );
+    std::vector<std::vector<char>> payloads( my_size );
+    for ( int r = 0; r < my_size; ++r )
+    {
+        destinations[r] = r;
+        int value = my_rank * 1000 + r;
+        payloads[r].resize( sizeof( int ) );
+        std::memcpy( payloads[r].data(), &value, sizeof( int ) );
+    }
+
+    std::vector<int> source_ranks;
+    std::vector<std::vector<char>> received;
+    Cabana::aggregatedExchange( MPI_COMM_WORLD, destinations, payloads,
+                                source_ranks, received );
+
+    // One payload from every rank, each carrying its sender and this
+    // destination.
+    EXPECT_EQ( source_ranks.size(), static_cast<std::size_t>( my_size ) );
+    std::vector<bool> found( my_size, false );
+    for ( std::size_t p = 0; p < received.size(); ++p )
+    {
+        int value = -1;
+        ASSERT_EQ( received[p].size(), sizeof( int ) );
+        std::memcpy( &value, received[p].data(), sizeof( int ) );
+        EXPECT_EQ( value, source_ranks[p] * 1000 + my_rank );
+        found[source_ranks[p]] = true;
+    }
+    for ( int r = 0; r < my_size; ++r )
+        EXPECT_TRUE( found[r] );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
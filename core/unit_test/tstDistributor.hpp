@@ -758,6 +758,53 @@ void test9( const bool use_topology )
 //---------------------------------------------------------------------------//
 TEST( Distributor, Test1 ) { test1( true ); }
 
+TEST( Distributor, ProtocolSelector )
+{
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank sends all data to itself.
+    int num_data = 10;
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks",
+                                                    num_data );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    std::vector<int> neighbor_ranks( 1, my_rank );
+    Cabana::Distributor<TEST_MEMSPACE> distributor(
+        MPI_COMM_WORLD, export_ranks, neighbor_ranks );
+
+    using DataTypes = Cabana::MemberTypes<int>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data_src( "src", num_data );
+    auto slice_int_src = Cabana::slice<0>( data_src );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) { slice_int_src( i ) = my_rank + i; } );
+    Kokkos::fence();
+
+    // Each candidate protocol is measured once, then the class is tuned;
+    // every trial must deliver identical results.
+    Cabana::ExchangeProtocolSelector selector;
+    const std::size_t bytes =
+        num_data * sizeof( typename AoSoA_t::tuple_type );
+    for ( int trial = 0; trial < 4; ++trial )
+    {
+        AoSoA_t data_dst( "dst", num_data );
+        Cabana::migrate( selector, distributor, data_src, data_dst );
+
+        Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_dst_host(
+            "data_dst_host", num_data );
+        Cabana::deep_copy( data_dst_host, data_dst );
+        auto slice_int_host = Cabana::slice<0>( data_dst_host );
+        auto steering = distributor.getExportSteering();
+        auto steering_host = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), steering );
+        for ( int i = 0; i < num_data; ++i )
+            EXPECT_EQ( slice_int_host( i ),
+                       my_rank + (int)steering_host( i ) );
+    }
+    EXPECT_TRUE( selector.tuned( bytes ) );
+}
+
 TEST( Distributor, Test2 ) { test2( true ); }
 
 TEST( Distributor, Test3 ) { test3( true ); }
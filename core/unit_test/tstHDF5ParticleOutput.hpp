@@ -186,6 +186,19 @@ void writeReadTest()
         coords.label(), time_read, coords_read );
     checkVector( coords_mirror, coords_read );
     EXPECT_DOUBLE_EQ( time, time_read );
+
+    // Balanced restart sizing: the per-rank shares sum to the global
+    // particle count in the file.
+    auto n_balanced =
+        Cabana::Experimental::HDF5ParticleOutput::balancedParticleCount(
+            "positions_only", MPI_COMM_WORLD, step, coords.label() );
+    long n_total = n_balanced;
+    MPI_Allreduce( MPI_IN_PLACE, &n_total, 1, MPI_LONG, MPI_SUM,
+                   MPI_COMM_WORLD );
+    long n_written = num_particle;
+    MPI_Allreduce( MPI_IN_PLACE, &n_written, 1, MPI_LONG, MPI_SUM,
+                   MPI_COMM_WORLD );
+    EXPECT_EQ( n_total, n_written );
 }
 
 //---------------------------------------------------------------------------//
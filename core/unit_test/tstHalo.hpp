@@ -486,6 +486,60 @@ void testHalo( TestTag tag, const bool use_topology )
     checkGatherSlice( tag, data_host, my_size, my_rank, num_local );
 }
 
+//---------------------------------------------------------------------------//
+// Modified-member re-gather test.
+template <class TestTag>
+void testHaloModified( TestTag tag, const bool use_topology )
+{
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+    int my_size = -1;
+    MPI_Comm_size( MPI_COMM_WORLD, &my_size );
+
+    // Make a communication plan.
+    int num_local = tag.num_local;
+    auto halo = createHalo( tag, use_topology, my_size, num_local );
+
+    // Create particle data and run the full gather epoch.
+    HaloData halo_data( *halo );
+    auto data = halo_data.createData( my_rank, num_local );
+    Cabana::gather( *halo, data );
+    auto data_host = halo_data.copyToHost();
+    checkGatherAoSoA( tag, data_host, my_size, my_rank, num_local );
+
+    // With nothing marked the re-gather is a no-op.
+    Cabana::gatherModified( *halo, data );
+
+    // Mark only the first member and re-gather: the ghosts track the
+    // owner change without a full multi-member exchange.
+    auto slice_int = Cabana::slice<0>( data );
+    Kokkos::parallel_for(
+        "modify_owned",
+        Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_local ),
+        KOKKOS_LAMBDA( const int p ) { slice_int( p ) += 10; } );
+    Kokkos::fence();
+    data.template markModified<0>();
+    Cabana::gatherModified( *halo, data );
+
+    auto updated_host = halo_data.copyToHost();
+    auto host_int = Cabana::slice<0>( updated_host );
+    auto host_dbl = Cabana::slice<1>( updated_host );
+    auto snapshot_int = Cabana::slice<0>( data_host );
+    auto snapshot_dbl = Cabana::slice<1>( data_host );
+    for ( std::size_t p = num_local; p < updated_host.size(); ++p )
+    {
+        // Ghosts of the marked member track the owner change.
+        EXPECT_EQ( host_int( p ), snapshot_int( p ) + 10 );
+        // Unmarked members are untouched.
+        EXPECT_DOUBLE_EQ( host_dbl( p, 0 ), snapshot_dbl( p, 0 ) );
+        EXPECT_DOUBLE_EQ( host_dbl( p, 1 ), snapshot_dbl( p, 1 ) );
+    }
+
+    // The flags were cleared by the re-gather.
+    for ( std::size_t m = 0; m < decltype( data )::number_of_members; ++m )
+        EXPECT_FALSE( data.modified( m ) );
+}
+
 //---------------------------------------------------------------------------//
 // Gather/scatter test with persistent buffers.
 template <class TestTag>
@@ -590,6 +644,7 @@ TEST( Halo, Unique )
 {
     testHalo( UniqueTestTag{}, true );
     testHaloBuffers( UniqueTestTag{}, true );
+    testHaloModified( UniqueTestTag{}, true );
 }
 
 TEST( Halo, UniqueNoTopo )
@@ -681,6 +681,179 @@ void testLinkedCellParallel()
                                      test_data.test_radius );
 }
 
+//---------------------------------------------------------------------------//
+void testLinkedCellColorParallel()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto positions = Cabana::slice<0>( test_data.aosoa );
+    // Create a full-range linked cell list.
+    double grid_size = test_data.cell_size_ratio * test_data.test_radius;
+    double grid_delta[3] = { grid_size, grid_size, grid_size };
+    auto nlist = Cabana::createLinkedCellList<TEST_MEMSPACE>(
+        positions, grid_delta, test_data.grid_min, test_data.grid_max,
+        test_data.test_radius, test_data.cell_size_ratio );
+
+    std::size_t num_particle = positions.size();
+    Kokkos::View<int*, TEST_MEMSPACE> color_result( "color_result",
+                                                    num_particle );
+    Kokkos::View<int*, TEST_MEMSPACE> full_result( "full_result",
+                                                   num_particle );
+    double c2 = test_data.test_radius * test_data.test_radius;
+
+    // The colored batches are conflict-free so both pair writes are
+    // intentionally non-atomic.
+    auto half_op = KOKKOS_LAMBDA( const int i, const int j )
+    {
+        const double dx = positions( i, 0 ) - positions( j, 0 );
+        const double dy = positions( i, 1 ) - positions( j, 1 );
+        const double dz = positions( i, 2 ) - positions( j, 2 );
+        if ( dx * dx + dy * dy + dz * dz <= c2 )
+        {
+            color_result( i ) += j;
+            color_result( j ) += i;
+        }
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> policy( 0, num_particle );
+    Cabana::neighbor_parallel_for( policy, half_op, nlist,
+                                   Cabana::FirstNeighborsTag(),
+                                   Cabana::ColorOpTag(), "test_color" );
+
+    // Compare against the full candidate traversal.
+    auto full_op = KOKKOS_LAMBDA( const int i, const int j )
+    {
+        const double dx = positions( i, 0 ) - positions( j, 0 );
+        const double dy = positions( i, 1 ) - positions( j, 1 );
+        const double dz = positions( i, 2 ) - positions( j, 2 );
+        if ( i != j && dx * dx + dy * dy + dz * dz <= c2 )
+            Kokkos::atomic_add( &full_result( i ), j );
+    };
+    Cabana::neighbor_parallel_for( policy, full_op, nlist,
+                                   Cabana::FirstNeighborsTag(),
+                                   Cabana::SerialOpTag(), "test_full" );
+    Kokkos::fence();
+
+    auto color_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                             color_result );
+    auto full_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                             full_result );
+    for ( std::size_t p = 0; p < num_particle; ++p )
+        EXPECT_EQ( color_mirror( p ), full_mirror( p ) );
+}
+
+//---------------------------------------------------------------------------//
+void testLinkedCellScratchParallel()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto positions = Cabana::slice<0>( test_data.aosoa );
+    // Create a full-range linked cell list.
+    double grid_size = test_data.cell_size_ratio * test_data.test_radius;
+    double grid_delta[3] = { grid_size, grid_size, grid_size };
+    auto nlist = Cabana::createLinkedCellList<TEST_MEMSPACE>(
+        positions, grid_delta, test_data.grid_min, test_data.grid_max,
+        test_data.test_radius, test_data.cell_size_ratio );
+
+    std::size_t num_particle = positions.size();
+    Kokkos::View<int*, TEST_MEMSPACE> scratch_result( "scratch_result",
+                                                      num_particle );
+    Kokkos::View<int*, TEST_MEMSPACE> serial_result( "serial_result",
+                                                     num_particle );
+    double c2 = test_data.test_radius * test_data.test_radius;
+
+    // Compute distances from the staged candidate coordinates.
+    auto scratch_op = KOKKOS_LAMBDA( const int i, const int j, const double xj,
+                                     const double yj, const double zj )
+    {
+        const double dx = positions( i, 0 ) - xj;
+        const double dy = positions( i, 1 ) - yj;
+        const double dz = positions( i, 2 ) - zj;
+        if ( i != j && dx * dx + dy * dy + dz * dz <= c2 )
+            Kokkos::atomic_add( &scratch_result( i ), j );
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> policy( 0, num_particle );
+    Cabana::neighbor_parallel_for(
+        policy, scratch_op, nlist, positions, Cabana::FirstNeighborsTag(),
+        Cabana::TeamScratchOpTag(), "test_scratch" );
+
+    auto serial_op = KOKKOS_LAMBDA( const int i, const int j )
+    {
+        const double dx = positions( i, 0 ) - positions( j, 0 );
+        const double dy = positions( i, 1 ) - positions( j, 1 );
+        const double dz = positions( i, 2 ) - positions( j, 2 );
+        if ( i != j && dx * dx + dy * dy + dz * dz <= c2 )
+            Kokkos::atomic_add( &serial_result( i ), j );
+    };
+    Cabana::neighbor_parallel_for( policy, serial_op, nlist,
+                                   Cabana::FirstNeighborsTag(),
+                                   Cabana::SerialOpTag(), "test_serial" );
+    Kokkos::fence();
+
+    auto scratch_mirror = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), scratch_result );
+    auto serial_mirror = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), serial_result );
+    for ( std::size_t p = 0; p < num_particle; ++p )
+        EXPECT_EQ( scratch_mirror( p ), serial_mirror( p ) );
+}
+
+//---------------------------------------------------------------------------//
+void testBinParallel()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto positions = Cabana::slice<0>( test_data.aosoa );
+    // Create a full-range linked cell list.
+    double grid_size = test_data.cell_size_ratio * test_data.test_radius;
+    double grid_delta[3] = { grid_size, grid_size, grid_size };
+    auto nlist = Cabana::createLinkedCellList<TEST_MEMSPACE>(
+        positions, grid_delta, test_data.grid_min, test_data.grid_max,
+        test_data.test_radius, test_data.cell_size_ratio );
+
+    std::size_t num_particle = positions.size();
+    Kokkos::View<int*, TEST_MEMSPACE> bin_result( "bin_result",
+                                                  num_particle );
+    Kokkos::View<int*, TEST_MEMSPACE> serial_result( "serial_result",
+                                                     num_particle );
+    double c2 = test_data.test_radius * test_data.test_radius;
+
+    // Compute distances from the staged candidate coordinates.
+    auto bin_op = KOKKOS_LAMBDA( const int i, const int j, const double xj,
+                                 const double yj, const double zj )
+    {
+        const double dx = positions( i, 0 ) - xj;
+        const double dy = positions( i, 1 ) - yj;
+        const double dz = positions( i, 2 ) - zj;
+        if ( dx * dx + dy * dy + dz * dz <= c2 )
+            Kokkos::atomic_add( &bin_result( i ), j );
+    };
+    Cabana::bin_parallel_for( TEST_EXECSPACE{}, bin_op, nlist, positions,
+                              "test_bin" );
+
+    auto serial_op = KOKKOS_LAMBDA( const int i, const int j )
+    {
+        const double dx = positions( i, 0 ) - positions( j, 0 );
+        const double dy = positions( i, 1 ) - positions( j, 1 );
+        const double dz = positions( i, 2 ) - positions( j, 2 );
+        if ( i != j && dx * dx + dy * dy + dz * dz <= c2 )
+            Kokkos::atomic_add( &serial_result( i ), j );
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> policy( 0, num_particle );
+    Cabana::neighbor_parallel_for( policy, serial_op, nlist,
+                                   Cabana::FirstNeighborsTag(),
+                                   Cabana::SerialOpTag(), "test_serial" );
+    Kokkos::fence();
+
+    auto bin_mirror = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                           bin_result );
+    auto serial_mirror = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), serial_result );
+    for ( std::size_t p = 0; p < num_particle; ++p )
+        EXPECT_EQ( bin_mirror( p ), serial_mirror( p ) );
+}
+
 //---------------------------------------------------------------------------//
 void testLinkedCellReduce()
 {
@@ -781,6 +954,12 @@ TEST( LinkedCellList, Neighbor ) { testLinkedCellNeighborInterface(); }
 
 TEST( LinkedCellList, ParallelFor ) { testLinkedCellParallel(); }
 
+TEST( LinkedCellList, ColorParallelFor ) { testLinkedCellColorParallel(); }
+
+TEST( LinkedCellList, ScratchParallelFor ) { testLinkedCellScratchParallel(); }
+
+TEST( LinkedCellList, BinParallelFor ) { testBinParallel(); }
+
 TEST( LinkedCellList, ParallelReduce ) { testLinkedCellReduce(); }
 
 //---------------------------------------------------------------------------//
@@ -175,6 +175,65 @@ void testNeighborParallelFor()
                                            test_data.num_particle, false );
 }
 
+//---------------------------------------------------------------------------//
+template <class LayoutTag>
+void testFilteredParallelFor()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+
+    // Create the neighbor list.
+    using ListType = Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag,
+                                        LayoutTag, Cabana::TeamOpTag>;
+    ListType nlist( position, 0, position.size(), test_data.test_radius,
+                    test_data.cell_size_ratio, test_data.grid_min,
+                    test_data.grid_max );
+
+    std::size_t num_particle = position.size();
+    Kokkos::View<int*, TEST_MEMSPACE> filtered_result( "filtered_result",
+                                                       num_particle );
+    Kokkos::View<int*, TEST_MEMSPACE> serial_result( "serial_result",
+                                                     num_particle );
+
+    // Use a force cutoff inside the list radius so the pre-filter actually
+    // drops pairs.
+    double cutoff = 0.8 * test_data.test_radius;
+    double c2 = cutoff * cutoff;
+
+    // The filtered traversal only sees pairs inside the cutoff.
+    auto filtered_op = KOKKOS_LAMBDA( const int i, const int j )
+    {
+        Kokkos::atomic_add( &filtered_result( i ), j );
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> policy( 0, num_particle );
+    Cabana::neighbor_parallel_for( policy, filtered_op, nlist,
+                                   Cabana::FirstNeighborsTag(),
+                                   Cabana::TeamVectorOpTag(), position, cutoff,
+                                   "test_filtered" );
+
+    // Reference: serial traversal with the cutoff applied in the functor.
+    auto serial_op = KOKKOS_LAMBDA( const int i, const int j )
+    {
+        const double dx = position( i, 0 ) - position( j, 0 );
+        const double dy = position( i, 1 ) - position( j, 1 );
+        const double dz = position( i, 2 ) - position( j, 2 );
+        if ( dx * dx + dy * dy + dz * dz <= c2 )
+            Kokkos::atomic_add( &serial_result( i ), j );
+    };
+    Cabana::neighbor_parallel_for( policy, serial_op, nlist,
+                                   Cabana::FirstNeighborsTag(),
+                                   Cabana::SerialOpTag(), "test_serial" );
+    Kokkos::fence();
+
+    auto filtered_mirror = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), filtered_result );
+    auto serial_mirror = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), serial_result );
+    for ( std::size_t p = 0; p < num_particle; ++p )
+        EXPECT_EQ( filtered_mirror( p ), serial_mirror( p ) );
+}
+
 //---------------------------------------------------------------------------//
 template <class LayoutTag>
 void testNeighborParallelReduce()
@@ -246,6 +305,89 @@ void testModifyNeighbors()
     }
 }
 
+//---------------------------------------------------------------------------//
+template <class LayoutTag>
+void testFloatBuildPrecision()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+
+    // Build with single-precision distance math. The skin-free test data
+    // is far from any cutoff boundary, so the list must be identical to
+    // the exact N^2 reference.
+    using ListType =
+        Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag, LayoutTag,
+                           Cabana::TeamOpTag, Cabana::FloatBuildPrecision>;
+    ListType nlist( position, 0, position.size(), test_data.test_radius,
+                    test_data.cell_size_ratio, test_data.grid_min,
+                    test_data.grid_max );
+
+    checkFullNeighborList( nlist, test_data.N2_list_copy,
+                           test_data.num_particle );
+}
+
+//---------------------------------------------------------------------------//
+template <class LayoutTag>
+void testImageShifts()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+
+    // Create the neighbor list.
+    using ListType = Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag,
+                                        LayoutTag, Cabana::TeamOpTag>;
+    ListType nlist( position, 0, position.size(), test_data.test_radius,
+                    test_data.cell_size_ratio, test_data.grid_min,
+                    test_data.grid_max );
+
+    // Precompute shift codes with a periodic box. All pairs found by the
+    // build are interior, so every code is the identity shift.
+    Kokkos::Array<double, 3> global_low = { test_data.grid_min[0],
+                                            test_data.grid_min[1],
+                                            test_data.grid_min[2] };
+    Kokkos::Array<double, 3> global_high = { test_data.grid_max[0],
+                                             test_data.grid_max[1],
+                                             test_data.grid_max[2] };
+    Kokkos::Array<bool, 3> periodic = { true, true, true };
+    Cabana::computeImageShifts( TEST_EXECSPACE{}, nlist, position, global_low,
+                                global_high, periodic );
+
+    const unsigned char identity = 1 | ( 1 << 2 ) | ( 1 << 4 );
+    int wrong = 0;
+    auto list = nlist;
+    Kokkos::parallel_reduce(
+        "check_shifts",
+        Kokkos::RangePolicy<TEST_EXECSPACE>( 0, position.size() ),
+        KOKKOS_LAMBDA( const int i, int& update ) {
+            for ( std::size_t n = 0;
+                  n < Cabana::NeighborList<ListType>::numNeighbor( list, i );
+                  ++n )
+                if ( list._data.getShift( i, n ) != identity )
+                    ++update;
+        },
+        wrong );
+    EXPECT_EQ( wrong, 0 );
+
+    // The identity code leaves coordinates unchanged; a wrapped code
+    // shifts by the domain extent with no branches.
+    Kokkos::Array<double, 3> extent = { global_high[0] - global_low[0],
+                                        global_high[1] - global_low[1],
+                                        global_high[2] - global_low[2] };
+    double x[3] = { 1.0, 2.0, 3.0 };
+    Cabana::applyImageShift( identity, extent, x );
+    EXPECT_DOUBLE_EQ( x[0], 1.0 );
+    EXPECT_DOUBLE_EQ( x[1], 2.0 );
+    EXPECT_DOUBLE_EQ( x[2], 3.0 );
+
+    const unsigned char wrapped = 0 | ( 1 << 2 ) | ( 2 << 4 );
+    Cabana::applyImageShift( wrapped, extent, x );
+    EXPECT_DOUBLE_EQ( x[0], 1.0 - extent[0] );
+    EXPECT_DOUBLE_EQ( x[1], 2.0 );
+    EXPECT_DOUBLE_EQ( x[2], 3.0 + extent[2] );
+}
+
 //---------------------------------------------------------------------------//
 template <class LayoutTag>
 void testNeighborView()
@@ -332,6 +474,169 @@ void testNeighborHistogram()
     }
 }
 
+//---------------------------------------------------------------------------//
+template <class LayoutTag, class BuildTag>
+void testVerletListManager()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+
+    // Manage a list built with the test radius plus a skin.
+    using ListType = Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag,
+                                        LayoutTag, BuildTag>;
+    double skin = 0.1 * test_data.test_radius;
+    auto manager = Cabana::createVerletListManager<ListType>(
+        position, std::size_t( 0 ), std::size_t( position.size() ),
+        test_data.test_radius, skin, test_data.cell_size_ratio,
+        test_data.grid_min, test_data.grid_max );
+
+    // The extended list must contain at least the exact-cutoff neighbors.
+    auto list_copy = copyListToHost( manager.list(), test_data.num_particle,
+                                     test_data.num_particle );
+    for ( std::size_t p = 0; p < std::size_t( test_data.num_particle ); ++p )
+    {
+        EXPECT_GE( list_copy.counts( p ), test_data.N2_list_copy.counts( p ) );
+        for ( int n = 0; n < test_data.N2_list_copy.counts( p ); ++n )
+        {
+            bool found = false;
+            for ( int m = 0; m < list_copy.counts( p ); ++m )
+                if ( list_copy.neighbors( p, m ) ==
+                     test_data.N2_list_copy.neighbors( p, n ) )
+                    found = true;
+            EXPECT_TRUE( found );
+        }
+    }
+
+    // Unmoved particles must not trigger a rebuild.
+    EXPECT_FALSE( manager.update( position ) );
+    EXPECT_EQ( manager.stepsSinceRebuild(), 1 );
+
+    // Move one particle by more than half the skin to force a rebuild.
+    Kokkos::parallel_for(
+        "move_particle", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, 1 ),
+        KOKKOS_LAMBDA( const int ) { position( 0, 0 ) += skin; } );
+    Kokkos::fence();
+    EXPECT_TRUE( manager.needsRebuild( position ) );
+    EXPECT_TRUE( manager.update( position ) );
+    EXPECT_EQ( manager.stepsSinceRebuild(), 0 );
+
+    // Bounding-motion certificates: with zero velocities the list is
+    // provably valid indefinitely and certified steps skip the check.
+    Kokkos::View<double* [3], TEST_MEMSPACE> velocity( "velocity",
+                                                       position.size() );
+    EXPECT_GT( manager.certifySteps( velocity, 1.0e-3 ), 0 );
+    EXPECT_FALSE( manager.update( position, velocity, 1.0e-3 ) );
+    EXPECT_GT( manager.certifiedSteps(), 0 );
+
+    // A velocity bound crossing half the skin per step exhausts the
+    // certificate immediately; the exact check still passes for unmoved
+    // particles.
+    Kokkos::deep_copy( velocity, skin );
+    EXPECT_EQ( manager.certifySteps( velocity, 1.0 ), 0 );
+    EXPECT_FALSE( manager.update( position, velocity, 1.0 ) );
+}
+
+//---------------------------------------------------------------------------//
+template <class LayoutTag, class BuildTag>
+void testVerletListPrebuiltBinning()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+
+    // Create the linked cell list that would be shared with sorting and
+    // cell traversal.
+    double grid_size = test_data.cell_size_ratio * test_data.test_radius;
+    double grid_delta[3] = { grid_size, grid_size, grid_size };
+    auto lcl = Cabana::createLinkedCellList<TEST_MEMSPACE>(
+        position, grid_delta, test_data.grid_min, test_data.grid_max,
+        test_data.test_radius, test_data.cell_size_ratio );
+
+    // Build the neighbor list from the existing binning.
+    Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag, LayoutTag,
+                       BuildTag>
+        nlist;
+    nlist.build( position, 0, position.size(), lcl, test_data.test_radius );
+
+    checkFullNeighborList( nlist, test_data.N2_list_copy,
+                           test_data.num_particle );
+}
+
+//---------------------------------------------------------------------------//
+template <class LayoutTag>
+void testFusedNeighborReduce()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+
+    // Create the neighbor list.
+    Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag, LayoutTag,
+                       Cabana::TeamOpTag>
+        nlist( position, 0, position.size(), test_data.test_radius,
+               test_data.cell_size_ratio, test_data.grid_min,
+               test_data.grid_max );
+
+    Kokkos::RangePolicy<TEST_EXECSPACE> policy( 0, position.size() );
+
+    // Reduce two quantities in a single traversal.
+    auto fused_op = KOKKOS_LAMBDA( const int i, const int j,
+                                   Cabana::ReduceArray<double, 2>& sum )
+    {
+        sum[0] += 1.0;
+        sum[1] += position( i, 0 ) + position( j, 0 );
+    };
+    Cabana::ReduceArray<double, 2> fused_sum;
+    Cabana::neighbor_parallel_reduce(
+        policy, fused_op, nlist, Cabana::FirstNeighborsTag(),
+        Cabana::SerialOpTag(), fused_sum, "test_fused" );
+    Kokkos::fence();
+
+    // Compare against separate scalar reductions.
+    auto count_op = KOKKOS_LAMBDA( const int, const int, double& sum )
+    {
+        sum += 1.0;
+    };
+    auto pos_op = KOKKOS_LAMBDA( const int i, const int j, double& sum )
+    {
+        sum += position( i, 0 ) + position( j, 0 );
+    };
+    double count_sum = 0.0;
+    double pos_sum = 0.0;
+    Cabana::neighbor_parallel_reduce( policy, count_op, nlist,
+                                      Cabana::FirstNeighborsTag(),
+                                      Cabana::SerialOpTag(), count_sum );
+    Cabana::neighbor_parallel_reduce( policy, pos_op, nlist,
+                                      Cabana::FirstNeighborsTag(),
+                                      Cabana::SerialOpTag(), pos_sum );
+    Kokkos::fence();
+
+    EXPECT_DOUBLE_EQ( fused_sum[0], count_sum );
+    EXPECT_DOUBLE_EQ( fused_sum[1], pos_sum );
+}
+
+//---------------------------------------------------------------------------//
+template <class BuildTag>
+void testCompressedNeighborList()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+
+    // Create the CSR neighbor list and compress it.
+    Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag,
+                       Cabana::VerletLayoutCSR, BuildTag>
+        nlist( position, 0, position.size(), test_data.test_radius,
+               test_data.cell_size_ratio, test_data.grid_min,
+               test_data.grid_max );
+    auto compressed = Cabana::createCompressedNeighborList( nlist );
+
+    // The decoded list must match the N2 list exactly.
+    checkFullNeighborList( compressed, test_data.N2_list_copy,
+                           test_data.num_particle );
+}
+
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
@@ -379,6 +684,42 @@ TEST( VerletList, FullRange )
                                    Cabana::TeamVectorOpTag>();
 }
 
+//---------------------------------------------------------------------------//
+TEST( VerletList, PrebuiltBinning )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testVerletListPrebuiltBinning<Cabana::VerletLayoutCSR,
+                                  Cabana::TeamOpTag>();
+#endif
+    testVerletListPrebuiltBinning<Cabana::VerletLayout2D, Cabana::TeamOpTag>();
+}
+
+//---------------------------------------------------------------------------//
+TEST( VerletList, FusedReduce )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testFusedNeighborReduce<Cabana::VerletLayoutCSR>();
+#endif
+    testFusedNeighborReduce<Cabana::VerletLayout2D>();
+}
+
+//---------------------------------------------------------------------------//
+TEST( VerletList, Compressed )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testCompressedNeighborList<Cabana::TeamOpTag>();
+#endif
+}
+
+//---------------------------------------------------------------------------//
+TEST( VerletList, Manager )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testVerletListManager<Cabana::VerletLayoutCSR, Cabana::TeamOpTag>();
+#endif
+    testVerletListManager<Cabana::VerletLayout2D, Cabana::TeamOpTag>();
+}
+
 //---------------------------------------------------------------------------//
 TEST( VerletList, ParallelFor )
 {
@@ -414,6 +755,30 @@ TEST( VerletList, NeighborHistogram )
 #endif
     testNeighborHistogram<Cabana::VerletLayout2D>();
 }
+TEST( VerletList, FilteredParallelFor )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET
+    testFilteredParallelFor<Cabana::VerletLayoutCSR>();
+#endif
+    testFilteredParallelFor<Cabana::VerletLayout2D>();
+}
+
+TEST( VerletList, FloatBuildPrecision )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET
+    testFloatBuildPrecision<Cabana::VerletLayoutCSR>();
+#endif
+    testFloatBuildPrecision<Cabana::VerletLayout2D>();
+}
+
+TEST( VerletList, ImageShifts )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET
+    testImageShifts<Cabana::VerletLayoutCSR>();
+#endif
+    testImageShifts<Cabana::VerletLayout2D>();
+}
+
 TEST( TEST_CATEGORY, view_test )
 {
 #ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
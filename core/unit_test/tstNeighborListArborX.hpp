@@ -289,9 +289,33 @@ void testNeighborArborXParallelReduce()
 
 //---------------------------------------------------------------------------//
 // TESTS
+//---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+void testArborXListAsync()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+
+    // Build asynchronously and poll until complete.
+    auto future = Cabana::Experimental::makeNeighborListAsync(
+        TEST_EXECSPACE{}, Cabana::FullNeighborTag{}, position, 0,
+        position.size(), test_data.test_radius );
+    while ( !future.test() )
+    {
+    }
+
+    // The completed list matches the synchronous build.
+    auto const& nlist = future.get();
+    checkFullNeighborList( nlist, test_data.N2_list_copy,
+                           test_data.num_particle );
+}
+
 //---------------------------------------------------------------------------//
 TEST( ArborXList, Full ) { testArborXListFull(); }
 
+TEST( ArborXList, Async ) { testArborXListAsync(); }
+
 //---------------------------------------------------------------------------//
 TEST( ArborXList, Half ) { testArborXListHalf(); }
 
@@ -247,11 +247,112 @@ void runTest2d()
                       ival / 2.0, dim_1, dim_2, dim_3 );
 }
 
+//---------------------------------------------------------------------------//
+// Device functors for the persistent-step drivers.
+struct PersistentStepFunctor
+{
+    Kokkos::View<double*, TEST_MEMSPACE> data;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()( const int, const int i ) const { data( i ) += 1.0; }
+};
+
+struct PersistentDoneFunctor
+{
+    int last_step;
+
+    KOKKOS_INLINE_FUNCTION
+    bool operator()( const int step ) const { return step >= last_step; }
+};
+
+void runTestPersistent()
+{
+    int num_element = 1000;
+    Kokkos::View<double*, TEST_MEMSPACE> data( "data", num_element );
+
+    // All steps run inside one launch.
+    int num_steps = 10;
+    Cabana::persistent_step_parallel_for(
+        TEST_EXECSPACE{}, num_element, num_steps,
+        PersistentStepFunctor{ data } );
+    Kokkos::fence();
+
+    auto data_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), data );
+    for ( int i = 0; i < num_element; ++i )
+        EXPECT_DOUBLE_EQ( data_host( i ), num_steps );
+
+    // Device-side stop condition ends the loop early.
+    Kokkos::deep_copy( data, 0.0 );
+    Cabana::persistent_step_parallel_for(
+        TEST_EXECSPACE{}, num_element, num_steps,
+        PersistentStepFunctor{ data }, PersistentDoneFunctor{ 4 } );
+    Kokkos::fence();
+
+    Kokkos::deep_copy( data_host, data );
+    for ( int i = 0; i < num_element; ++i )
+        EXPECT_DOUBLE_EQ( data_host( i ), 5.0 );
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
 TEST( SimdParallel, ParallelFor ) { runTest2d(); }
 
+TEST( SimdParallel, PersistentStep ) { runTestPersistent(); }
+
+TEST( SimdParallel, TaskGraph )
+{
+    int num_element = 100;
+    Kokkos::View<double*, TEST_MEMSPACE> a( "a", num_element );
+    Kokkos::View<double*, TEST_MEMSPACE> b( "b", num_element );
+    Kokkos::View<double*, TEST_MEMSPACE> c( "c", num_element );
+
+    // Two independent fills feeding a dependent sum.
+    Cabana::TaskGraph<TEST_EXECSPACE> graph( 2 );
+    auto fill_a = graph.addTask(
+        [=]( const TEST_EXECSPACE& exec_space ) {
+            Kokkos::parallel_for(
+                "fill_a",
+                Kokkos::RangePolicy<TEST_EXECSPACE>( exec_space, 0,
+                                                     num_element ),
+                KOKKOS_LAMBDA( const int i ) { a( i ) = 1.0; } );
+        } );
+    auto fill_b = graph.addTask(
+        [=]( const TEST_EXECSPACE& exec_space ) {
+            Kokkos::parallel_for(
+                "fill_b",
+                Kokkos::RangePolicy<TEST_EXECSPACE>( exec_space, 0,
+                                                     num_element ),
+                KOKKOS_LAMBDA( const int i ) { b( i ) = 2.0; } );
+        } );
+    auto sum = graph.addTask(
+        [=]( const TEST_EXECSPACE& exec_space ) {
+            Kokkos::parallel_for(
+                "sum",
+                Kokkos::RangePolicy<TEST_EXECSPACE>( exec_space, 0,
+                                                     num_element ),
+                KOKKOS_LAMBDA( const int i ) { c( i ) = a( i ) + b( i ); } );
+        },
+        { fill_a, fill_b } );
+
+    EXPECT_EQ( graph.numTasks(), 3 );
+    EXPECT_EQ( graph.taskLevel( fill_a ), 0 );
+    EXPECT_EQ( graph.taskLevel( fill_b ), 0 );
+    EXPECT_EQ( graph.taskLevel( sum ), 1 );
+
+    graph.execute();
+
+    auto c_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), c );
+    for ( int i = 0; i < num_element; ++i )
+        EXPECT_DOUBLE_EQ( c_host( i ), 3.0 );
+
+    // Unknown dependencies are rejected.
+    EXPECT_THROW( graph.addTask( []( const TEST_EXECSPACE& ) {}, { 99 } ),
+                  std::logic_error );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
@@ -43,6 +43,16 @@ TEST( ParticleList, ParticleView )
     particleViewTest( plist );
 }
 
+TEST( ParticleList, InjectionBuffer )
+{
+    auto fields = Cabana::ParticleTraits<Cabana::Field::Position<3>, Foo,
+                                         CommRank, Bar>();
+    auto plist =
+        Cabana::createParticleList<TEST_MEMSPACE>( "test_particles", fields );
+
+    injectionBufferTest( plist );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
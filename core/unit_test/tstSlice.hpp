@@ -355,6 +355,101 @@ TEST( Slice, RandomAccess ) { randomAccessTest(); }
 //---------------------------------------------------------------------------//
 TEST( Slice, AtomicAccess ) { atomicAccessTest(); }
 
+TEST( Slice, TeamStagedBlocks )
+{
+    // Stage a slice through scratch in double-buffered blocks and
+    // accumulate it; the result must match a direct sum.
+    int num_particle = 1000;
+    Cabana::AoSoA<Cabana::MemberTypes<double[2]>, TEST_MEMSPACE> aosoa(
+        "staged", num_particle );
+    auto slice = Cabana::slice<0>( aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_particle ),
+        KOKKOS_LAMBDA( const int p ) {
+            for ( int d = 0; d < 2; ++d )
+                slice( p, d ) = p + 0.5 * d;
+        } );
+
+    using team_policy = Kokkos::TeamPolicy<TEST_EXECSPACE>;
+    using scratch_view = Kokkos::View<double**,
+                                      TEST_EXECSPACE::scratch_memory_space,
+                                      Kokkos::MemoryUnmanaged>;
+    int block_size = 64;
+    std::size_t scratch_size = 2 * scratch_view::shmem_size( block_size, 2 );
+    auto policy = team_policy( 1, Kokkos::AUTO )
+                      .set_scratch_size( 0, Kokkos::PerTeam( scratch_size ) );
+
+    Kokkos::View<double, TEST_MEMSPACE> sum( "sum" );
+    Kokkos::parallel_for(
+        "staged_sum", policy,
+        KOKKOS_LAMBDA( const typename team_policy::member_type& team ) {
+            scratch_view buffer_a( team.team_scratch( 0 ), block_size, 2 );
+            scratch_view buffer_b( team.team_scratch( 0 ), block_size, 2 );
+            Cabana::teamDoubleBufferedApply(
+                team, buffer_a, buffer_b, slice, 0, num_particle,
+                [&]( const scratch_view& block, const std::size_t,
+                     const std::size_t n_block ) {
+                    double block_sum = 0.0;
+                    Kokkos::parallel_reduce(
+                        Kokkos::TeamVectorRange( team, n_block ),
+                        [&]( const std::size_t n, double& update ) {
+                            update += block( n, 0 ) + block( n, 1 );
+                        },
+                        block_sum );
+                    Kokkos::single( Kokkos::PerTeam( team ), [&]() {
+                        sum() += block_sum;
+                    } );
+                } );
+        } );
+    Kokkos::fence();
+
+    auto sum_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), sum );
+    double expected = 0.0;
+    for ( int p = 0; p < num_particle; ++p )
+        expected += 2.0 * p + 0.5;
+    EXPECT_DOUBLE_EQ( sum_host(), expected );
+}
+
+TEST( Slice, UnmanagedAlias )
+{
+    // An externally-owned contiguous device array aliases into a slice
+    // with zero copies.
+    int num_particle = 100;
+    Kokkos::View<double* [3], Kokkos::LayoutRight, TEST_MEMSPACE> external(
+        "external", num_particle );
+    Kokkos::parallel_for(
+        "fill_external",
+        Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_particle ),
+        KOKKOS_LAMBDA( const int p ) {
+            for ( int d = 0; d < 3; ++d )
+                external( p, d ) = p + 0.1 * d;
+        } );
+
+    auto slice = Cabana::makeUnmanagedSlice( external, "alias" );
+    EXPECT_EQ( slice.size(), num_particle );
+
+    // Writes through the slice land in the external buffer.
+    Kokkos::parallel_for(
+        "write_slice", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_particle ),
+        KOKKOS_LAMBDA( const int p ) { slice( p, 1 ) += 100.0; } );
+
+    auto external_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), external );
+    for ( int p = 0; p < num_particle; ++p )
+    {
+        EXPECT_DOUBLE_EQ( external_host( p, 0 ), p );
+        EXPECT_DOUBLE_EQ( external_host( p, 1 ), p + 0.1 + 100.0 );
+        EXPECT_DOUBLE_EQ( external_host( p, 2 ), p + 0.2 );
+    }
+
+    // Rank-1 scalar member alias.
+    Kokkos::View<double*, TEST_MEMSPACE> scalar_external( "scalar",
+                                                          num_particle );
+    auto scalar_slice = Cabana::makeUnmanagedSlice( scalar_external );
+    EXPECT_EQ( scalar_slice.size(), num_particle );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
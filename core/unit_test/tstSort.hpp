@@ -16,6 +16,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <set>
+
 namespace Test
 {
 //---------------------------------------------------------------------------//
@@ -707,6 +710,163 @@ void testSortByKeySlice()
     }
 }
 
+//---------------------------------------------------------------------------//
+void testSortByKeyInPlace()
+{
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<double[3], int>;
+
+    // Declare the AoSoA type.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+
+    // Create an AoSoA.
+    int num_data = 3453;
+    AoSoA_t aosoa( "aosoa", num_data );
+
+    // Create a Kokkos view for the keys.
+    using KeyViewType = Kokkos::View<int*, typename AoSoA_t::memory_space>;
+    KeyViewType keys( "keys", num_data );
+
+    // Create the AoSoA data and keys. Create the data in reverse order so we
+    // can see that it is sorted.
+    auto v0 = Cabana::slice<0>( aosoa );
+    auto v1 = Cabana::slice<1>( aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            int reverse_index = aosoa.size() - p - 1;
+
+            for ( int i = 0; i < 3; ++i )
+                v0( p, i ) = reverse_index + i;
+
+            v1( p ) = reverse_index;
+
+            keys( p ) = reverse_index;
+        } );
+
+    // Sort the aosoa by keys with the in-place cycle-following permutation.
+    auto binning_data = Cabana::sortByKey( keys );
+    Cabana::permute( binning_data, aosoa, Cabana::InPlacePermuteTag() );
+
+    // Check the result of the sort.
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto v0_mirror = Cabana::slice<0>( mirror );
+    auto v1_mirror = Cabana::slice<1>( mirror );
+    for ( std::size_t p = 0; p < aosoa.size(); ++p )
+    {
+        for ( int i = 0; i < 3; ++i )
+            EXPECT_EQ( v0_mirror( p, i ), p + i );
+
+        EXPECT_EQ( v1_mirror( p ), p );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testSortByKeyRadix()
+{
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<double[3], int>;
+
+    // Declare the AoSoA type.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+
+    // Create an AoSoA.
+    int num_data = 3453;
+    AoSoA_t aosoa( "aosoa", num_data );
+
+    // Create a Kokkos view for the keys.
+    using KeyViewType = Kokkos::View<int*, typename AoSoA_t::memory_space>;
+    KeyViewType keys( "keys", num_data );
+
+    // Create the AoSoA data and keys. Create the data in reverse order so we
+    // can see that it is sorted.
+    auto v0 = Cabana::slice<0>( aosoa );
+    auto v1 = Cabana::slice<1>( aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            int reverse_index = aosoa.size() - p - 1;
+
+            for ( int i = 0; i < 3; ++i )
+                v0( p, i ) = reverse_index + i;
+
+            v1( p ) = reverse_index;
+
+            keys( p ) = reverse_index;
+        } );
+
+    // Sort the aosoa by keys with the radix backend.
+    auto binning_data = Cabana::sortByKey( keys, Cabana::RadixSortTag() );
+    EXPECT_EQ( binning_data.numBin(), num_data );
+    Cabana::permute( binning_data, aosoa );
+
+    // Check the result of the sort.
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto v0_mirror = Cabana::slice<0>( mirror );
+    auto v1_mirror = Cabana::slice<1>( mirror );
+    for ( std::size_t p = 0; p < aosoa.size(); ++p )
+    {
+        for ( int i = 0; i < 3; ++i )
+            EXPECT_EQ( v0_mirror( p, i ), p + i );
+
+        EXPECT_EQ( v1_mirror( p ), p );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testSpaceFillingKeys()
+{
+    // Check the Morton bit interleaving directly.
+    EXPECT_EQ( Cabana::Impl::mortonKey3d( 0, 0, 0 ), 0u );
+    EXPECT_EQ( Cabana::Impl::mortonKey3d( 1, 0, 0 ), 1u );
+    EXPECT_EQ( Cabana::Impl::mortonKey3d( 0, 1, 0 ), 2u );
+    EXPECT_EQ( Cabana::Impl::mortonKey3d( 0, 0, 1 ), 4u );
+    EXPECT_EQ( Cabana::Impl::mortonKey3d( 1, 1, 1 ), 7u );
+    EXPECT_EQ( Cabana::Impl::mortonKey3d( 2, 0, 0 ), 8u );
+
+    // The Hilbert mapping must be a bijection over a small grid.
+    std::set<std::uint64_t> hilbert_keys;
+    for ( int i = 0; i < 8; ++i )
+        for ( int j = 0; j < 8; ++j )
+            for ( int k = 0; k < 8; ++k )
+                hilbert_keys.insert( Cabana::Impl::hilbertKey3d( i, j, k ) );
+    EXPECT_EQ( hilbert_keys.size(), 512u );
+
+    // Generate device keys from positions and check one key per particle.
+    using DataTypes = Cabana::MemberTypes<double[3]>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    int num_data = 125;
+    AoSoA_t aosoa( "aosoa", num_data );
+    auto position = Cabana::slice<0>( aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            position( p, 0 ) = 0.5 + ( p % 5 );
+            position( p, 1 ) = 0.5 + ( ( p / 5 ) % 5 );
+            position( p, 2 ) = 0.5 + ( p / 25 );
+        } );
+
+    double grid_delta[3] = { 1.0, 1.0, 1.0 };
+    double grid_min[3] = { 0.0, 0.0, 0.0 };
+    double grid_max[3] = { 5.0, 5.0, 5.0 };
+    auto morton_keys = Cabana::createSpaceFillingKeys(
+        Cabana::MortonKeyTag(), position, grid_delta, grid_min, grid_max );
+    auto hilbert_dev_keys = Cabana::createSpaceFillingKeys(
+        Cabana::HilbertKeyTag(), position, grid_delta, grid_min, grid_max );
+    EXPECT_EQ( morton_keys.extent( 0 ), (unsigned)num_data );
+    EXPECT_EQ( hilbert_dev_keys.extent( 0 ), (unsigned)num_data );
+
+    // Each particle occupies a unique cell so the keys must be unique.
+    auto morton_mirror = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), morton_keys );
+    std::set<std::uint64_t> morton_set;
+    for ( int p = 0; p < num_data; ++p )
+        morton_set.insert( morton_mirror( p ) );
+    EXPECT_EQ( morton_set.size(), (unsigned)num_data );
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
@@ -730,6 +890,15 @@ TEST( Sort, BinByMemberDataOnly ) { testBinBySliceDataOnly(); }
 //---------------------------------------------------------------------------//
 TEST( Sort, SortByKeySlice ) { testSortByKeySlice(); }
 
+//---------------------------------------------------------------------------//
+TEST( Sort, SortByKeyInPlace ) { testSortByKeyInPlace(); }
+
+//---------------------------------------------------------------------------//
+TEST( Sort, SortByKeyRadix ) { testSortByKeyRadix(); }
+
+//---------------------------------------------------------------------------//
+TEST( Sort, SpaceFillingKeys ) { testSpaceFillingKeys(); }
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
@@ -38,6 +38,7 @@
 #include <Cabana_Grid_ReferenceStructuredSolver.hpp>
 #ifndef KOKKOS_ENABLE_SYCL // FIXME_SYCL
 #include <Cabana_Grid_SparseArray.hpp>
+#include <Cabana_Grid_Stencil.hpp>
 #include <Cabana_Grid_SparseDimPartitioner.hpp>
 #include <Cabana_Grid_SparseHalo.hpp>
 #include <Cabana_Grid_SparseIndexSpace.hpp>
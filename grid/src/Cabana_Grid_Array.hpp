@@ -16,6 +16,8 @@
 #ifndef CABANA_GRID_ARRAY_HPP
 #define CABANA_GRID_ARRAY_HPP
 
+#include <Cabana_CommunicationPlan.hpp>
+
 #include <Cabana_Grid_IndexSpace.hpp>
 #include <Cabana_Grid_LocalGrid.hpp>
 #include <Cabana_Grid_MpiTraits.hpp>
@@ -23,9 +25,11 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <mpi.h>
@@ -224,6 +228,18 @@ createArrayLayout( const std::shared_ptr<GlobalGrid<MeshType>>& global_grid,
   \tparam MeshType Mesh type (uniform, non-uniform).
   \tparam Params Kokkos View parameters.
 */
+//---------------------------------------------------------------------------//
+// Component storage layout policies. Pass as a view parameter to
+// createArray to select how field components are stored.
+//---------------------------------------------------------------------------//
+//! Interleaved component storage (component index fastest). Favors GPU
+//! coalescing of per-entity component accesses.
+using InterleavedComponents = Kokkos::LayoutRight;
+//! Planar component storage (component index slowest). Favors CPU stencil
+//! vectorization along the unit-stride spatial dimension.
+using PlanarComponents = Kokkos::LayoutLeft;
+
+//---------------------------------------------------------------------------//
 template <class Scalar, class EntityType, class MeshType, class... Params>
 class Array
 {
@@ -400,6 +416,60 @@ createSubarray( const Array<Scalar, EntityType, MeshType, Params...>& array,
                                                             sub_view );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Copy the locally preserved overlap of an array on an old
+  decomposition into an array on a new (regridded) decomposition.
+
+  After a load-balance step most of a rank's owned region is usually still
+  owned by the same rank. This copies the intersection of the old and new
+  owned global index spaces directly in local memory, so only the sliver
+  regions that changed ownership still need to be exchanged instead of
+  rebuilding the whole array content from scratch.
+
+  \param old_array The array on the old decomposition.
+  \param new_array The array on the new decomposition. Must have the same
+  entity type, degrees of freedom, and global mesh.
+  \return True if any overlap was preserved.
+*/
+template <class Array_t>
+bool copyRegridOverlap( const Array_t& old_array, Array_t& new_array )
+{
+    static_assert( is_array<Array_t>::value, "Cabana::Grid::Array required" );
+    constexpr std::size_t num_space_dim = Array_t::num_space_dim;
+
+    auto old_global = old_array.layout()->indexSpace( Own(), Global() );
+    auto new_global = new_array.layout()->indexSpace( Own(), Global() );
+    auto old_local = old_array.layout()->indexSpace( Own(), Local() );
+    auto new_local = new_array.layout()->indexSpace( Own(), Local() );
+
+    // Intersect the owned global spaces and map the intersection into the
+    // local frame of each array. The dof dimension always overlaps.
+    std::array<long, num_space_dim + 1> old_min, old_max, new_min, new_max;
+    for ( std::size_t d = 0; d < num_space_dim; ++d )
+    {
+        const long lo = std::max( old_global.min( d ), new_global.min( d ) );
+        const long hi = std::min( old_global.max( d ), new_global.max( d ) );
+        if ( hi <= lo )
+            return false;
+        old_min[d] = old_local.min( d ) + lo - old_global.min( d );
+        old_max[d] = old_min[d] + ( hi - lo );
+        new_min[d] = new_local.min( d ) + lo - new_global.min( d );
+        new_max[d] = new_min[d] + ( hi - lo );
+    }
+    old_min[num_space_dim] = 0;
+    new_min[num_space_dim] = 0;
+    old_max[num_space_dim] = old_global.extent( num_space_dim );
+    new_max[num_space_dim] = new_global.extent( num_space_dim );
+
+    IndexSpace<num_space_dim + 1> old_space( old_min, old_max );
+    IndexSpace<num_space_dim + 1> new_space( new_min, new_max );
+    auto old_subview = createSubview( old_array.view(), old_space );
+    auto new_subview = createSubview( new_array.view(), new_space );
+    Kokkos::deep_copy( new_subview, old_subview );
+    return true;
+}
+
 //---------------------------------------------------------------------------//
 // Array operations.
 //---------------------------------------------------------------------------//
@@ -566,6 +636,84 @@ void copy( Array_t& a, const Array_t& b, DecompositionTag tag )
     Kokkos::deep_copy( subview_a, subview_b );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Copy an array into another with a different component storage
+  layout over the designated decomposition. A <- B. 3D specialization.
+
+  \param a The array to which the data will be copied.
+  \param b The array from which the data will be copied.
+  \param tag The tag for the decomposition over which to perform the
+  operation.
+
+  The component layout of an array follows its view layout: passing
+  Kokkos::LayoutRight to createArray stores components interleaved
+  (component fastest, favored by GPU coalescing) and Kokkos::LayoutLeft
+  stores them planar (component slowest, favored by CPU stencil
+  vectorization). Every ArrayOp and halo operation addresses entries
+  through the multidimensional view interface and therefore works with
+  either layout; this kernel converts between them with a single
+  element-indexed sweep, which beats the generic strided deep_copy
+  remapping.
+*/
+template <class ArrayA_t, class ArrayB_t, class DecompositionTag>
+std::enable_if_t<3 == ArrayA_t::num_space_dim, void>
+copyComponentLayout( ArrayA_t& a, const ArrayB_t& b, DecompositionTag tag )
+{
+    static_assert( is_array<ArrayA_t>::value, "Cabana::Grid::Array required" );
+    static_assert( is_array<ArrayB_t>::value, "Cabana::Grid::Array required" );
+    static_assert( std::is_same<typename ArrayA_t::entity_type,
+                                typename ArrayB_t::entity_type>::value,
+                   "Arrays must have the same entity type" );
+    auto a_space = a.layout()->indexSpace( tag, Local() );
+    auto b_space = b.layout()->indexSpace( tag, Local() );
+    if ( a_space != b_space )
+        throw std::logic_error( "Incompatible index spaces" );
+
+    auto a_view = a.view();
+    auto b_view = b.view();
+    Kokkos::parallel_for(
+        "ArrayOp::copyComponentLayout",
+        createExecutionPolicy( a_space,
+                               typename ArrayA_t::execution_space() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k, const int l ) {
+            a_view( i, j, k, l ) = b_view( i, j, k, l );
+        } );
+}
+
+/*!
+  \brief Copy an array into another with a different component storage
+  layout over the designated decomposition. A <- B. 2D specialization.
+  \param a The array to which the data will be copied.
+  \param b The array from which the data will be copied.
+  \param tag The tag for the decomposition over which to perform the
+  operation.
+*/
+template <class ArrayA_t, class ArrayB_t, class DecompositionTag>
+std::enable_if_t<2 == ArrayA_t::num_space_dim, void>
+copyComponentLayout( ArrayA_t& a, const ArrayB_t& b, DecompositionTag tag )
+{
+    static_assert( is_array<ArrayA_t>::value, "Cabana::Grid::Array required" );
+    static_assert( is_array<ArrayB_t>::value, "Cabana::Grid::Array required" );
+    static_assert( std::is_same<typename ArrayA_t::entity_type,
+                                typename ArrayB_t::entity_type>::value,
+                   "Arrays must have the same entity type" );
+    auto a_space = a.layout()->indexSpace( tag, Local() );
+    auto b_space = b.layout()->indexSpace( tag, Local() );
+    if ( a_space != b_space )
+        throw std::logic_error( "Incompatible index spaces" );
+
+    auto a_view = a.view();
+    auto b_view = b.view();
+    Kokkos::parallel_for(
+        "ArrayOp::copyComponentLayout",
+        createExecutionPolicy( a_space,
+                               typename ArrayA_t::execution_space() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int l ) {
+            a_view( i, j, l ) = b_view( i, j, l );
+        } );
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Clone an array and copy its contents into the clone.
@@ -700,6 +848,102 @@ update( Array_t& a, const typename Array_t::value_type alpha, const Array_t& b,
         } );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Update a vector with an arbitrary-length linear combination such
+  that a = alpha * a + sum_n beta_n * b_n. 3D specialization.
+
+  The whole combination executes in a single kernel, so chains of scale and
+  update calls collapse into one read-write sweep of a.
+
+  \param a The array that will be updated.
+  \param alpha The value to scale a by.
+  \param terms The arrays to add to a, each paired with its scale factor. At
+  most 8 terms are supported.
+  \param tag The tag for the decomposition over which to perform the
+  operation.
+*/
+template <class Array_t, class DecompositionTag>
+std::enable_if_t<3 == Array_t::num_space_dim, void>
+update( Array_t& a, const typename Array_t::value_type alpha,
+        const std::vector<
+            std::pair<const Array_t*, typename Array_t::value_type>>& terms,
+        DecompositionTag tag )
+{
+    static_assert( is_array<Array_t>::value, "Cabana::Grid::Array required" );
+
+    constexpr std::size_t max_terms = 8;
+    if ( terms.size() > max_terms )
+        throw std::runtime_error( "ArrayOp::update: too many terms" );
+
+    Kokkos::Array<typename Array_t::view_type, max_terms> views;
+    Kokkos::Array<typename Array_t::value_type, max_terms> scales;
+    const int num_terms = terms.size();
+    for ( int n = 0; n < num_terms; ++n )
+    {
+        views[n] = terms[n].first->view();
+        scales[n] = terms[n].second;
+    }
+
+    auto a_view = a.view();
+    Kokkos::parallel_for(
+        "ArrayOp::update",
+        createExecutionPolicy( a.layout()->indexSpace( tag, Local() ),
+                               typename Array_t::execution_space() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k, const int l ) {
+            auto value = alpha * a_view( i, j, k, l );
+            for ( int n = 0; n < num_terms; ++n )
+                value += scales[n] * views[n]( i, j, k, l );
+            a_view( i, j, k, l ) = value;
+        } );
+}
+
+/*!
+  \brief Update a vector with an arbitrary-length linear combination such
+  that a = alpha * a + sum_n beta_n * b_n. 2D specialization.
+
+  \param a The array that will be updated.
+  \param alpha The value to scale a by.
+  \param terms The arrays to add to a, each paired with its scale factor. At
+  most 8 terms are supported.
+  \param tag The tag for the decomposition over which to perform the
+  operation.
+*/
+template <class Array_t, class DecompositionTag>
+std::enable_if_t<2 == Array_t::num_space_dim, void>
+update( Array_t& a, const typename Array_t::value_type alpha,
+        const std::vector<
+            std::pair<const Array_t*, typename Array_t::value_type>>& terms,
+        DecompositionTag tag )
+{
+    static_assert( is_array<Array_t>::value, "Cabana::Grid::Array required" );
+
+    constexpr std::size_t max_terms = 8;
+    if ( terms.size() > max_terms )
+        throw std::runtime_error( "ArrayOp::update: too many terms" );
+
+    Kokkos::Array<typename Array_t::view_type, max_terms> views;
+    Kokkos::Array<typename Array_t::value_type, max_terms> scales;
+    const int num_terms = terms.size();
+    for ( int n = 0; n < num_terms; ++n )
+    {
+        views[n] = terms[n].first->view();
+        scales[n] = terms[n].second;
+    }
+
+    auto a_view = a.view();
+    Kokkos::parallel_for(
+        "ArrayOp::update",
+        createExecutionPolicy( a.layout()->indexSpace( tag, Local() ),
+                               typename Array_t::execution_space() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int l ) {
+            auto value = alpha * a_view( i, j, l );
+            for ( int n = 0; n < num_terms; ++n )
+                value += scales[n] * views[n]( i, j, l );
+            a_view( i, j, l ) = value;
+        } );
+}
+
 //---------------------------------------------------------------------------//
 //! Dot product functor
 template <class ViewType, std::size_t NumSpaceDim>
@@ -805,6 +1049,155 @@ void dot( const Array_t& a, const Array_t& b,
                    a.layout()->localGrid()->globalGrid().comm() );
 }
 
+//---------------------------------------------------------------------------//
+//! Batched dot product functor computing several dot products in a single
+//! reduction.
+template <class ViewType, std::size_t NumSpaceDim>
+struct BatchedDotFunctor
+{
+    //! Spatial dimension.
+    static constexpr std::size_t num_space_dim = NumSpaceDim;
+    //! Maximum number of dot products in one batch.
+    static constexpr std::size_t max_batch = 8;
+    //! Value type.
+    typedef typename ViewType::value_type value_type[];
+    //! Size type.
+    typedef typename ViewType::size_type size_type;
+    //! Size of the reduction (number of pairs times dofs per entity).
+    size_type value_count;
+    //! Degrees of freedom per entity.
+    size_type _num_dof;
+    //! Number of dot products in the batch.
+    int _num_pair;
+    //! First array of each pair.
+    Kokkos::Array<ViewType, max_batch> _a;
+    //! Second array of each pair.
+    Kokkos::Array<ViewType, max_batch> _b;
+
+    //! Constructor.
+    BatchedDotFunctor( const Kokkos::Array<ViewType, max_batch>& a,
+                       const Kokkos::Array<ViewType, max_batch>& b,
+                       const int num_pair )
+        : value_count( num_pair * a[0].extent( NumSpaceDim ) )
+        , _num_dof( a[0].extent( NumSpaceDim ) )
+        , _num_pair( num_pair )
+        , _a( a )
+        , _b( b )
+    {
+    }
+
+    //! 3d batched dot product operation.
+    template <std::size_t NSD = num_space_dim>
+    KOKKOS_INLINE_FUNCTION std::enable_if_t<3 == NSD, void>
+    operator()( const size_type i, const size_type j, const size_type k,
+                const size_type l, value_type sum ) const
+    {
+        for ( int p = 0; p < _num_pair; ++p )
+            sum[p * _num_dof + l] +=
+                _a[p]( i, j, k, l ) * _b[p]( i, j, k, l );
+    }
+
+    //! 2d batched dot product operation.
+    template <std::size_t NSD = num_space_dim>
+    KOKKOS_INLINE_FUNCTION std::enable_if_t<2 == NSD, void>
+    operator()( const size_type i, const size_type j, const size_type l,
+                value_type sum ) const
+    {
+        for ( int p = 0; p < _num_pair; ++p )
+            sum[p * _num_dof + l] += _a[p]( i, j, l ) * _b[p]( i, j, l );
+    }
+
+    //! Join operation.
+    KOKKOS_INLINE_FUNCTION
+    void join( value_type dst, const value_type src ) const
+    {
+        for ( size_type j = 0; j < value_count; ++j )
+            dst[j] += src[j];
+    }
+
+    //! Join operation.
+    KOKKOS_INLINE_FUNCTION
+    void join( volatile value_type dst, const volatile value_type src ) const
+    {
+        for ( size_type j = 0; j < value_count; ++j )
+            dst[j] += src[j];
+    }
+
+    //! Zero initialization.
+    KOKKOS_INLINE_FUNCTION void init( value_type sum ) const
+    {
+        for ( size_type j = 0; j < value_count; ++j )
+            sum[j] = 0.0;
+    }
+};
+
+/*!
+  \brief Compute several dot products in one kernel and one combined
+  MPI_Allreduce.
+
+  All arrays must share the same layout. Iterative solvers needing several
+  inner products per iteration avoid the serialized allreduce latency of
+  repeated dot() calls.
+
+  \param pairs The array pairs to compute dot products of (at most 8).
+  \param products The dot products, one vector of size dofsPerEntity per
+  pair. The vectors should be pre-sized as for dot().
+*/
+template <class Array_t>
+void dot( const std::vector<std::pair<const Array_t*, const Array_t*>>& pairs,
+          std::vector<std::vector<typename Array_t::value_type>>& products )
+{
+    static_assert( is_array<Array_t>::value, "Cabana::Grid::Array required" );
+    using view_type = typename Array_t::view_type;
+    using value_type = typename Array_t::value_type;
+    using functor_type = BatchedDotFunctor<view_type, Array_t::num_space_dim>;
+
+    if ( pairs.empty() )
+        return;
+    if ( pairs.size() > functor_type::max_batch )
+        throw std::runtime_error( "ArrayOp::dot: too many pairs" );
+    if ( products.size() != pairs.size() )
+        throw std::runtime_error( "Incorrect vector size" );
+
+    const auto& layout = *( pairs[0].first->layout() );
+    const std::size_t num_dof = layout.dofsPerEntity();
+    for ( auto& p : products )
+        if ( p.size() != num_dof )
+            throw std::runtime_error( "Incorrect vector size" );
+
+    // Gather the views.
+    Kokkos::Array<view_type, functor_type::max_batch> a_views;
+    Kokkos::Array<view_type, functor_type::max_batch> b_views;
+    const int num_pair = pairs.size();
+    for ( int p = 0; p < num_pair; ++p )
+    {
+        a_views[p] = pairs[p].first->view();
+        b_views[p] = pairs[p].second->view();
+    }
+
+    // Reduce all products in one kernel.
+    std::vector<value_type> flat( num_pair * num_dof, 0.0 );
+    functor_type functor( a_views, b_views, num_pair );
+    typename Array_t::execution_space exec_space;
+    Kokkos::parallel_reduce(
+        "ArrayOp::dot",
+        createExecutionPolicy( layout.indexSpace( Own(), Local() ),
+                               exec_space ),
+        functor,
+        Kokkos::View<value_type*, Kokkos::HostSpace>( flat.data(),
+                                                      flat.size() ) );
+    exec_space.fence( "ArrayOp::dot before MPI_Allreduce" );
+
+    // One combined allreduce over the whole batch.
+    MPI_Allreduce( MPI_IN_PLACE, flat.data(), flat.size(),
+                   MpiTraits<value_type>::type(), MPI_SUM,
+                   layout.localGrid()->globalGrid().comm() );
+
+    for ( int p = 0; p < num_pair; ++p )
+        for ( std::size_t l = 0; l < num_dof; ++l )
+            products[p][l] = flat[p * num_dof + l];
+}
+
 //---------------------------------------------------------------------------//
 //! Infinity norm functor
 template <class ViewType, std::size_t NumSpaceDim>
@@ -1113,6 +1506,131 @@ void norm2( const Array_t& array,
     for ( auto& n : norms )
         n = std::sqrt( n );
 }
+
+//---------------------------------------------------------------------------//
+// Device-resident norm variants. The reduction result lands in a device
+// view consumed directly by subsequent kernels (e.g. an on-device
+// convergence check), with no host fence on the critical path. Results are
+// rank-local; fold in the cross-rank reduction with reduceNorms() when a
+// global norm is actually needed, e.g. every k solver iterations.
+//---------------------------------------------------------------------------//
+/*!
+  \brief Calculate the rank-local infinity-norm into a device-resident
+  result without fencing.
+  \param exec_space Kokkos execution space instance the reduction is
+  enqueued on.
+  \param array The array to compute the norm for.
+  \param norms Device view sized to the degrees-of-freedom per entity.
+*/
+template <class ExecutionSpace, class Array_t, class ResultViewType>
+void normInfLocal( ExecutionSpace exec_space, const Array_t& array,
+                   const ResultViewType& norms )
+{
+    static_assert( is_array<Array_t>::value, "Cabana::Grid::Array required" );
+    if ( norms.extent( 0 ) !=
+         static_cast<unsigned>( array.layout()->dofsPerEntity() ) )
+        throw std::runtime_error( "Incorrect result view size" );
+
+    NormInfFunctor<typename Array_t::view_type, Array_t::num_space_dim> functor(
+        array.view() );
+    Kokkos::parallel_reduce(
+        "ArrayOp::normInfLocal",
+        createExecutionPolicy( array.layout()->indexSpace( Own(), Local() ),
+                               exec_space ),
+        functor, norms );
+}
+
+/*!
+  \brief Calculate the rank-local one-norm into a device-resident result
+  without fencing.
+  \param exec_space Kokkos execution space instance the reduction is
+  enqueued on.
+  \param array The array to compute the norm for.
+  \param norms Device view sized to the degrees-of-freedom per entity.
+*/
+template <class ExecutionSpace, class Array_t, class ResultViewType>
+void norm1Local( ExecutionSpace exec_space, const Array_t& array,
+                 const ResultViewType& norms )
+{
+    static_assert( is_array<Array_t>::value, "Cabana::Grid::Array required" );
+    if ( norms.extent( 0 ) !=
+         static_cast<unsigned>( array.layout()->dofsPerEntity() ) )
+        throw std::runtime_error( "Incorrect result view size" );
+
+    Norm1Functor<typename Array_t::view_type, Array_t::num_space_dim> functor(
+        array.view() );
+    Kokkos::parallel_reduce(
+        "ArrayOp::norm1Local",
+        createExecutionPolicy( array.layout()->indexSpace( Own(), Local() ),
+                               exec_space ),
+        functor, norms );
+}
+
+/*!
+  \brief Calculate the rank-local squared two-norm into a device-resident
+  result without fencing.
+  \param exec_space Kokkos execution space instance the reduction is
+  enqueued on.
+  \param array The array to compute the norm for.
+  \param norms Device view sized to the degrees-of-freedom per entity.
+  Holds the sum of squares; compare squared tolerances on device instead
+  of paying a round trip for the square root.
+*/
+template <class ExecutionSpace, class Array_t, class ResultViewType>
+void norm2Local( ExecutionSpace exec_space, const Array_t& array,
+                 const ResultViewType& norms )
+{
+    static_assert( is_array<Array_t>::value, "Cabana::Grid::Array required" );
+    if ( norms.extent( 0 ) !=
+         static_cast<unsigned>( array.layout()->dofsPerEntity() ) )
+        throw std::runtime_error( "Incorrect result view size" );
+
+    Norm2Functor<typename Array_t::view_type, Array_t::num_space_dim> functor(
+        array.view() );
+    Kokkos::parallel_reduce(
+        "ArrayOp::norm2Local",
+        createExecutionPolicy( array.layout()->indexSpace( Own(), Local() ),
+                               exec_space ),
+        functor, norms );
+}
+
+/*!
+  \brief Fold the cross-rank reduction into device-resident local norms.
+  \param exec_space Kokkos execution space instance the local reductions
+  were enqueued on. Fenced once here.
+  \param norms Device view of rank-local norms, replaced with the global
+  reduction.
+  \param comm The communicator to reduce over.
+  \param op The MPI reduction (MPI_SUM for norm1/norm2Local, MPI_MAX for
+  normInfLocal).
+
+  Call every k iterations rather than per iteration: between calls the
+  solver consumes the rank-local device values without any fence or
+  allreduce on the critical path. Uses the device buffer directly when
+  the MPI is GPU-aware and stages through a host mirror otherwise.
+*/
+template <class ExecutionSpace, class ResultViewType>
+void reduceNorms( ExecutionSpace exec_space, const ResultViewType& norms,
+                  MPI_Comm comm, MPI_Op op )
+{
+    using value_type = typename ResultViewType::non_const_value_type;
+
+    exec_space.fence( "ArrayOp::reduceNorms before MPI_Allreduce" );
+    if ( Cabana::gpuAwareMpiSupported() )
+    {
+        MPI_Allreduce( MPI_IN_PLACE, norms.data(), norms.extent( 0 ),
+                       MpiTraits<value_type>::type(), op, comm );
+    }
+    else
+    {
+        auto norms_host = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), norms );
+        MPI_Allreduce( MPI_IN_PLACE, norms_host.data(), norms.extent( 0 ),
+                       MpiTraits<value_type>::type(), op, comm );
+        Kokkos::deep_copy( norms, norms_host );
+    }
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace ArrayOp
@@ -29,9 +29,12 @@
 #include <array>
 #include <fstream>
 #include <iomanip>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace Cabana
 {
@@ -165,6 +168,47 @@ reorderView( TargetView& target, const SourceView& source,
 }
 
 //---------------------------------------------------------------------------//
+//---------------------------------------------------------------------------//
+//! BOV writer tuning settings.
+struct BovWriteConfig
+{
+    //! MPI-IO info hints applied to the data file, e.g. striping_factor,
+    //! striping_unit, cb_nodes, and cb_buffer_size. Subfile striping is
+    //! expressed through these hints so the single brick stays readable.
+    std::vector<std::pair<std::string, std::string>> mpi_io_hints;
+
+    //! Start the data write as a split collective and return a handle to
+    //! finish it, overlapping the write with the next timestep.
+    bool nonblocking = false;
+};
+
+//! Handle for a split-collective BOV write in flight.
+struct BovWriteHandle
+{
+    //! \cond Impl
+    MPI_File _data_file;
+    MPI_Datatype _subarray;
+    void* _buffer = nullptr;
+    std::shared_ptr<void> _keep_alive;
+    bool _pending = false;
+    //! \endcond
+
+    //! Finish the write if one is in flight. Collective.
+    void finish()
+    {
+        if ( !_pending )
+            return;
+        MPI_Status status;
+        MPI_File_write_all_end( _data_file, _buffer, &status );
+        MPI_File_close( &_data_file );
+        MPI_Type_free( &_subarray );
+        _keep_alive.reset();
+        _pending = false;
+    }
+
+    ~BovWriteHandle() { finish(); }
+};
+
 /*!
   \brief Write a grid array to a VisIt BOV.
 
@@ -179,9 +223,11 @@ reorderView( TargetView& target, const SourceView& source,
   consistent.
 */
 template <class ExecutionSpace, class Array_t>
-void writeTimeStep( ExecutionSpace, const std::string& prefix,
-                    const int time_step_index, const double time,
-                    const Array_t& array, const bool gather_array = true )
+BovWriteHandle writeTimeStep( ExecutionSpace, const std::string& prefix,
+                              const int time_step_index, const double time,
+                              const Array_t& array,
+                              const bool gather_array = true,
+                              const BovWriteConfig& config = BovWriteConfig{} )
 {
     static_assert( isUniformMesh<typename Array_t::mesh_type>::value,
                    "ViSIT BOV writer can only be used with uniform mesh" );
@@ -284,12 +330,22 @@ void writeTimeStep( ExecutionSpace, const std::string& prefix,
     file_name << prefix << "_" << std::setfill( '0' ) << std::setw( 6 )
               << time_step_index;
 
+    // Apply any configured MPI-IO hints (striping, collective buffering).
+    MPI_Info info = MPI_INFO_NULL;
+    if ( !config.mpi_io_hints.empty() )
+    {
+        MPI_Info_create( &info );
+        for ( const auto& hint : config.mpi_io_hints )
+            MPI_Info_set( info, hint.first.c_str(), hint.second.c_str() );
+    }
+
     // Open a binary data file.
     std::string data_file_name = file_name.str() + ".dat";
     MPI_File data_file;
     MPI_File_open( global_grid.comm(), data_file_name.c_str(),
-                   MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL,
-                   &data_file );
+                   MPI_MODE_WRONLY | MPI_MODE_CREATE, info, &data_file );
+    if ( MPI_INFO_NULL != info )
+        MPI_Info_free( &info );
 
     // Create the global subarray in which we are writing the local data.
     auto subarray = createSubarray( array, owned_extents, global_extents );
@@ -299,14 +355,32 @@ void writeTimeStep( ExecutionSpace, const std::string& prefix,
     MPI_File_set_view( data_file, 0, MpiTraits<value_type>::type(), subarray,
                        "native", MPI_INFO_NULL );
 
-    // Write the view to binary.
-    MPI_Status status;
-    MPI_File_write_all( data_file, owned_view.data(), owned_view.size(),
-                        MpiTraits<value_type>::type(), &status );
+    // Write the view to binary. In nonblocking mode start a split
+    // collective and hand the completion to the returned handle, keeping
+    // the reordered buffer alive until then.
+    BovWriteHandle handle;
+    if ( config.nonblocking )
+    {
+        MPI_File_write_all_begin( data_file, owned_view.data(),
+                                  owned_view.size(),
+                                  MpiTraits<value_type>::type() );
+        handle._data_file = data_file;
+        handle._subarray = subarray;
+        handle._buffer = owned_view.data();
+        handle._keep_alive =
+            std::make_shared<decltype( owned_view )>( owned_view );
+        handle._pending = true;
+    }
+    else
+    {
+        MPI_Status status;
+        MPI_File_write_all( data_file, owned_view.data(), owned_view.size(),
+                            MpiTraits<value_type>::type(), &status );
 
-    // Clean up.
-    MPI_File_close( &data_file );
-    MPI_Type_free( &subarray );
+        // Clean up.
+        MPI_File_close( &data_file );
+        MPI_Type_free( &subarray );
+    }
 
     // Create a VisIt BOV header with global data. Only create the header
     // on rank 0.
@@ -385,6 +459,8 @@ void writeTimeStep( ExecutionSpace, const std::string& prefix,
         // Close the header.
         header.close();
     }
+
+    return handle;
 }
 
 /*!
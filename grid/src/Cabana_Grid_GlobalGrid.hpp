@@ -231,6 +231,107 @@ std::shared_ptr<GlobalGrid<SparseMesh<Scalar, NumSpaceDim>>> createGlobalGrid(
         comm, global_mesh, periodic, partitioner );
 }
 
+//---------------------------------------------------------------------------//
+// Topology-aware rank placement.
+//---------------------------------------------------------------------------//
+//! Tag requesting the built-in node-grouped rank mapping at grid creation.
+struct NodeGroupedMapping
+{
+};
+
+/*!
+  \brief Reorder a communicator so ranks sharing a node are contiguous in
+  linear rank order.
+
+  \param comm The communicator to reorder.
+  \return A new communicator (caller frees) with node-grouped rank order.
+
+  MPI_Cart_create is allowed to reorder but most implementations keep the
+  linear order, so logically-adjacent ranks frequently land on distant
+  nodes. With node-grouped linear order and the row-major Cartesian
+  numbering, neighbors along the fastest dimension become node-local,
+  which is the bulk of the halo traffic for slab-favoring decompositions.
+*/
+inline MPI_Comm createNodeGroupedComm( MPI_Comm comm )
+{
+    int rank;
+    MPI_Comm_rank( comm, &rank );
+
+    // Group the ranks on this node.
+    MPI_Comm node_comm;
+    MPI_Comm_split_type( comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL,
+                         &node_comm );
+    int node_rank, node_size;
+    MPI_Comm_rank( node_comm, &node_rank );
+    MPI_Comm_size( node_comm, &node_size );
+
+    // Number the nodes by an exclusive scan over the node leaders.
+    int is_leader = ( 0 == node_rank ) ? 1 : 0;
+    int node_id = 0;
+    MPI_Exscan( &is_leader, &node_id, 1, MPI_INT, MPI_SUM, comm );
+    MPI_Bcast( &node_id, 1, MPI_INT, 0, node_comm );
+
+    // The largest node size bounds the per-node key block.
+    int max_node_size = node_size;
+    MPI_Allreduce( MPI_IN_PLACE, &max_node_size, 1, MPI_INT, MPI_MAX, comm );
+
+    // Split with node-major keys to get the grouped order.
+    MPI_Comm grouped_comm;
+    MPI_Comm_split( comm, 0, node_id * max_node_size + node_rank,
+                    &grouped_comm );
+    MPI_Comm_free( &node_comm );
+    return grouped_comm;
+}
+
+/*!
+  \brief Create a global grid with a pluggable topology-aware rank
+  mapping.
+  \param comm The communicator over which to define the grid.
+  \param global_mesh The global mesh data.
+  \param periodic Whether each logical dimension is periodic.
+  \param partitioner The grid partitioner.
+  \param comm_mapper Callable MPI_Comm( MPI_Comm ) returning a reordered
+  communicator the grid is built on. The intermediate communicator is
+  freed after construction.
+  \return Shared pointer to a GlobalGrid.
+*/
+template <class MeshType, class CommMapper>
+std::shared_ptr<GlobalGrid<MeshType>>
+createGlobalGrid( MPI_Comm comm,
+                  const std::shared_ptr<GlobalMesh<MeshType>>& global_mesh,
+                  const std::array<bool, MeshType::num_space_dim>& periodic,
+                  const BlockPartitioner<MeshType::num_space_dim>& partitioner,
+                  const CommMapper& comm_mapper )
+{
+    MPI_Comm mapped_comm = comm_mapper( comm );
+    auto global_grid = std::make_shared<GlobalGrid<MeshType>>(
+        mapped_comm, global_mesh, periodic, partitioner );
+    MPI_Comm_free( &mapped_comm );
+    return global_grid;
+}
+
+/*!
+  \brief Create a global grid with the built-in node-grouped rank mapping.
+  \param comm The communicator over which to define the grid.
+  \param global_mesh The global mesh data.
+  \param periodic Whether each logical dimension is periodic.
+  \param partitioner The grid partitioner.
+  \return Shared pointer to a GlobalGrid.
+*/
+template <class MeshType>
+std::shared_ptr<GlobalGrid<MeshType>>
+createGlobalGrid( MPI_Comm comm,
+                  const std::shared_ptr<GlobalMesh<MeshType>>& global_mesh,
+                  const std::array<bool, MeshType::num_space_dim>& periodic,
+                  const BlockPartitioner<MeshType::num_space_dim>& partitioner,
+                  NodeGroupedMapping )
+{
+    return createGlobalGrid( comm, global_mesh, periodic, partitioner,
+                             []( MPI_Comm c ) {
+                                 return createNodeGroupedComm( c );
+                             } );
+}
+
 //---------------------------------------------------------------------------//
 
 } // namespace Grid
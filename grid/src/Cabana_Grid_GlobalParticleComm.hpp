@@ -58,6 +58,9 @@ class GlobalParticleComm
     //! Cartesian rank View type (host).
     using host_rank_view_type =
         Kokkos::View<int***, Kokkos::LayoutRight, Kokkos::HostSpace>;
+    //! Rank lookup table View type.
+    using table_view_type =
+        Kokkos::View<int**, Kokkos::LayoutRight, memory_space>;
 
     //! \brief Constructor.
     GlobalParticleComm( const LocalGridType local_grid )
@@ -95,6 +98,7 @@ class GlobalParticleComm
                        _local_corners.size(), MPI_DOUBLE, MPI_SUM, comm );
 
         scaleRanks();
+        buildLookupTable();
     }
 
     //! Store local rank boundaries from the local mesh.
@@ -139,6 +143,66 @@ class GlobalParticleComm
         Kokkos::fence();
     }
 
+    /*!
+      \brief Build the per-dimension rank lookup table.
+
+      Each dimension gets a uniform table oversampled relative to the rank
+      count. A table cell stores the lower-bound rank index of the
+      positions it covers, so a particle lookup is one table read plus a
+      binary search restricted to the ranks spanned by that cell: O(1) for
+      uniform partitions (the span is a single rank) and O(log k) in the
+      worst non-uniform case. Built once per regrid with the boundaries.
+    */
+    void buildLookupTable()
+    {
+        int max_table_size = 0;
+        for ( std::size_t d = 0; d < num_space_dim; ++d )
+        {
+            _table_size[d] = table_oversample * _ranks_per_dim[d];
+            if ( _table_size[d] > max_table_size )
+                max_table_size = _table_size[d];
+        }
+        _rank_table = table_view_type(
+            Kokkos::ViewAllocateWithoutInitializing( "rank_lookup_table" ),
+            max_table_size + 1, num_space_dim );
+
+        // Local copies for lambda capture.
+        auto local_corners = _local_corners;
+        auto ranks_per_dim = _ranks_per_dim;
+        auto table_size = _table_size;
+        auto rank_table = _rank_table;
+        auto fill_table = KOKKOS_LAMBDA( const int t )
+        {
+            for ( std::size_t d = 0; d < num_space_dim; ++d )
+            {
+                if ( t > table_size[d] )
+                    continue;
+
+                double low = local_corners( 0, d, 0 );
+                double high = local_corners( ranks_per_dim[d] - 1, d, 1 );
+                double x = low + t * ( high - low ) / table_size[d];
+
+                // Lower-bound rank containing the table cell edge.
+                int min = 0;
+                int max = ranks_per_dim[d];
+                while ( max - min > 1 )
+                {
+                    int center = Kokkos::floor( ( max + min ) / 2.0 );
+                    if ( x < local_corners( center, d, 0 ) )
+                        max = center;
+                    else
+                        min = center;
+                }
+                rank_table( t, d ) = min;
+            }
+        };
+        using exec_space = typename memory_space::execution_space;
+        Kokkos::RangePolicy<exec_space> policy( 0, max_table_size + 1 );
+        Kokkos::parallel_for( "Cabana::Grid::GlobalParticleComm::fillTable",
+                              policy, fill_table );
+        Kokkos::fence();
+    }
+
     //! Scaling factors due to double counting from MPI reduction.
     template <std::size_t NSD = num_space_dim>
     std::enable_if_t<3 == NSD, Kokkos::Array<int, num_space_dim>> getScaling()
@@ -224,6 +288,8 @@ class GlobalParticleComm
         auto ranks_per_dim = _ranks_per_dim;
         auto destinations = _destinations;
         auto global_ranks = _global_ranks;
+        auto table_size = _table_size;
+        auto rank_table = _rank_table;
         auto build_migrate = KOKKOS_LAMBDA( const std::size_t p )
         {
             // This is not num_space_dim because global_ranks is always rank-3
@@ -233,15 +299,27 @@ class GlobalParticleComm
             // Find the rank this particle should be moved to.
             for ( std::size_t d = 0; d < num_space_dim; ++d )
             {
-                int min = 0;
-                int max = ranks_per_dim[d];
+                double low = local_corners( 0, d, 0 );
+                double high = local_corners( ranks_per_dim[d] - 1, d, 1 );
 
                 // Check if outside the box in this dimension.
-                if ( ( positions( p, d ) < local_corners( min, d, 0 ) ) ||
-                     ( positions( p, d ) > local_corners( max - 1, d, 1 ) ) )
+                if ( ( positions( p, d ) < low ) ||
+                     ( positions( p, d ) > high ) )
                     destinations( p ) = -1;
 
-                // Do a binary search for this particle in this dimension.
+                // The lookup table bounds the ranks this particle could
+                // belong to: a single rank for uniform partitions, a short
+                // span otherwise.
+                int t = Kokkos::floor( ( positions( p, d ) - low ) /
+                                       ( high - low ) * table_size[d] );
+                if ( t < 0 )
+                    t = 0;
+                if ( t >= table_size[d] )
+                    t = table_size[d] - 1;
+                int min = rank_table( t, d );
+                int max = rank_table( t + 1, d ) + 1;
+
+                // Do a binary search over the bounded span.
                 while ( max - min > 1 )
                 {
                     int center = Kokkos::floor( ( max + min ) / 2.0 );
@@ -299,6 +377,12 @@ class GlobalParticleComm
     rank_view_type _global_ranks;
     //! Particle destination ranks.
     destination_view_type _destinations;
+    //! Rank lookup table cells per rank, per dimension.
+    static constexpr int table_oversample = 4;
+    //! Rank lookup table sizes.
+    Kokkos::Array<int, num_space_dim> _table_size;
+    //! Per-dimension lower-bound rank lookup table.
+    table_view_type _rank_table;
 };
 
 /*!
@@ -29,6 +29,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <type_traits>
 #include <vector>
 
@@ -150,6 +151,39 @@ class FaceHaloPattern<2> : public HaloPattern<2>
     }
 };
 
+//! %Halo pattern with face connectivity in a single dimension. Building
+//! block for dimension-staged exchanges: an x-face exchange, then y, then z
+//! delivers corner data with 6 messages instead of 26 when each later phase
+//! also forwards the ghost data received by the earlier ones. The shared
+//! index spaces used to build halo communication data currently span owned
+//! entities only in the transverse dimensions, so composing the full
+//! diagonal-eliminating staged gather additionally requires ghost-inclusive
+//! send spaces; until then this pattern serves exchanges where corner
+//! coupling is not required (e.g. dimensionally split stencils).
+template <std::size_t NumSpaceDim>
+class DimHaloPattern : public HaloPattern<NumSpaceDim>
+{
+  public:
+    /*!
+      \brief Constructor.
+      \param dim The dimension to exchange faces in.
+    */
+    DimHaloPattern( const std::size_t dim )
+        : HaloPattern<NumSpaceDim>()
+    {
+        std::vector<std::array<int, NumSpaceDim>> neighbors;
+        for ( int off = -1; off < 2; off += 2 )
+        {
+            std::array<int, NumSpaceDim> nid;
+            for ( std::size_t d = 0; d < NumSpaceDim; ++d )
+                nid[d] = 0;
+            nid[dim] = off;
+            neighbors.push_back( nid );
+        }
+        this->setNeighbors( neighbors );
+    }
+};
+
 //---------------------------------------------------------------------------//
 // Scatter reduction.
 //---------------------------------------------------------------------------//
@@ -214,6 +248,24 @@ class Halo
     */
     template <class Pattern, class... ArrayTypes>
     Halo( const Pattern& pattern, const int width, const ArrayTypes&... arrays )
+        : Halo( pattern, uniformWidths<sizeof...( ArrayTypes )>( width ),
+                arrays... )
+    {
+    }
+
+    /*!
+      \brief Constructor with per-array halo widths.
+      \param pattern The halo pattern to use for halo communication.
+      \param widths Halo width per array, each less than or equal to the
+      halo width of the block. All arrays share one message round per
+      neighbor but each is packed only to its own depth, so a narrow-stencil
+      field stops riding with a wide-stencil field's full halo volume.
+      \param arrays The arrays to build the halo for.
+    */
+    template <class Pattern, class... ArrayTypes>
+    Halo( const Pattern& pattern,
+          const std::array<int, sizeof...( ArrayTypes )>& widths,
+          const ArrayTypes&... arrays )
     {
         // Spatial dimension.
         const std::size_t num_space_dim = Pattern::num_space_dim;
@@ -264,14 +316,31 @@ class Halo
                 _receive_tags.push_back( neighbor_id( flip_id( n ) ) );
 
                 // Create communication data for owned entities.
-                buildCommData( Own(), width, n, _owned_buffers, _owned_steering,
+                buildCommData( Own(), widths, n, _owned_buffers,
+                               _owned_steering,
+                               std::make_index_sequence<sizeof...(
+                                   ArrayTypes )>{},
                                arrays... );
 
                 // Create communication data for ghosted entities.
-                buildCommData( Ghost(), width, n, _ghosted_buffers,
-                               _ghosted_steering, arrays... );
+                buildCommData( Ghost(), widths, n, _ghosted_buffers,
+                               _ghosted_steering,
+                               std::make_index_sequence<sizeof...(
+                                   ArrayTypes )>{},
+                               arrays... );
             }
         }
+
+        // Build the fused communication data: concatenated steering with a
+        // parallel neighbor id array and device-resident buffer address
+        // tables so a single kernel launch can pack or unpack every
+        // neighbor.
+        buildFusedCommData( _owned_buffers, _owned_steering,
+                            _owned_fused_steering, _owned_fused_neighbor,
+                            _owned_buffer_ptrs, _owned_buffer_sizes );
+        buildFusedCommData( _ghosted_buffers, _ghosted_steering,
+                            _ghosted_fused_steering, _ghosted_fused_neighbor,
+                            _ghosted_buffer_ptrs, _ghosted_buffer_sizes );
     }
 
     /*!
@@ -318,17 +387,16 @@ class Halo
             }
         }
 
-        // Pack send buffers and post sends.
+        // Pack all send buffers in one fused kernel launch and post the
+        // sends.
+        packAllBuffers( exec_space, _owned_buffer_ptrs, _owned_buffer_sizes,
+                        _owned_fused_steering, _owned_fused_neighbor,
+                        arrays.view()... );
         for ( int n = 0; n < num_n; ++n )
         {
             // Only process this neighbor if there is work to do.
             if ( 0 < _owned_buffers[n].size() )
             {
-                // Pack the send buffer.
-                packBuffer( exec_space, _owned_buffers[n], _owned_steering[n],
-                            arrays.view()... );
-
-                // Post a send.
                 MPI_Isend( _owned_buffers[n].data(), _owned_buffers[n].size(),
                            MPI_BYTE, _neighbor_ranks[n],
                            mpi_tag + _send_tags[n], comm,
@@ -336,31 +404,116 @@ class Halo
             }
         }
 
-        // Unpack receive buffers.
-        bool unpack_complete = false;
-        while ( !unpack_complete )
-        {
-            // Get the next buffer to unpack.
-            int unpack_index = MPI_UNDEFINED;
-            MPI_Waitany( num_n, requests.data(), &unpack_index,
-                         MPI_STATUS_IGNORE );
+        // Wait on all receives and unpack every buffer in one fused kernel
+        // launch.
+        MPI_Waitall( num_n, requests.data(), MPI_STATUSES_IGNORE );
+        unpackAllBuffers( ScatterReduce::Replace(), exec_space,
+                          _ghosted_buffer_ptrs, _ghosted_buffer_sizes,
+                          _ghosted_fused_steering, _ghosted_fused_neighbor,
+                          arrays.view()... );
+
+        // Wait on send requests.
+        MPI_Waitall( num_n, requests.data() + num_n, MPI_STATUSES_IGNORE );
+    }
+
+    /*!
+      \brief Start an asynchronous gather: pack the send buffers and post all
+      messages, then return while they are in flight.
+
+      \param exec_space The execution space to use for the pack.
+      \param arrays The arrays to gather, as for gather().
+      \return The pending requests (receives first, then sends) to pass to
+      gatherFinish().
+
+      Together with gatherFinish() this enables overlapping the halo
+      exchange with stencil computation: start the gather, run the stencil
+      on the owned interior (the owned index space shrunk by the halo
+      width), finish the gather, then run the stencil on the owned boundary
+      index spaces from LocalGrid::boundaryIndexSpace(). Between the two
+      calls the ghost values of the arrays must not be read and the owned
+      values that are sent must not be written.
+    */
+    template <class ExecutionSpace, class... ArrayTypes>
+    std::vector<MPI_Request> gatherStart( const ExecutionSpace& exec_space,
+                                          const ArrayTypes&... arrays ) const
+    {
+        Kokkos::Profiling::ScopedRegion region(
+            "Cabana::Grid::gatherStart" );
+
+        // Get the number of neighbors. Return if we have none.
+        int num_n = _neighbor_ranks.size();
+        std::vector<MPI_Request> requests( 2 * num_n, MPI_REQUEST_NULL );
+        if ( 0 == num_n )
+            return requests;
+
+        // Get the MPI communicator.
+        auto comm = getComm( arrays... );
+
+        // Pick a tag to use for communication. This object has its own
+        // communication space so any tag will do.
+        const int mpi_tag = 1234;
 
-            // If there are no more buffers to unpack we are done.
-            if ( MPI_UNDEFINED == unpack_index )
+        // Post receives.
+        for ( int n = 0; n < num_n; ++n )
+        {
+            // Only process this neighbor if there is work to do.
+            if ( 0 < _ghosted_buffers[n].size() )
             {
-                unpack_complete = true;
+                MPI_Irecv( _ghosted_buffers[n].data(),
+                           _ghosted_buffers[n].size(), MPI_BYTE,
+                           _neighbor_ranks[n], mpi_tag + _receive_tags[n], comm,
+                           &requests[n] );
             }
+        }
 
-            // Otherwise unpack the next buffer.
-            else
+        // Pack all send buffers in one fused kernel launch and post the
+        // sends.
+        packAllBuffers( exec_space, _owned_buffer_ptrs, _owned_buffer_sizes,
+                        _owned_fused_steering, _owned_fused_neighbor,
+                        arrays.view()... );
+        for ( int n = 0; n < num_n; ++n )
+        {
+            // Only process this neighbor if there is work to do.
+            if ( 0 < _owned_buffers[n].size() )
             {
-                unpackBuffer( ScatterReduce::Replace(), exec_space,
-                              _ghosted_buffers[unpack_index],
-                              _ghosted_steering[unpack_index],
-                              arrays.view()... );
+                MPI_Isend( _owned_buffers[n].data(), _owned_buffers[n].size(),
+                           MPI_BYTE, _neighbor_ranks[n],
+                           mpi_tag + _send_tags[n], comm,
+                           &requests[num_n + n] );
             }
         }
 
+        return requests;
+    }
+
+    /*!
+      \brief Finish an asynchronous gather started with gatherStart(): wait
+      on the in-flight messages and unpack the received data into the ghosts.
+
+      \param exec_space The execution space to use for the unpack.
+      \param requests The requests returned by gatherStart().
+      \param arrays The arrays given to gatherStart().
+    */
+    template <class ExecutionSpace, class... ArrayTypes>
+    void gatherFinish( const ExecutionSpace& exec_space,
+                       std::vector<MPI_Request>& requests,
+                       const ArrayTypes&... arrays ) const
+    {
+        Kokkos::Profiling::ScopedRegion region(
+            "Cabana::Grid::gatherFinish" );
+
+        int num_n = _neighbor_ranks.size();
+        if ( 0 == num_n )
+            return;
+
+        // Wait on all receives and unpack every buffer in one fused kernel
+        // launch.
+        MPI_Waitall( num_n, requests.data(), MPI_STATUSES_IGNORE );
+        unpackAllBuffers( ScatterReduce::Replace(), exec_space,
+                          _ghosted_buffer_ptrs, _ghosted_buffer_sizes,
+                          _ghosted_fused_steering, _ghosted_fused_neighbor,
+                          arrays.view()... );
+
         // Wait on send requests.
         MPI_Waitall( num_n, requests.data() + num_n, MPI_STATUSES_IGNORE );
     }
@@ -405,17 +558,16 @@ class Halo
             }
         }
 
-        // Pack send buffers and post sends.
+        // Pack all send buffers in one fused kernel launch and post the
+        // sends.
+        packAllBuffers( exec_space, _ghosted_buffer_ptrs,
+                        _ghosted_buffer_sizes, _ghosted_fused_steering,
+                        _ghosted_fused_neighbor, arrays.view()... );
         for ( int n = 0; n < num_n; ++n )
         {
             // Only process this neighbor if there is work to do.
             if ( 0 < _ghosted_buffers[n].size() )
             {
-                // Pack the send buffer.
-                packBuffer( exec_space, _ghosted_buffers[n],
-                            _ghosted_steering[n], arrays.view()... );
-
-                // Post a send.
                 MPI_Isend( _ghosted_buffers[n].data(),
                            _ghosted_buffers[n].size(), MPI_BYTE,
                            _neighbor_ranks[n], mpi_tag + _send_tags[n], comm,
@@ -423,32 +575,15 @@ class Halo
             }
         }
 
-        // Unpack receive buffers.
-        bool unpack_complete = false;
-        while ( !unpack_complete )
-        {
-            // Get the next buffer to unpack.
-            int unpack_index = MPI_UNDEFINED;
-            MPI_Waitany( num_n, requests.data(), &unpack_index,
-                         MPI_STATUS_IGNORE );
-
-            // If there are no more buffers to unpack we are done.
-            if ( MPI_UNDEFINED == unpack_index )
-            {
-                unpack_complete = true;
-            }
-
-            // Otherwise unpack the next buffer and apply the reduce operation.
-            else
-            {
-                unpackBuffer( reduce_op, exec_space,
-                              _owned_buffers[unpack_index],
-                              _owned_steering[unpack_index], arrays.view()... );
-            }
+        // Wait on all receives and unpack every buffer in one fused kernel
+        // launch, applying the reduce operation.
+        MPI_Waitall( num_n, requests.data(), MPI_STATUSES_IGNORE );
+        unpackAllBuffers( reduce_op, exec_space, _owned_buffer_ptrs,
+                          _owned_buffer_sizes, _owned_fused_steering,
+                          _owned_fused_neighbor, arrays.view()... );
 
-            // Wait on send requests.
-            MPI_Waitall( num_n, requests.data() + num_n, MPI_STATUSES_IGNORE );
-        }
+        // Wait on send requests.
+        MPI_Waitall( num_n, requests.data() + num_n, MPI_STATUSES_IGNORE );
     }
 
   public:
@@ -501,15 +636,16 @@ class Halo
         return local_grid;
     }
 
-    //! Build communication data.
+    //! Build communication data with a per-array halo width.
     template <class DecompositionTag, std::size_t NumSpaceDim,
-              class... ArrayTypes>
-    void
-    buildCommData( DecompositionTag decomposition_tag, const int width,
-                   const std::array<int, NumSpaceDim>& nid,
-                   std::vector<Kokkos::View<char*, memory_space>>& buffers,
-                   std::vector<Kokkos::View<int**, memory_space>>& steering,
-                   const ArrayTypes&... arrays )
+              class... ArrayTypes, std::size_t... I>
+    void buildCommData(
+        DecompositionTag decomposition_tag,
+        const std::array<int, sizeof...( ArrayTypes )>& widths,
+        const std::array<int, NumSpaceDim>& nid,
+        std::vector<Kokkos::View<char*, memory_space>>& buffers,
+        std::vector<Kokkos::View<int**, memory_space>>& steering,
+        std::index_sequence<I...>, const ArrayTypes&... arrays )
     {
         // Number of arrays.
         const std::size_t num_array = sizeof...( ArrayTypes );
@@ -518,11 +654,11 @@ class Halo
         std::array<std::size_t, num_array> value_byte_sizes = {
             sizeof( typename ArrayTypes::value_type )... };
 
-        // Get the index spaces we share with this neighbor. We
-        // get a shared index space for each array.
+        // Get the index spaces we share with this neighbor. We get a shared
+        // index space for each array, each at its own width.
         std::array<IndexSpace<NumSpaceDim + 1>, num_array> spaces = {
             ( arrays.layout()->sharedIndexSpace( decomposition_tag, nid,
-                                                 width ) )... };
+                                                 widths[I] ) )... };
 
         // Compute the buffer size of this neighbor and the
         // number of elements in the buffer.
@@ -903,6 +1039,141 @@ class Halo
             } );
     }
 
+    //! Build the fused communication data from the per-neighbor data.
+    void buildFusedCommData(
+        const std::vector<Kokkos::View<char*, memory_space>>& buffers,
+        const std::vector<Kokkos::View<int**, memory_space>>& steering,
+        Kokkos::View<int**, memory_space>& fused_steering,
+        Kokkos::View<int*, memory_space>& fused_neighbor,
+        Kokkos::View<std::uintptr_t*, memory_space>& buffer_ptrs,
+        Kokkos::View<std::size_t*, memory_space>& buffer_sizes )
+    {
+        const int num_n = buffers.size();
+
+        // Count the total elements across neighbors.
+        std::size_t total_elements = 0;
+        std::size_t num_cols = 0;
+        for ( int n = 0; n < num_n; ++n )
+        {
+            total_elements += steering[n].extent( 0 );
+            num_cols = steering[n].extent( 1 );
+        }
+
+        // Concatenate the per-neighbor steering vectors and record which
+        // neighbor each element belongs to.
+        fused_steering = Kokkos::View<int**, memory_space>(
+            Kokkos::ViewAllocateWithoutInitializing( "halo_fused_steering" ),
+            total_elements, num_cols );
+        fused_neighbor = Kokkos::View<int*, memory_space>(
+            Kokkos::ViewAllocateWithoutInitializing( "halo_fused_neighbor" ),
+            total_elements );
+        auto neighbor_host = Kokkos::create_mirror_view( fused_neighbor );
+        std::size_t offset = 0;
+        for ( int n = 0; n < num_n; ++n )
+        {
+            const std::size_t num_element = steering[n].extent( 0 );
+            if ( 0 < num_element )
+            {
+                auto fused_subview = Kokkos::subview(
+                    fused_steering,
+                    Kokkos::pair<std::size_t, std::size_t>(
+                        offset, offset + num_element ),
+                    Kokkos::ALL );
+                Kokkos::deep_copy( fused_subview, steering[n] );
+                for ( std::size_t i = 0; i < num_element; ++i )
+                    neighbor_host( offset + i ) = n;
+                offset += num_element;
+            }
+        }
+        Kokkos::deep_copy( fused_neighbor, neighbor_host );
+
+        // Build the device-resident buffer address and size tables.
+        buffer_ptrs = Kokkos::View<std::uintptr_t*, memory_space>(
+            Kokkos::ViewAllocateWithoutInitializing( "halo_buffer_ptrs" ),
+            num_n );
+        buffer_sizes = Kokkos::View<std::size_t*, memory_space>(
+            Kokkos::ViewAllocateWithoutInitializing( "halo_buffer_sizes" ),
+            num_n );
+        auto ptrs_host = Kokkos::create_mirror_view( buffer_ptrs );
+        auto sizes_host = Kokkos::create_mirror_view( buffer_sizes );
+        for ( int n = 0; n < num_n; ++n )
+        {
+            ptrs_host( n ) =
+                reinterpret_cast<std::uintptr_t>( buffers[n].data() );
+            sizes_host( n ) = buffers[n].size();
+        }
+        Kokkos::deep_copy( buffer_ptrs, ptrs_host );
+        Kokkos::deep_copy( buffer_sizes, sizes_host );
+    }
+
+    //! Pack arrays for every neighbor in a single kernel launch.
+    template <class ExecutionSpace, class... ArrayViews>
+    void packAllBuffers(
+        const ExecutionSpace& exec_space,
+        const Kokkos::View<std::uintptr_t*, memory_space>& buffer_ptrs,
+        const Kokkos::View<std::size_t*, memory_space>& buffer_sizes,
+        const Kokkos::View<int**, memory_space>& fused_steering,
+        const Kokkos::View<int*, memory_space>& fused_neighbor,
+        ArrayViews... array_views ) const
+    {
+        auto pp = Cabana::makeParameterPack( array_views... );
+        Kokkos::parallel_for(
+            "Cabana::Grid::Halo::pack_all_buffers",
+            Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0,
+                                                 fused_steering.extent( 0 ) ),
+            KOKKOS_LAMBDA( const int i ) {
+                const int n = fused_neighbor( i );
+                Kokkos::View<char*, memory_space> buffer(
+                    reinterpret_cast<char*>( buffer_ptrs( n ) ),
+                    buffer_sizes( n ) );
+                packArray(
+                    buffer, fused_steering, i,
+                    std::integral_constant<std::size_t,
+                                           sizeof...( ArrayViews ) - 1>(),
+                    pp );
+            } );
+        exec_space.fence();
+    }
+
+    //! Unpack arrays for every neighbor in a single kernel launch.
+    template <class ExecutionSpace, class ReduceOp, class... ArrayViews>
+    void unpackAllBuffers(
+        const ReduceOp& reduce_op, const ExecutionSpace& exec_space,
+        const Kokkos::View<std::uintptr_t*, memory_space>& buffer_ptrs,
+        const Kokkos::View<std::size_t*, memory_space>& buffer_sizes,
+        const Kokkos::View<int**, memory_space>& fused_steering,
+        const Kokkos::View<int*, memory_space>& fused_neighbor,
+        ArrayViews... array_views ) const
+    {
+        auto pp = Cabana::makeParameterPack( array_views... );
+        Kokkos::parallel_for(
+            "Cabana::Grid::Halo::unpack_all_buffers",
+            Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0,
+                                                 fused_steering.extent( 0 ) ),
+            KOKKOS_LAMBDA( const int i ) {
+                const int n = fused_neighbor( i );
+                Kokkos::View<char*, memory_space> buffer(
+                    reinterpret_cast<char*>( buffer_ptrs( n ) ),
+                    buffer_sizes( n ) );
+                unpackArray(
+                    reduce_op, buffer, fused_steering, i,
+                    std::integral_constant<std::size_t,
+                                           sizeof...( ArrayViews ) - 1>(),
+                    pp );
+            } );
+        exec_space.fence();
+    }
+
+    //! \cond Impl
+    template <std::size_t N>
+    static std::array<int, N> uniformWidths( const int width )
+    {
+        std::array<int, N> widths;
+        widths.fill( width );
+        return widths;
+    }
+    //! \endcond
+
   private:
     // The ranks we will send/receive from.
     std::vector<int> _neighbor_ranks;
@@ -924,6 +1195,17 @@ class Halo
 
     // For each neighbor, steering vector for the ghosted buffer.
     std::vector<Kokkos::View<int**, memory_space>> _ghosted_steering;
+
+    // Fused communication data: concatenated steering, the neighbor each
+    // element belongs to, and device-resident buffer address/size tables.
+    Kokkos::View<int**, memory_space> _owned_fused_steering;
+    Kokkos::View<int*, memory_space> _owned_fused_neighbor;
+    Kokkos::View<std::uintptr_t*, memory_space> _owned_buffer_ptrs;
+    Kokkos::View<std::size_t*, memory_space> _owned_buffer_sizes;
+    Kokkos::View<int**, memory_space> _ghosted_fused_steering;
+    Kokkos::View<int*, memory_space> _ghosted_fused_neighbor;
+    Kokkos::View<std::uintptr_t*, memory_space> _ghosted_buffer_ptrs;
+    Kokkos::View<std::size_t*, memory_space> _ghosted_buffer_sizes;
 };
 
 //---------------------------------------------------------------------------//
@@ -953,6 +1235,24 @@ auto createHalo( const Pattern& pattern, const int width,
     return std::make_shared<Halo<memory_space>>( pattern, width, arrays... );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Halo creation function with per-array widths.
+  \param pattern The pattern to build the halo from.
+  \param widths Halo width per array. Each must be less than or equal to
+  the width of the array halo.
+  \param arrays The arrays over which to build the halo.
+  \return Shared pointer to a Halo.
+*/
+template <class Pattern, class... ArrayTypes>
+auto createHalo( const Pattern& pattern,
+                 const std::array<int, sizeof...( ArrayTypes )>& widths,
+                 const ArrayTypes&... arrays )
+{
+    using memory_space = typename ArrayPackMemorySpace<ArrayTypes...>::type;
+    return std::make_shared<Halo<memory_space>>( pattern, widths, arrays... );
+}
+
 //---------------------------------------------------------------------------//
 
 } // namespace Grid
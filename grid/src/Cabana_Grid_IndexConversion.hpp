@@ -172,6 +172,157 @@ L2G<MeshType, EntityType> createL2G( const LocalGrid<MeshType>& local_grid,
     return L2G<MeshType, EntityType>( local_grid );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Precomputed per-dimension local-to-global conversion plan.
+
+  \tparam MemorySpace Kokkos memory space.
+  \tparam NumSpaceDim Spatial dimension.
+
+  The L2G conversion is separable per dimension, so the boundary and
+  periodicity branches can be resolved once per local index per dimension
+  into small lookup tables at plan creation. A per-entity conversion is
+  then one table load per dimension with no branches - the right shape for
+  I/O and coupling layers converting entire owned spaces every step.
+*/
+template <class MemorySpace, std::size_t NumSpaceDim>
+struct L2GPlan
+{
+    //! Spatial dimension.
+    static constexpr std::size_t num_space_dim = NumSpaceDim;
+
+    //! Per-dimension local-to-global lookup tables.
+    Kokkos::Array<Kokkos::View<int*, MemorySpace>, NumSpaceDim> dim_map;
+
+    //! Convert local indices to global indices - general form.
+    KOKKOS_INLINE_FUNCTION
+    void operator()( const int lijk[num_space_dim],
+                     int gijk[num_space_dim] ) const
+    {
+        for ( std::size_t d = 0; d < num_space_dim; ++d )
+            gijk[d] = dim_map[d]( lijk[d] );
+    }
+};
+
+/*!
+  \brief Create a local-to-global conversion plan from an indexer.
+  \param exec_space Kokkos execution space.
+  \param l2g The local-to-global indexer.
+  \param ghosted_space The local index space the plan covers (typically
+  the ghosted entity space).
+  \return L2GPlan with the per-dimension tables resident in the given
+  memory space.
+*/
+template <class MemorySpace, class ExecutionSpace, class MeshType,
+          class EntityType, long N>
+auto createL2GPlan( ExecutionSpace exec_space,
+                    const L2G<MeshType, EntityType>& l2g,
+                    const IndexSpace<N>& ghosted_space )
+{
+    static constexpr std::size_t num_space_dim = MeshType::num_space_dim;
+    L2GPlan<MemorySpace, num_space_dim> plan;
+
+    for ( std::size_t d = 0; d < num_space_dim; ++d )
+    {
+        plan.dim_map[d] = Kokkos::View<int*, MemorySpace>(
+            Kokkos::ViewAllocateWithoutInitializing( "l2g_dim_map" ),
+            ghosted_space.max( d ) );
+        auto dim_map = plan.dim_map[d];
+        const std::size_t dim = d;
+        Kokkos::parallel_for(
+            "Cabana::Grid::createL2GPlan",
+            Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0,
+                                                 ghosted_space.max( d ) ),
+            KOKKOS_LAMBDA( const int i ) {
+                // Probe the separable conversion along this dimension.
+                int lijk[num_space_dim];
+                int gijk[num_space_dim];
+                for ( std::size_t dd = 0; dd < num_space_dim; ++dd )
+                    lijk[dd] = l2g.local_own_min[dd];
+                lijk[dim] = i;
+                l2g( lijk, gijk );
+                dim_map( i ) = gijk[dim];
+            } );
+    }
+    Kokkos::fence();
+    return plan;
+}
+
+/*!
+  \brief Convert an entire index space of local indices to global indices
+  in one launch. 3D specialization.
+
+  \param exec_space Kokkos execution space.
+  \param conversion The L2G indexer or an L2GPlan.
+  \param space The local index space to convert.
+  \return View of global indices, indexed as (flattened row-major entity,
+  dimension).
+*/
+template <class MemorySpace, class ExecutionSpace, class ConversionType>
+auto batchedL2G( ExecutionSpace exec_space, const ConversionType& conversion,
+                 const IndexSpace<3>& space )
+{
+    Kokkos::View<int* [3], MemorySpace> global_indices(
+        Kokkos::ViewAllocateWithoutInitializing( "global_indices" ),
+        space.size() );
+
+    const long ny = space.extent( 1 );
+    const long nz = space.extent( 2 );
+    const long min0 = space.min( 0 );
+    const long min1 = space.min( 1 );
+    const long min2 = space.min( 2 );
+    Kokkos::parallel_for(
+        "Cabana::Grid::batchedL2G",
+        createExecutionPolicy( space, exec_space ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            int lijk[3] = { i, j, k };
+            int gijk[3];
+            conversion( lijk, gijk );
+            const long n =
+                ( ( i - min0 ) * ny + ( j - min1 ) ) * nz + ( k - min2 );
+            for ( int d = 0; d < 3; ++d )
+                global_indices( n, d ) = gijk[d];
+        } );
+    Kokkos::fence();
+    return global_indices;
+}
+
+/*!
+  \brief Convert an entire index space of local indices to global indices
+  in one launch. 2D specialization.
+
+  \param exec_space Kokkos execution space.
+  \param conversion The L2G indexer or an L2GPlan.
+  \param space The local index space to convert.
+  \return View of global indices, indexed as (flattened row-major entity,
+  dimension).
+*/
+template <class MemorySpace, class ExecutionSpace, class ConversionType>
+auto batchedL2G( ExecutionSpace exec_space, const ConversionType& conversion,
+                 const IndexSpace<2>& space )
+{
+    Kokkos::View<int* [2], MemorySpace> global_indices(
+        Kokkos::ViewAllocateWithoutInitializing( "global_indices" ),
+        space.size() );
+
+    const long ny = space.extent( 1 );
+    const long min0 = space.min( 0 );
+    const long min1 = space.min( 1 );
+    Kokkos::parallel_for(
+        "Cabana::Grid::batchedL2G",
+        createExecutionPolicy( space, exec_space ),
+        KOKKOS_LAMBDA( const int i, const int j ) {
+            int lijk[2] = { i, j };
+            int gijk[2];
+            conversion( lijk, gijk );
+            const long n = ( i - min0 ) * ny + ( j - min1 );
+            for ( int d = 0; d < 2; ++d )
+                global_indices( n, d ) = gijk[d];
+        } );
+    Kokkos::fence();
+    return global_indices;
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace IndexConversion
@@ -16,6 +16,7 @@
 #ifndef CABANA_GRID_LOADBALANCER_HPP
 #define CABANA_GRID_LOADBALANCER_HPP
 
+#include <Cabana_Grid_Array.hpp>
 #include <Cabana_Grid_GlobalGrid.hpp>
 #include <Cabana_Grid_Types.hpp>
 
@@ -27,6 +28,7 @@
 #include <mpi.h>
 
 #include <array>
+#include <chrono>
 #include <cmath>
 #include <memory>
 #include <vector>
@@ -190,6 +192,130 @@ class LoadBalancer<UniformMesh<Scalar, NumSpaceDim>>
         // todo(sschulz): Is this ok to pass arrays?
     }
 
+    /*!
+      \brief Create a new, balanced global grid from a per-cell cost field.
+      3D specialization.
+      \param global_mesh The global mesh data.
+      \param partitioner The grid partitioner.
+      \param cost Per-cell cost array (single degree of freedom), naturally
+      fed from particle counts via p2g. The local work handed to the
+      balancer is the integral of the cost over the owned cells, so cells
+      with vastly different per-cell cost are weighted correctly instead of
+      assuming uniform work. ALL's tensor method consumes one scalar per
+      rank; the plane positions then converge to the cost-weighted optimum
+      over successive rebalances.
+    */
+    template <class Array_t, std::size_t NSD = NumSpaceDim>
+    std::enable_if_t<3 == NSD, std::shared_ptr<GlobalGrid<mesh_type>>>
+    createBalancedGlobalGrid(
+        const std::shared_ptr<GlobalMesh<mesh_type>>& global_mesh,
+        const BlockPartitioner<NumSpaceDim>& partitioner, const Array_t& cost,
+        typename std::enable_if<is_array<Array_t>::value, int>::type* = 0 )
+    {
+        using exec_space = typename Array_t::execution_space;
+        auto view = cost.view();
+        auto space = cost.layout()->indexSpace( Own(), Local() );
+        double local_work = 0.0;
+        Kokkos::parallel_reduce(
+            "Cabana::Grid::LoadBalancer::integrate_cost",
+            createExecutionPolicy( space, exec_space() ),
+            KOKKOS_LAMBDA( const int i, const int j, const int k, const int l,
+                           double& sum ) { sum += view( i, j, k, l ); },
+            local_work );
+        Kokkos::fence();
+
+        return createBalancedGlobalGrid( global_mesh, partitioner,
+                                         local_work );
+    }
+
+    /*!
+      \brief Create a new, balanced global grid from a per-cell cost field.
+      2D specialization.
+      \param global_mesh The global mesh data.
+      \param partitioner The grid partitioner.
+      \param cost Per-cell cost array (single degree of freedom).
+    */
+    template <class Array_t, std::size_t NSD = NumSpaceDim>
+    std::enable_if_t<2 == NSD, std::shared_ptr<GlobalGrid<mesh_type>>>
+    createBalancedGlobalGrid(
+        const std::shared_ptr<GlobalMesh<mesh_type>>& global_mesh,
+        const BlockPartitioner<NumSpaceDim>& partitioner, const Array_t& cost,
+        typename std::enable_if<is_array<Array_t>::value, int>::type* = 0 )
+    {
+        using exec_space = typename Array_t::execution_space;
+        auto view = cost.view();
+        auto space = cost.layout()->indexSpace( Own(), Local() );
+        double local_work = 0.0;
+        Kokkos::parallel_reduce(
+            "Cabana::Grid::LoadBalancer::integrate_cost",
+            createExecutionPolicy( space, exec_space() ),
+            KOKKOS_LAMBDA( const int i, const int j, const int l,
+                           double& sum ) { sum += view( i, j, l ); },
+            local_work );
+        Kokkos::fence();
+
+        return createBalancedGlobalGrid( global_mesh, partitioner,
+                                         local_work );
+    }
+
+    /*!
+      \brief Rebalance only when the projected savings exceed the measured
+      rebalance cost. Must be called by all ranks.
+      \param global_mesh The global mesh data.
+      \param partitioner The grid partitioner.
+      \param local_work Local amount of work that is balanced.
+      \param rebalanced Set to true if a repartition was performed.
+      \return The (possibly unchanged) global grid.
+
+      The controller accumulates the projected idle time since the last
+      repartition - the measured imbalance times the elapsed wall time - and
+      triggers the repartition only once it exceeds the measured cost of the
+      previous rebalance. Drivers can then call this every step instead of
+      hand-tuning a rebalance cadence that is either too eager or too late.
+      The first call only initializes the time base; the decision is made
+      collectively so all ranks repartition together.
+    */
+    std::shared_ptr<GlobalGrid<mesh_type>> balanceIfNeeded(
+        const std::shared_ptr<GlobalMesh<mesh_type>>& global_mesh,
+        const BlockPartitioner<NumSpaceDim>& partitioner,
+        const double local_work, bool& rebalanced )
+    {
+        rebalanced = false;
+        _liball->setWork( local_work );
+
+        using clock_type = std::chrono::steady_clock;
+        const auto now = clock_type::now();
+
+        // The first invocation only sets the time base.
+        if ( !_controller_initialized )
+        {
+            _last_balance_time = now;
+            _controller_initialized = true;
+            return _global_grid;
+        }
+
+        // Projected idle time accumulated since the last repartition. The
+        // elapsed time is the collective maximum so all ranks make the same
+        // decision.
+        const double imbalance = getImbalance();
+        double elapsed =
+            std::chrono::duration<double>( now - _last_balance_time ).count();
+        MPI_Allreduce( MPI_IN_PLACE, &elapsed, 1, MPI_DOUBLE, MPI_MAX, _comm );
+        if ( imbalance * elapsed <= _measured_rebalance_cost )
+            return _global_grid;
+
+        // Repartition and measure its cost for the next decision.
+        auto grid =
+            createBalancedGlobalGrid( global_mesh, partitioner, local_work );
+        double cost =
+            std::chrono::duration<double>( clock_type::now() - now ).count();
+        MPI_Allreduce( MPI_IN_PLACE, &cost, 1, MPI_DOUBLE, MPI_MAX, _comm );
+        _measured_rebalance_cost = cost;
+        _last_balance_time = clock_type::now();
+        rebalanced = true;
+        return grid;
+    }
+
     //! \brief Return current load imbalance (wmax-wmin)/(wmax+wmin).
     //!        Must be called by all ranks.
     double getImbalance() const
@@ -249,6 +375,12 @@ class LoadBalancer<UniformMesh<Scalar, NumSpaceDim>>
     std::shared_ptr<ALL::ALL<double, double>> _liball;
     std::shared_ptr<GlobalGrid<mesh_type>> _global_grid;
     MPI_Comm _comm;
+
+    // balanceIfNeeded controller state: time base, whether it is set, and
+    // the measured cost of the last repartition.
+    std::chrono::steady_clock::time_point _last_balance_time;
+    bool _controller_initialized = false;
+    double _measured_rebalance_cost = 0.0;
 };
 
 //---------------------------------------------------------------------------//
@@ -20,9 +20,13 @@
 #include <Cabana_Grid_IndexSpace.hpp>
 #include <Cabana_Grid_Types.hpp>
 
+#include <Kokkos_Core.hpp>
+
 #include <array>
+#include <map>
 #include <memory>
 #include <type_traits>
+#include <typeindex>
 #include <vector>
 
 namespace Cabana
@@ -611,6 +615,220 @@ createLocalGrid( const std::shared_ptr<GlobalGrid<MeshType>>& global_grid,
                                                   halo_cell_width );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Memoized index space provider over a local grid.
+
+  \tparam MeshType Mesh type.
+
+  The local grid index space queries recompute bounds on every call;
+  drivers that issue them thousands of times per step (AMR-style loops over
+  many small kernels) fetch cached copies here instead. Spaces are keyed by
+  the decomposition, entity, and index tag combination and computed once on
+  first use. The cache must be dropped (or a new one built) when the local
+  grid changes.
+*/
+template <class MeshType>
+class IndexSpaceCache
+{
+  public:
+    //! Mesh type.
+    using mesh_type = MeshType;
+    //! Spatial dimension.
+    static constexpr std::size_t num_space_dim = mesh_type::num_space_dim;
+
+    /*!
+      \brief Constructor.
+      \param local_grid The local grid to cache index spaces of.
+    */
+    IndexSpaceCache( const std::shared_ptr<LocalGrid<MeshType>>& local_grid )
+        : _local_grid( local_grid )
+    {
+    }
+
+    /*!
+      \brief Get the (cached) index space of the given tag combination.
+      \param t1 Decomposition tag (Own or Ghost).
+      \param t2 Entity tag.
+      \param t3 Index tag (Local or Global).
+      \return The cached index space.
+    */
+    template <class DecompositionTag, class EntityType, class IndexType>
+    const IndexSpace<num_space_dim>&
+    indexSpace( DecompositionTag t1, EntityType t2, IndexType t3 ) const
+    {
+        const auto key = std::array<std::type_index, 3>{
+            std::type_index( typeid( DecompositionTag ) ),
+            std::type_index( typeid( EntityType ) ),
+            std::type_index( typeid( IndexType ) ) };
+        auto entry = _spaces.find( key );
+        if ( entry == _spaces.end() )
+            entry = _spaces
+                        .emplace( key,
+                                  _local_grid->indexSpace( t1, t2, t3 ) )
+                        .first;
+        return entry->second;
+    }
+
+    //! Get the cached local grid.
+    std::shared_ptr<LocalGrid<MeshType>> localGrid() const
+    {
+        return _local_grid;
+    }
+
+    //! Drop all cached spaces, e.g. after regridding.
+    void clear() const { _spaces.clear(); }
+
+  private:
+    std::shared_ptr<LocalGrid<MeshType>> _local_grid;
+    mutable std::map<std::array<std::type_index, 3>,
+                     IndexSpace<num_space_dim>>
+        _spaces;
+};
+
+/*!
+  \brief Create a memoized index space cache over a local grid.
+  \param local_grid The local grid to cache index spaces of.
+  \return IndexSpaceCache.
+*/
+template <class MeshType>
+auto createIndexSpaceCache(
+    const std::shared_ptr<LocalGrid<MeshType>>& local_grid )
+{
+    return IndexSpaceCache<MeshType>( local_grid );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Shared/ghosted index spaces of all neighbors in one
+  structure-of-arrays result with a device-usable representation.
+
+  \tparam MemorySpace Kokkos memory space for the device views.
+  \tparam NumSpaceDim Spatial dimension.
+
+  Batched result of querying sharedIndexSpace (or ghostedSharedIndexSpace)
+  for every valid neighbor at once: the ownership arithmetic runs a single
+  time per regrid instead of once per call site per neighbor, and the
+  bounds live in device views so halo pack kernels can consume them
+  without host round trips.
+*/
+template <class MemorySpace, std::size_t NumSpaceDim>
+struct NeighborIndexSpaces
+{
+    //! Spatial dimension.
+    static constexpr std::size_t num_space_dim = NumSpaceDim;
+
+    //! Number of valid neighbors.
+    int num_neighbor;
+    //! Neighbor logical offsets, one triple per valid neighbor.
+    Kokkos::View<int* [NumSpaceDim], MemorySpace> offsets;
+    //! Neighbor MPI ranks.
+    Kokkos::View<int*, MemorySpace> ranks;
+    //! Index space bounds per neighbor: (neighbor, dim, min/max).
+    Kokkos::View<long* [NumSpaceDim][2], MemorySpace> bounds;
+    //! Host mirror of the bounds for host-side consumers.
+    typename Kokkos::View<long* [NumSpaceDim][2], MemorySpace>::HostMirror
+        bounds_host;
+    //! Host mirror of the ranks.
+    typename Kokkos::View<int*, MemorySpace>::HostMirror ranks_host;
+
+    //! Reconstruct the index space of a neighbor on the host.
+    IndexSpace<NumSpaceDim> indexSpace( const int n ) const
+    {
+        std::array<long, NumSpaceDim> min;
+        std::array<long, NumSpaceDim> max;
+        for ( std::size_t d = 0; d < NumSpaceDim; ++d )
+        {
+            min[d] = bounds_host( n, d, 0 );
+            max[d] = bounds_host( n, d, 1 );
+        }
+        return IndexSpace<NumSpaceDim>( min, max );
+    }
+};
+
+/*!
+  \brief Query the shared index spaces of all valid neighbors in one batch.
+
+  \param local_grid The local grid to query.
+  \param t1 Decomposition tag (Own or Ghost).
+  \param t2 Entity tag.
+  \param halo_width Optional halo width. Default uses the grid halo width.
+  \return NeighborIndexSpaces over all valid neighbors, in the k,j,i
+  neighbor iteration order of getTopology-style loops.
+*/
+template <class MemorySpace, class MeshType, class DecompositionTag,
+          class EntityType>
+auto neighborSharedIndexSpaces( const LocalGrid<MeshType>& local_grid,
+                                DecompositionTag t1, EntityType t2,
+                                const int halo_width = -1 )
+{
+    static constexpr std::size_t num_space_dim = MeshType::num_space_dim;
+    using result_type = NeighborIndexSpaces<MemorySpace, num_space_dim>;
+
+    // Collect the valid neighbors and their spaces once on the host.
+    std::vector<std::array<int, num_space_dim>> offsets;
+    std::vector<int> ranks;
+    std::vector<IndexSpace<num_space_dim>> spaces;
+    std::array<int, num_space_dim> ijk;
+    const int num_offset = ( 2 == num_space_dim ) ? 9 : 27;
+    for ( int n = 0; n < num_offset; ++n )
+    {
+        int decode = n;
+        for ( std::size_t d = 0; d < num_space_dim; ++d )
+        {
+            ijk[d] = ( decode % 3 ) - 1;
+            decode /= 3;
+        }
+        bool is_self = true;
+        for ( std::size_t d = 0; d < num_space_dim; ++d )
+            if ( 0 != ijk[d] )
+                is_self = false;
+        if ( is_self )
+            continue;
+
+        const int rank = local_grid.neighborRank( ijk );
+        if ( rank < 0 )
+            continue;
+
+        offsets.push_back( ijk );
+        ranks.push_back( rank );
+        spaces.push_back(
+            local_grid.sharedIndexSpace( t1, t2, ijk, halo_width ) );
+    }
+
+    // Pack the structure-of-arrays result.
+    result_type result;
+    result.num_neighbor = offsets.size();
+    result.offsets = Kokkos::View<int* [num_space_dim], MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "neighbor_offsets" ),
+        result.num_neighbor );
+    result.ranks = Kokkos::View<int*, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "neighbor_ranks" ),
+        result.num_neighbor );
+    result.bounds = Kokkos::View<long* [num_space_dim][2], MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "neighbor_bounds" ),
+        result.num_neighbor );
+
+    auto offsets_host = Kokkos::create_mirror_view( result.offsets );
+    result.ranks_host = Kokkos::create_mirror_view( result.ranks );
+    result.bounds_host = Kokkos::create_mirror_view( result.bounds );
+    for ( int n = 0; n < result.num_neighbor; ++n )
+    {
+        result.ranks_host( n ) = ranks[n];
+        for ( std::size_t d = 0; d < num_space_dim; ++d )
+        {
+            offsets_host( n, d ) = offsets[n][d];
+            result.bounds_host( n, d, 0 ) = spaces[n].min( d );
+            result.bounds_host( n, d, 1 ) = spaces[n].max( d );
+        }
+    }
+    Kokkos::deep_copy( result.offsets, offsets_host );
+    Kokkos::deep_copy( result.ranks, result.ranks_host );
+    Kokkos::deep_copy( result.bounds, result.bounds_host );
+
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 
 } // namespace Grid
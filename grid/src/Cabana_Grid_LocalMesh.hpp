@@ -520,6 +520,30 @@ class LocalMesh<MemorySpace, NonUniformMesh<Scalar, NumSpaceDim>>
 
             // Copy edges to the device.
             Kokkos::deep_copy( _local_edges[d], edge_mirror );
+
+            // Precompute per-dimension edge widths and midpoints so measure
+            // and coordinate queries are single loads instead of coordinate
+            // subtraction chains.
+            _edge_widths[d] = Kokkos::View<Scalar*, MemorySpace>(
+                Kokkos::ViewAllocateWithoutInitializing( "edge_widths" ),
+                nedge - 1 );
+            _edge_mids[d] = Kokkos::View<Scalar*, MemorySpace>(
+                Kokkos::ViewAllocateWithoutInitializing( "edge_mids" ),
+                nedge - 1 );
+            auto width_mirror =
+                Kokkos::create_mirror_view( Kokkos::HostSpace(),
+                                            _edge_widths[d] );
+            auto mid_mirror = Kokkos::create_mirror_view( Kokkos::HostSpace(),
+                                                          _edge_mids[d] );
+            for ( int n = 0; n < nedge - 1; ++n )
+            {
+                width_mirror( n ) = edge_mirror( n + 1 ) - edge_mirror( n );
+                mid_mirror( n ) =
+                    ( edge_mirror( n + 1 ) + edge_mirror( n ) ) /
+                    Scalar( 2.0 );
+            }
+            Kokkos::deep_copy( _edge_widths[d], width_mirror );
+            Kokkos::deep_copy( _edge_mids[d], mid_mirror );
         }
 
         // Periodicity
@@ -605,9 +629,7 @@ class LocalMesh<MemorySpace, NonUniformMesh<Scalar, NumSpaceDim>>
                                              Scalar x[num_space_dim] ) const
     {
         for ( std::size_t d = 0; d < num_space_dim; ++d )
-            x[d] = ( _local_edges[d]( index[d] + 1 ) +
-                     _local_edges[d]( index[d] ) ) /
-                   Scalar( 2.0 );
+            x[d] = _edge_mids[d]( index[d] );
     }
 
     /*!
@@ -642,9 +664,7 @@ class LocalMesh<MemorySpace, NonUniformMesh<Scalar, NumSpaceDim>>
             if ( Dir == d )
                 x[d] = _local_edges[d]( index[d] );
             else
-                x[d] = ( _local_edges[d]( index[d] + 1 ) +
-                         _local_edges[d]( index[d] ) ) /
-                       Scalar( 2.0 );
+                x[d] = _edge_mids[d]( index[d] );
     }
 
     /*!
@@ -659,9 +679,7 @@ class LocalMesh<MemorySpace, NonUniformMesh<Scalar, NumSpaceDim>>
     {
         for ( std::size_t d = 0; d < 3; ++d )
             if ( Dir == d )
-                x[d] = ( _local_edges[d]( index[d] + 1 ) +
-                         _local_edges[d]( index[d] ) ) /
-                       Scalar( 2.0 );
+                x[d] = _edge_mids[d]( index[d] );
             else
                 x[d] = _local_edges[d]( index[d] );
     }
@@ -685,8 +703,7 @@ class LocalMesh<MemorySpace, NonUniformMesh<Scalar, NumSpaceDim>>
     KOKKOS_INLINE_FUNCTION std::enable_if_t<3 == NSD, Scalar>
     measure( Edge<Dir>, const Integer index[3] ) const
     {
-        return _local_edges[Dir][index[Dir] + 1] -
-               _local_edges[Dir][index[Dir]];
+        return _edge_widths[Dir]( index[Dir] );
     }
 
     /*!
@@ -737,8 +754,7 @@ class LocalMesh<MemorySpace, NonUniformMesh<Scalar, NumSpaceDim>>
     KOKKOS_INLINE_FUNCTION std::enable_if_t<2 == NSD, Scalar>
     measure( Face<Dim::I>, const Integer index[2] ) const
     {
-        return _local_edges[Dim::J][index[Dim::J] + 1] -
-               _local_edges[Dim::J][index[Dim::J]];
+        return _edge_widths[Dim::J]( index[Dim::J] );
     }
 
     /*!
@@ -750,8 +766,7 @@ class LocalMesh<MemorySpace, NonUniformMesh<Scalar, NumSpaceDim>>
     KOKKOS_INLINE_FUNCTION std::enable_if_t<2 == NSD, Scalar>
     measure( Face<Dim::J>, const Integer index[2] ) const
     {
-        return _local_edges[Dim::I][index[Dim::I] + 1] -
-               _local_edges[Dim::I][index[Dim::I]];
+        return _edge_widths[Dim::I]( index[Dim::I] );
     }
 
     /*!
@@ -765,10 +780,94 @@ class LocalMesh<MemorySpace, NonUniformMesh<Scalar, NumSpaceDim>>
     {
         Scalar m = 1.0;
         for ( std::size_t d = 0; d < num_space_dim; ++d )
-            m *= _local_edges[d][index[d] + 1] - _local_edges[d][index[d]];
+            m *= _edge_widths[d]( index[d] );
         return m;
     }
 
+    //! Per-cell measure cache View type.
+    using cell_measure_view =
+        typename std::conditional<3 == num_space_dim,
+                                  Kokkos::View<Scalar***, MemorySpace>,
+                                  Kokkos::View<Scalar**, MemorySpace>>::type;
+
+    /*!
+      \brief Precompute the per-cell measure cache.
+
+      Optional: costs one scalar field of memory over the ghosted cells and
+      turns cellMeasure() into a single load, for flux kernels that read
+      the cell volume more than once per cell per step. Rebuild at regrid
+      with the mesh.
+    */
+    void cacheCellMeasures()
+    {
+        auto widths = _edge_widths;
+        if constexpr ( 3 == num_space_dim )
+        {
+            _cell_measures = cell_measure_view(
+                Kokkos::ViewAllocateWithoutInitializing( "cell_measures" ),
+                widths[0].extent( 0 ), widths[1].extent( 0 ),
+                widths[2].extent( 0 ) );
+            auto measures = _cell_measures;
+            Kokkos::parallel_for(
+                "Cabana::Grid::LocalMesh::cacheCellMeasures",
+                Kokkos::MDRangePolicy<
+                    typename MemorySpace::execution_space, Kokkos::Rank<3>>(
+                    { 0, 0, 0 },
+                    { (long)widths[0].extent( 0 ),
+                      (long)widths[1].extent( 0 ),
+                      (long)widths[2].extent( 0 ) } ),
+                KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+                    measures( i, j, k ) = widths[0]( i ) * widths[1]( j ) *
+                                          widths[2]( k );
+                } );
+        }
+        else
+        {
+            _cell_measures = cell_measure_view(
+                Kokkos::ViewAllocateWithoutInitializing( "cell_measures" ),
+                widths[0].extent( 0 ), widths[1].extent( 0 ) );
+            auto measures = _cell_measures;
+            Kokkos::parallel_for(
+                "Cabana::Grid::LocalMesh::cacheCellMeasures",
+                Kokkos::MDRangePolicy<
+                    typename MemorySpace::execution_space, Kokkos::Rank<2>>(
+                    { 0, 0 },
+                    { (long)widths[0].extent( 0 ),
+                      (long)widths[1].extent( 0 ) } ),
+                KOKKOS_LAMBDA( const int i, const int j ) {
+                    measures( i, j ) = widths[0]( i ) * widths[1]( j );
+                } );
+        }
+        Kokkos::fence();
+    }
+
+    //! Whether the per-cell measure cache has been built.
+    bool cellMeasuresCached() const
+    {
+        return _cell_measures.extent( 0 ) > 0;
+    }
+
+    /*!
+      Get the cached measure of a Cell with a single load. Requires
+      cacheCellMeasures() to have been called.
+      \param index %Array of local indices relative to the ghosted
+      decomposition of the mesh block.
+    */
+    template <class Integer, std::size_t NSD = num_space_dim>
+    KOKKOS_INLINE_FUNCTION std::enable_if_t<3 == NSD, Scalar>
+    cellMeasure( const Integer index[3] ) const
+    {
+        return _cell_measures( index[0], index[1], index[2] );
+    }
+
+    //! Get the cached measure of a 2d Cell with a single load.
+    template <class Integer, std::size_t NSD = num_space_dim>
+    KOKKOS_INLINE_FUNCTION std::enable_if_t<2 == NSD, Scalar>
+    cellMeasure( const Integer index[2] ) const
+    {
+        return _cell_measures( index[0], index[1] );
+    }
+
   private:
     Kokkos::Array<Scalar, num_space_dim> _own_low_corner;
     Kokkos::Array<Scalar, num_space_dim> _own_high_corner;
@@ -776,6 +875,11 @@ class LocalMesh<MemorySpace, NonUniformMesh<Scalar, NumSpaceDim>>
     Kokkos::Array<Scalar, num_space_dim> _ghost_high_corner;
     Kokkos::Array<Kokkos::View<Scalar*, MemorySpace>, num_space_dim>
         _local_edges;
+    Kokkos::Array<Kokkos::View<Scalar*, MemorySpace>, num_space_dim>
+        _edge_widths;
+    Kokkos::Array<Kokkos::View<Scalar*, MemorySpace>, num_space_dim>
+        _edge_mids;
+    cell_measure_view _cell_measures;
     Kokkos::Array<bool, num_space_dim> _periodic;
     Kokkos::Array<bool, num_space_dim> _boundary_lo;
     Kokkos::Array<bool, num_space_dim> _boundary_hi;
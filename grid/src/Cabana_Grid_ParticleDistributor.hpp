@@ -18,6 +18,7 @@
 
 #include <Cabana_DeepCopy.hpp>
 #include <Cabana_Distributor.hpp>
+#include <Cabana_Halo.hpp>
 
 #include <Cabana_Grid_GlobalGrid.hpp>
 #include <Cabana_Grid_GlobalMesh.hpp>
@@ -26,6 +27,8 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <cmath>
+#include <memory>
 #include <vector>
 
 namespace Cabana
@@ -74,6 +77,145 @@ getTopology( const LocalGridType& local_grid )
     return topology;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Cached device-resident topology for repeated migration rebuilds.
+
+  \tparam MemorySpace Kokkos memory space.
+  \tparam NumSpaceDim Spatial dimension.
+
+  Caches everything the destination-rank kernel needs - the neighbor rank
+  table in device memory plus the local and global bounds - so per-rebuild
+  plan creation runs a single device kernel with no host topology loop or
+  host-to-device copy. Build once per regrid with createMigrateTopology().
+*/
+template <class MemorySpace, std::size_t NumSpaceDim>
+struct MigrateTopology
+{
+    //! Spatial dimension.
+    static constexpr std::size_t num_space_dim = NumSpaceDim;
+
+    //! Neighbor ranks in device memory, k,j,i order.
+    Kokkos::View<int*, MemorySpace> device_ranks;
+    //! Neighbor ranks on the host for Distributor construction.
+    std::vector<int> host_ranks;
+    //! Local domain lower bounds.
+    Kokkos::Array<double, NumSpaceDim> local_low;
+    //! Local domain upper bounds.
+    Kokkos::Array<double, NumSpaceDim> local_high;
+    //! Per-dimension periodicity.
+    Kokkos::Array<bool, NumSpaceDim> periodic;
+    //! Global domain lower bounds.
+    Kokkos::Array<double, NumSpaceDim> global_low;
+    //! Global domain upper bounds.
+    Kokkos::Array<double, NumSpaceDim> global_high;
+    //! Global domain extents.
+    Kokkos::Array<double, NumSpaceDim> global_extent;
+};
+
+/*!
+  \brief Build the cached migration topology for a local grid.
+  \param local_grid Local grid from which MPI neighbors and bounds are
+  extracted.
+  \return MigrateTopology resident in the given memory space.
+*/
+template <class MemorySpace, class LocalGridType>
+auto createMigrateTopology( const LocalGridType& local_grid )
+{
+    static constexpr std::size_t num_space_dim = LocalGridType::num_space_dim;
+    MigrateTopology<MemorySpace, num_space_dim> topology;
+
+    topology.host_ranks = getTopology( local_grid );
+    Kokkos::View<int*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+        topology_host( topology.host_ranks.data(),
+                       topology.host_ranks.size() );
+    topology.device_ranks =
+        Kokkos::create_mirror_view_and_copy( MemorySpace(), topology_host );
+
+    const auto& local_mesh = createLocalMesh<Kokkos::HostSpace>( local_grid );
+    const auto& global_grid = local_grid.globalGrid();
+    const auto& global_mesh = global_grid.globalMesh();
+    for ( std::size_t d = 0; d < num_space_dim; ++d )
+    {
+        topology.local_low[d] = local_mesh.lowCorner( Own(), d );
+        topology.local_high[d] = local_mesh.highCorner( Own(), d );
+        topology.periodic[d] = global_grid.isPeriodic( d );
+        topology.global_low[d] = global_mesh.lowCorner( d );
+        topology.global_high[d] = global_mesh.highCorner( d );
+        topology.global_extent[d] = global_mesh.extent( d );
+    }
+    return topology;
+}
+
+/*!
+  \brief Compute destination ranks and wrap periodic positions entirely on
+  device from a cached topology.
+
+  \param exec_space Kokkos execution space.
+  \param topology Cached migration topology from createMigrateTopology().
+  \param destinations Export rank view, sized to the particle count and
+  directly consumable by Distributor creation.
+  \param positions Particle positions; wrapped in place across periodic
+  boundaries.
+*/
+template <class ExecutionSpace, class MemorySpace, std::size_t NumSpaceDim,
+          class DestinationRankView, class PositionSliceType>
+void getMigrateDestinations(
+    ExecutionSpace exec_space,
+    const MigrateTopology<MemorySpace, NumSpaceDim>& topology,
+    DestinationRankView& destinations, PositionSliceType& positions )
+{
+    static constexpr std::size_t num_space_dim = NumSpaceDim;
+
+    // Local copies for lambda capture.
+    auto neighbor_ranks = topology.device_ranks;
+    auto local_low = topology.local_low;
+    auto local_high = topology.local_high;
+    auto periodic = topology.periodic;
+    auto global_low = topology.global_low;
+    auto global_high = topology.global_high;
+    auto global_extent = topology.global_extent;
+
+    Kokkos::parallel_for(
+        "Cabana::Grid::ParticleGridMigrate::get_destinations",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, positions.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            // Compute the logical index of the neighbor we are sending to.
+            int nid[num_space_dim];
+            for ( std::size_t d = 0; d < num_space_dim; ++d )
+            {
+                nid[d] = 1;
+                if ( positions( p, d ) < local_low[d] )
+                    nid[d] = 0;
+                else if ( positions( p, d ) > local_high[d] )
+                    nid[d] = 2;
+            }
+
+            // Compute the destination MPI rank [ni + 3*(nj + 3*nk) in 3d].
+            int neighbor_index = nid[0];
+            for ( std::size_t d = 1; d < num_space_dim; ++d )
+            {
+                int npower = 1;
+                for ( std::size_t dp = 1; dp <= d; ++dp )
+                    npower *= 3;
+                neighbor_index += npower * nid[d];
+            }
+            destinations( p ) = neighbor_ranks( neighbor_index );
+
+            // Shift particles through periodic boundaries.
+            for ( std::size_t d = 0; d < num_space_dim; ++d )
+            {
+                if ( periodic[d] )
+                {
+                    if ( positions( p, d ) > global_high[d] )
+                        positions( p, d ) -= global_extent[d];
+                    else if ( positions( p, d ) < global_low[d] )
+                        positions( p, d ) += global_extent[d];
+                }
+            }
+        } );
+}
+
 namespace Impl
 {
 //! \cond Impl
@@ -155,6 +297,30 @@ void getMigrateDestinations( const LocalGridType& local_grid,
             }
         } );
 }
+// Check if a particle lies in the widened ghost shell exported to the
+// neighbor with the given topology index (3^d directional encoding, center
+// excluded by the caller).
+template <std::size_t NSD, class PositionSliceType>
+KOKKOS_INLINE_FUNCTION bool
+inGhostShell( const PositionSliceType& positions, const int p,
+              const int neighbor_index,
+              const Kokkos::Array<double, NSD>& local_low,
+              const Kokkos::Array<double, NSD>& local_high,
+              const double shell )
+{
+    int n = neighbor_index;
+    for ( std::size_t d = 0; d < NSD; ++d )
+    {
+        const int dir = ( n % 3 ) - 1;
+        n /= 3;
+        if ( -1 == dir && positions( p, d ) >= local_low[d] + shell )
+            return false;
+        if ( 1 == dir && positions( p, d ) <= local_high[d] - shell )
+            return false;
+    }
+    return true;
+}
+
 //! \endcond
 } // namespace Impl
 
@@ -265,6 +431,197 @@ createParticleDistributor( const LocalGridType& local_grid,
     return distributor;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create a distributor from a cached migration topology. Destination
+  ranks are computed by a single device kernel with no per-rebuild host
+  topology work, which bounds plan creation latency on small strong-scaled
+  steps.
+
+  \param comm MPI communicator for the migration.
+  \param topology Cached migration topology from createMigrateTopology().
+  \param positions Particle positions; wrapped in place across periodic
+  boundaries.
+  \return Distributor for later migration.
+*/
+template <class MemorySpace, std::size_t NumSpaceDim, class PositionSliceType>
+Cabana::Distributor<typename PositionSliceType::memory_space>
+createParticleDistributor(
+    MPI_Comm comm, const MigrateTopology<MemorySpace, NumSpaceDim>& topology,
+    PositionSliceType& positions )
+{
+    using memory_space = typename PositionSliceType::memory_space;
+    using execution_space = typename memory_space::execution_space;
+
+    Kokkos::View<int*, memory_space> destinations(
+        Kokkos::ViewAllocateWithoutInitializing( "destinations" ),
+        positions.size() );
+    getMigrateDestinations( execution_space{}, topology, destinations,
+                            positions );
+
+    Cabana::Distributor<memory_space> distributor( comm, destinations,
+                                                   topology.host_ranks );
+    return distributor;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create a distributor using linked cell binning to restrict the
+  destination scan to boundary bins.
+
+  \param local_grid The local grid containing periodicity and system bounds.
+  \param positions Particle positions; wrapped in place across periodic
+  boundaries.
+  \param linked_cell_list Linked cell list binning the particles. The
+  binned grid must cover every particle position (bin over the ghosted
+  bounds - positions outside the grid are undefined in the list build
+  itself).
+  \param band Boundary band depth in bins: the number of bin layers at
+  the grid edge that can hold particles outside the owned domain. When
+  the grid spans the ghosted bounds this is the halo cell width plus one.
+  \return Distributor for later migration.
+
+  Interior particles cannot leave the rank, so their destination is
+  assigned with a fill instead of per-particle neighbor logic; the
+  destination kernel touches only particles binned in the boundary band.
+*/
+template <class LocalGridType, class PositionSliceType, class ListType,
+          typename std::enable_if<
+              Cabana::is_linked_cell_list<ListType>::value, int>::type = 0>
+Cabana::Distributor<typename PositionSliceType::memory_space>
+createParticleDistributor( const LocalGridType& local_grid,
+                           PositionSliceType& positions,
+                           const ListType& linked_cell_list,
+                           const int band = 1 )
+{
+    using memory_space = typename PositionSliceType::memory_space;
+    using execution_space = typename memory_space::execution_space;
+    static constexpr std::size_t num_space_dim = LocalGridType::num_space_dim;
+    static_assert( 3 == num_space_dim,
+                   "Linked cell binning is three dimensional." );
+
+    // Get all 26 neighbor ranks.
+    auto topology = getTopology( local_grid );
+    Kokkos::View<int*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+        topology_host( topology.data(), topology.size() );
+    auto topology_mirror =
+        Kokkos::create_mirror_view_and_copy( memory_space(), topology_host );
+
+    // Start with everything staying on this rank.
+    Kokkos::View<int*, memory_space> destinations(
+        Kokkos::ViewAllocateWithoutInitializing( "destinations" ),
+        positions.size() );
+    Kokkos::deep_copy( destinations, local_grid.globalGrid().blockId() );
+
+    const auto& local_mesh = createLocalMesh<Kokkos::HostSpace>( local_grid );
+    const auto& global_grid = local_grid.globalGrid();
+    const auto& global_mesh = global_grid.globalMesh();
+
+    Kokkos::Array<double, num_space_dim> local_low{};
+    Kokkos::Array<double, num_space_dim> local_high{};
+    Kokkos::Array<bool, num_space_dim> periodic{};
+    Kokkos::Array<double, num_space_dim> global_low{};
+    Kokkos::Array<double, num_space_dim> global_high{};
+    Kokkos::Array<double, num_space_dim> global_extent{};
+    for ( std::size_t d = 0; d < num_space_dim; ++d )
+    {
+        local_low[d] = local_mesh.lowCorner( Own(), d );
+        local_high[d] = local_mesh.highCorner( Own(), d );
+        periodic[d] = global_grid.isPeriodic( d );
+        global_low[d] = global_mesh.lowCorner( d );
+        global_high[d] = global_mesh.highCorner( d );
+        global_extent[d] = global_mesh.extent( d );
+    }
+
+    // Scan only the one-bin-deep boundary band of the binned grid.
+    const int nx = linked_cell_list.numBin( 0 );
+    const int ny = linked_cell_list.numBin( 1 );
+    const int nz = linked_cell_list.numBin( 2 );
+    auto lcl = linked_cell_list;
+    Kokkos::parallel_for(
+        "Cabana::Grid::ParticleGridMigrate::band_destinations",
+        Kokkos::MDRangePolicy<execution_space, Kokkos::Rank<3>>(
+            { 0, 0, 0 }, { nx, ny, nz } ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            // Interior bins cannot hold particles that left the domain.
+            if ( i >= band && i < nx - band && j >= band && j < ny - band &&
+                 k >= band && k < nz - band )
+                return;
+
+            auto offset = lcl.binOffset( i, j, k );
+            auto size = lcl.binSize( i, j, k );
+            for ( int b = 0; b < size; ++b )
+            {
+                auto p = lcl.permutation( offset + b );
+
+                // Compute the logical index of the neighbor we are
+                // sending to.
+                int nid[num_space_dim];
+                for ( std::size_t d = 0; d < num_space_dim; ++d )
+                {
+                    nid[d] = 1;
+                    if ( positions( p, d ) < local_low[d] )
+                        nid[d] = 0;
+                    else if ( positions( p, d ) > local_high[d] )
+                        nid[d] = 2;
+                }
+
+                // Compute the destination MPI rank.
+                int neighbor_index =
+                    nid[0] + 3 * ( nid[1] + 3 * nid[2] );
+                destinations( p ) = topology_mirror( neighbor_index );
+
+                // Shift particles through periodic boundaries.
+                for ( std::size_t d = 0; d < num_space_dim; ++d )
+                {
+                    if ( periodic[d] )
+                    {
+                        if ( positions( p, d ) > global_high[d] )
+                            positions( p, d ) -= global_extent[d];
+                        else if ( positions( p, d ) < global_low[d] )
+                            positions( p, d ) += global_extent[d];
+                    }
+                }
+            }
+        } );
+    Kokkos::fence();
+
+    // Create the Cabana distributor.
+    Cabana::Distributor<memory_space> distributor(
+        local_grid.globalGrid().comm(), destinations, topology );
+    return distributor;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Migrate using linked cell binning to restrict the destination scan
+  to boundary bins. In-place variant.
+
+  \param local_grid The local grid containing periodicity and system bounds.
+  \param positions Particle positions.
+  \param particles The particle AoSoA.
+  \param linked_cell_list Linked cell list binning the particles. The
+  binned grid must cover every particle position.
+  \param band Boundary band depth in bins.
+  \return Whether any particle migration occurred.
+*/
+template <class LocalGridType, class ParticlePositions,
+          class ParticleContainer, class ListType,
+          typename std::enable_if<
+              Cabana::is_linked_cell_list<ListType>::value, int>::type = 0>
+bool particleMigrate( const LocalGridType& local_grid,
+                      const ParticlePositions& positions,
+                      ParticleContainer& particles,
+                      const ListType& linked_cell_list, const int band = 1 )
+{
+    auto distributor = createParticleDistributor( local_grid, positions,
+                                                  linked_cell_list, band );
+
+    // Redistribute the particles.
+    migrate( distributor, particles );
+    return true;
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Migrate data from one uniquely-owned decomposition to another
@@ -311,6 +668,105 @@ bool particleMigrate( const LocalGridType& local_grid,
     return true;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Determine which data should be migrated while treating flagged
+  particles as deletions.
+
+  \tparam LocalGridType LocalGrid type.
+  \tparam PositionSliceType Position type.
+  \tparam KeepView Boolean Kokkos view type.
+
+  \param local_grid The local grid containing periodicity and system bound
+  information.
+  \param positions The particle positions.
+  \param keep_particle Boolean view of particles to keep (true) or delete
+  (false).
+
+  \return Distributor for later migration.
+
+  Deleted particles receive an export rank of -1 and are simply never
+  exported, so the compaction happens for free inside the migration unpack
+  instead of requiring a separate removal sweep over the particles.
+*/
+template <class LocalGridType, class PositionSliceType, class KeepView>
+Cabana::Distributor<typename PositionSliceType::memory_space>
+createParticleDistributor( const LocalGridType& local_grid,
+                           PositionSliceType& positions,
+                           const KeepView& keep_particle )
+{
+    using memory_space = typename PositionSliceType::memory_space;
+    using execution_space = typename PositionSliceType::execution_space;
+
+    // Get all 26 neighbor ranks.
+    auto topology = getTopology( local_grid );
+
+    Kokkos::View<int*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+        topology_host( topology.data(), topology.size() );
+    auto topology_mirror =
+        Kokkos::create_mirror_view_and_copy( memory_space(), topology_host );
+    Kokkos::View<int*, memory_space> destinations(
+        Kokkos::ViewAllocateWithoutInitializing( "destinations" ),
+        positions.size() );
+
+    // Determine destination ranks for all particles and wrap positions across
+    // periodic boundaries.
+    Impl::getMigrateDestinations( local_grid, topology_mirror, destinations,
+                                  positions );
+
+    // Deleted particles are not exported at all.
+    Kokkos::parallel_for(
+        "Cabana::Grid::ParticleGridMigrate::flag_deletions",
+        Kokkos::RangePolicy<execution_space>( 0, positions.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            if ( !keep_particle( p ) )
+                destinations( p ) = -1;
+        } );
+
+    // Create the Cabana distributor.
+    Cabana::Distributor<memory_space> distributor(
+        local_grid.globalGrid().comm(), destinations, topology );
+    return distributor;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Migrate particles between decompositions while deleting flagged
+  particles in the same sweep. In-place variant.
+
+  \tparam LocalGridType LocalGrid type.
+  \tparam ParticlePositions Particle position type.
+  \tparam ParticleContainer AoSoA type.
+  \tparam KeepView Boolean Kokkos view type.
+
+  \param local_grid The local grid containing periodicity and system bounds.
+  \param positions Particle positions.
+  \param particles The particle AoSoA.
+  \param keep_particle Boolean view of particles to keep (true) or delete
+  (false).
+  \return Whether any particle migration occurred.
+
+  Fuses removal and migration: flagged particles are treated as deletions
+  in the destination-rank computation, so one migration sweep replaces the
+  separate removeParticles rewrite followed by migration.
+*/
+template <class LocalGridType, class ParticlePositions,
+          class ParticleContainer, class KeepView,
+          typename std::enable_if<Kokkos::is_view<KeepView>::value,
+                                  int>::type = 0>
+bool particleMigrate( const LocalGridType& local_grid,
+                      const ParticlePositions& positions,
+                      ParticleContainer& particles,
+                      const KeepView& keep_particle )
+{
+    auto distributor =
+        createParticleDistributor( local_grid, positions, keep_particle );
+
+    // Redistribute the surviving particles.
+    migrate( distributor, particles );
+    return true;
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Migrate data from one uniquely-owned decomposition to another
@@ -367,6 +823,451 @@ bool particleMigrate( const LocalGridType& local_grid,
     return true;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Multi-step particle ghosting with a velocity-bounded skin.
+
+  \tparam MemorySpace Kokkos memory space.
+  \tparam LocalGridType LocalGrid type.
+
+  Ghosts a shell wider than the force cutoff once and reuses the exchange
+  pattern for several steps: the skin is sized so no particle can enter or
+  leave the force shell before the next rebuild, so the per-step cost is a
+  fixed-pattern gather (or nothing at all for callers that tolerate
+  positions one rebuild old) instead of rebuilding export lists and
+  resizing every step. Analogous to Verlet list skins - rebuild frequency
+  drops by the ratio of skin width to per-step particle motion.
+
+  Positions are assumed to be the first AoSoA member (the ParticleList
+  convention) so ghost copies can be wrapped across periodic boundaries.
+*/
+template <class MemorySpace, class LocalGridType>
+class MultiStepGhosting
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = MemorySpace;
+    //! Spatial dimension.
+    static constexpr std::size_t num_space_dim = LocalGridType::num_space_dim;
+
+    /*!
+      \brief Constructor.
+      \param local_grid The local grid containing periodicity and bounds.
+      \param shell_width Physical width of the ghost shell that must stay
+      valid (e.g. the force cutoff).
+      \param max_velocity Upper bound on particle speed.
+      \param dt Time step size.
+      \param num_steps Number of steps each built pattern must remain
+      valid. The skin is sized so no particle can cross it in this many
+      steps.
+    */
+    MultiStepGhosting( const LocalGridType& local_grid,
+                       const double shell_width, const double max_velocity,
+                       const double dt, const int num_steps )
+        : _local_grid( local_grid )
+        , _shell_width( shell_width )
+        , _skin_width( 2.0 * max_velocity * dt * num_steps )
+        , _num_steps( num_steps )
+        , _steps_since_build( num_steps )
+        , _num_local( 0 )
+    {
+    }
+
+    //! Number of steps each built exchange pattern remains valid.
+    int numStepsValid() const { return _num_steps; }
+
+    //! Whether the current pattern has expired and must be rebuilt.
+    bool needsRebuild() const { return _steps_since_build >= _num_steps; }
+
+    //! Number of locally owned (non-ghost) particles.
+    std::size_t numLocal() const { return _num_local; }
+
+    /*!
+      \brief Ghost particles for the next step.
+
+      Rebuilds the exchange pattern if it has expired; otherwise refreshes
+      the ghost data through the persistent pattern with a fixed-size
+      gather. Call once per step before using ghosts.
+
+      \param exec_space Kokkos execution space.
+      \param positions Particle position slice.
+      \param particles Particle AoSoA. Ghosts are appended past the owned
+      particles on rebuild.
+    */
+    template <class ExecutionSpace, class PositionSliceType,
+              class ParticleContainer>
+    void gather( ExecutionSpace exec_space, const PositionSliceType& positions,
+                 ParticleContainer& particles )
+    {
+        if ( needsRebuild() )
+            build( exec_space, positions, particles );
+        else
+            Cabana::gather( *_halo, particles );
+        wrapGhostPositions( exec_space, particles );
+        ++_steps_since_build;
+    }
+
+    /*!
+      \brief Build the ghost exchange pattern and perform the first gather.
+
+      Owned particles within shell + skin of a boundary are exported to
+      every neighbor whose widened halo region they overlap (up to 7
+      neighbors at a 3d corner).
+    */
+    template <class ExecutionSpace, class PositionSliceType,
+              class ParticleContainer>
+    void build( ExecutionSpace exec_space, const PositionSliceType& positions,
+                ParticleContainer& particles )
+    {
+        Kokkos::Profiling::ScopedRegion region(
+            "Cabana::Grid::MultiStepGhosting::build" );
+
+        _num_local = particles.size();
+
+        // Get all neighbor ranks.
+        auto topology = getTopology( _local_grid );
+        Kokkos::View<int*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+            topology_host( topology.data(), topology.size() );
+        auto topology_mirror = Kokkos::create_mirror_view_and_copy(
+            memory_space(), topology_host );
+        const int num_topology = topology.size();
+        const int self_index = ( num_topology - 1 ) / 2;
+
+        const auto& local_mesh =
+            createLocalMesh<Kokkos::HostSpace>( _local_grid );
+        Kokkos::Array<double, num_space_dim> local_low{};
+        Kokkos::Array<double, num_space_dim> local_high{};
+        for ( std::size_t d = 0; d < num_space_dim; ++d )
+        {
+            local_low[d] = local_mesh.lowCorner( Own(), d );
+            local_high[d] = local_mesh.highCorner( Own(), d );
+        }
+        const double shell = _shell_width + _skin_width;
+
+        // Count exports per particle. A particle exports to each valid
+        // neighbor whose widened halo it overlaps.
+        auto num_local = _num_local;
+        Kokkos::View<int*, memory_space> export_counts(
+            Kokkos::ViewAllocateWithoutInitializing( "export_counts" ),
+            num_local + 1 );
+        Kokkos::parallel_for(
+            "Cabana::Grid::MultiStepGhosting::count",
+            Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0,
+                                                 num_local + 1 ),
+            KOKKOS_LAMBDA( const int p ) {
+                int count = 0;
+                if ( p < static_cast<int>( num_local ) )
+                    for ( int n = 0; n < num_topology; ++n )
+                        if ( n != self_index && topology_mirror( n ) >= 0 &&
+                             Impl::inGhostShell<num_space_dim>(
+                                 positions, p, n, local_low, local_high,
+                                 shell ) )
+                            ++count;
+                export_counts( p ) = count;
+            } );
+
+        // Exclusive scan into offsets; final entry is the export total.
+        Kokkos::parallel_scan(
+            "Cabana::Grid::MultiStepGhosting::scan",
+            Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0,
+                                                 num_local + 1 ),
+            KOKKOS_LAMBDA( const int p, int& update, const bool final_pass ) {
+                const int count = export_counts( p );
+                if ( final_pass )
+                    export_counts( p ) = update;
+                update += count;
+            } );
+        auto counts_host = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(),
+            Kokkos::subview( export_counts,
+                             std::pair<int, int>( num_local, num_local + 1 ) ) );
+        const int num_export = counts_host( 0 );
+
+        // Fill export ids and ranks.
+        Kokkos::View<int*, memory_space> export_ids(
+            Kokkos::ViewAllocateWithoutInitializing( "export_ids" ),
+            num_export );
+        Kokkos::View<int*, memory_space> export_ranks(
+            Kokkos::ViewAllocateWithoutInitializing( "export_ranks" ),
+            num_export );
+        Kokkos::parallel_for(
+            "Cabana::Grid::MultiStepGhosting::fill",
+            Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, num_local ),
+            KOKKOS_LAMBDA( const int p ) {
+                int offset = export_counts( p );
+                for ( int n = 0; n < num_topology; ++n )
+                    if ( n != self_index && topology_mirror( n ) >= 0 &&
+                         Impl::inGhostShell<num_space_dim>(
+                             positions, p, n, local_low, local_high, shell ) )
+                    {
+                        export_ids( offset ) = p;
+                        export_ranks( offset ) = topology_mirror( n );
+                        ++offset;
+                    }
+            } );
+        exec_space.fence();
+
+        // Build the persistent halo and append the ghosts.
+        _halo = std::make_shared<Cabana::Halo<memory_space>>(
+            _local_grid.globalGrid().comm(), num_local, export_ids,
+            export_ranks, topology );
+        particles.resize( _halo->numLocal() + _halo->numGhost() );
+        Cabana::gather( *_halo, particles );
+
+        _steps_since_build = 0;
+    }
+
+  private:
+    // Wrap ghost positions across periodic boundaries with the minimum
+    // image so ghosts always sit adjacent to the local domain. Assumes the
+    // global extent exceeds twice the ghost shell.
+    template <class ExecutionSpace, class ParticleContainer>
+    void wrapGhostPositions( ExecutionSpace exec_space,
+                             ParticleContainer& particles )
+    {
+        const auto& local_mesh =
+            createLocalMesh<Kokkos::HostSpace>( _local_grid );
+        const auto& global_grid = _local_grid.globalGrid();
+        const auto& global_mesh = global_grid.globalMesh();
+
+        Kokkos::Array<double, num_space_dim> local_center{};
+        Kokkos::Array<bool, num_space_dim> periodic{};
+        Kokkos::Array<double, num_space_dim> global_extent{};
+        for ( std::size_t d = 0; d < num_space_dim; ++d )
+        {
+            local_center[d] = 0.5 * ( local_mesh.lowCorner( Own(), d ) +
+                                      local_mesh.highCorner( Own(), d ) );
+            periodic[d] = global_grid.isPeriodic( d );
+            global_extent[d] = global_mesh.extent( d );
+        }
+
+        auto positions = Cabana::slice<0>( particles );
+        auto num_local = _num_local;
+        Kokkos::parallel_for(
+            "Cabana::Grid::MultiStepGhosting::wrap",
+            Kokkos::RangePolicy<ExecutionSpace>( exec_space, num_local,
+                                                 particles.size() ),
+            KOKKOS_LAMBDA( const int p ) {
+                for ( std::size_t d = 0; d < num_space_dim; ++d )
+                    if ( periodic[d] )
+                    {
+                        if ( positions( p, d ) - local_center[d] >
+                             0.5 * global_extent[d] )
+                            positions( p, d ) -= global_extent[d];
+                        else if ( local_center[d] - positions( p, d ) >
+                                  0.5 * global_extent[d] )
+                            positions( p, d ) += global_extent[d];
+                    }
+            } );
+        exec_space.fence();
+    }
+
+    LocalGridType _local_grid;
+    double _shell_width;
+    double _skin_width;
+    int _num_steps;
+    int _steps_since_build;
+    std::size_t _num_local;
+    std::shared_ptr<Cabana::Halo<memory_space>> _halo;
+};
+
+/*!
+  \brief MultiStepGhosting creation function.
+  \param local_grid The local grid containing periodicity and bounds.
+  \param shell_width Physical width of the ghost shell that must stay valid.
+  \param max_velocity Upper bound on particle speed.
+  \param dt Time step size.
+  \param num_steps Number of steps each built pattern must remain valid.
+  \return Shared pointer to a MultiStepGhosting.
+*/
+template <class MemorySpace, class LocalGridType>
+auto createMultiStepGhosting( const LocalGridType& local_grid,
+                              const double shell_width,
+                              const double max_velocity, const double dt,
+                              const int num_steps )
+{
+    return std::make_shared<MultiStepGhosting<MemorySpace, LocalGridType>>(
+        local_grid, shell_width, max_velocity, dt, num_steps );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Adaptive migration controller skipping provably unnecessary
+  migrations.
+
+  \tparam MemorySpace Kokkos memory space.
+
+  Migration (including its destination scan and communication) is only
+  required once some particle may have left the owned-plus-halo region,
+  i.e. moved more than the halo slack since the last migration. The
+  controller snapshots positions at each migration and skips the whole
+  call while the maximum displacement stays below the slack; a per-step
+  motion bound (e.g. v_max * dt from a velocity reduction or histogram
+  tail) additionally skips the displacement reduction itself on steps
+  where even the accumulated bound cannot reach the slack.
+*/
+template <class MemorySpace>
+class MigrationController
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = MemorySpace;
+    //! Kokkos default execution space for this memory space.
+    using execution_space = typename memory_space::execution_space;
+
+    /*!
+      \brief Constructor.
+      \param positions Particle positions to snapshot.
+      \param slack The halo slack distance: the minimum distance any
+      particle must move before it can leave the owned-plus-halo region
+      (min_halo_width mesh cells for grid migration).
+    */
+    template <class PositionType>
+    MigrationController( const PositionType& positions, const double slack )
+        : _slack( slack )
+    {
+        _x0 = Kokkos::View<double* [3], memory_space>(
+            Kokkos::ViewAllocateWithoutInitializing( "migration_reference" ),
+            positions.size() );
+        snapshot( positions );
+    }
+
+    //! Get the halo slack distance.
+    double slack() const { return _slack; }
+
+    /*!
+      \brief Account one step of bounded motion without touching particle
+      data.
+      \param step_motion An upper bound on any particle's displacement
+      this step.
+      \return True if the accumulated bound still rules out migration, so
+      even the displacement check can be skipped.
+    */
+    bool advance( const double step_motion )
+    {
+        _motion_bound += step_motion;
+        return _motion_bound < _slack;
+    }
+
+    /*!
+      \brief Exact check: whether some particle may have left the
+      owned-plus-halo region since the last migration.
+      \param positions The current particle positions.
+    */
+    template <class PositionType>
+    bool needsMigration( const PositionType& positions ) const
+    {
+        // A changed particle count (injection, removal) invalidates the
+        // reference snapshot - nothing can be proven, so migrate.
+        if ( positions.size() != _x0.extent( 0 ) )
+            return true;
+
+        // The cheap accumulated bound first.
+        if ( _motion_bound < _slack )
+            return false;
+
+        auto x0 = _x0;
+        double max_dist_sqr = 0.0;
+        Kokkos::parallel_reduce(
+            "Cabana::Grid::MigrationController::max_displacement",
+            Kokkos::RangePolicy<execution_space>( 0, positions.size() ),
+            KOKKOS_LAMBDA( const std::size_t p, double& max_sqr ) {
+                double dist_sqr = 0.0;
+                for ( int d = 0; d < 3; ++d )
+                {
+                    const double dx = positions( p, d ) - x0( p, d );
+                    dist_sqr += dx * dx;
+                }
+                if ( dist_sqr > max_sqr )
+                    max_sqr = dist_sqr;
+            },
+            Kokkos::Max<double>( max_dist_sqr ) );
+        Kokkos::fence();
+
+        // Tighten the bound to the measured displacement so bounded steps
+        // keep skipping from the true value.
+        _motion_bound = std::sqrt( max_dist_sqr );
+        return _motion_bound >= _slack;
+    }
+
+    /*!
+      \brief Migrate if particle motion requires it, resetting the
+      tracked motion on migration.
+
+      \param local_grid The local grid containing periodicity and bounds.
+      \param positions Particle positions.
+      \param particles The particle AoSoA.
+      \param min_halo_width Number of halo mesh widths to allow particles
+      before migrating.
+      \return True if a migration was performed.
+    */
+    template <class LocalGridType, class ParticlePositions,
+              class ParticleContainer>
+    bool migrateIfNeeded( const LocalGridType& local_grid,
+                          const ParticlePositions& positions,
+                          ParticleContainer& particles,
+                          const int min_halo_width )
+    {
+        if ( !needsMigration( positions ) )
+            return false;
+
+        particleMigrate( local_grid, positions, particles, min_halo_width );
+        snapshot( positions );
+        return true;
+    }
+
+  private:
+    // Save the reference positions and reset the motion tracking.
+    template <class PositionType>
+    void snapshot( const PositionType& positions )
+    {
+        if ( _x0.extent( 0 ) != positions.size() )
+            Kokkos::realloc( Kokkos::WithoutInitializing, _x0,
+                             positions.size() );
+        auto x0 = _x0;
+        Kokkos::parallel_for(
+            "Cabana::Grid::MigrationController::snapshot",
+            Kokkos::RangePolicy<execution_space>( 0, positions.size() ),
+            KOKKOS_LAMBDA( const std::size_t p ) {
+                for ( int d = 0; d < 3; ++d )
+                    x0( p, d ) = positions( p, d );
+            } );
+        Kokkos::fence();
+        _motion_bound = 0.0;
+    }
+
+    Kokkos::View<double* [3], memory_space> _x0;
+    double _slack;
+    mutable double _motion_bound = 0.0;
+};
+
+/*!
+  \brief Create a migration controller with the slack derived from the
+  grid.
+  \param local_grid The local grid (uniform mesh).
+  \param positions Particle positions to snapshot.
+  \param min_halo_width Number of halo mesh widths allowed before
+  migration.
+  \return MigrationController in the position memory space.
+*/
+template <class LocalGridType, class PositionType>
+auto createMigrationController( const LocalGridType& local_grid,
+                                const PositionType& positions,
+                                const int min_halo_width )
+{
+    using memory_space = typename PositionType::memory_space;
+
+    // The smallest cell edge bounds the halo slack per width.
+    const auto& global_mesh = local_grid.globalGrid().globalMesh();
+    double min_cell = global_mesh.cellSize( 0 );
+    for ( std::size_t d = 1; d < LocalGridType::num_space_dim; ++d )
+        if ( global_mesh.cellSize( d ) < min_cell )
+            min_cell = global_mesh.cellSize( d );
+
+    return MigrationController<memory_space>( positions,
+                                              min_halo_width * min_cell );
+}
+
 //! \cond Deprecated
 template <class... Args>
 [[deprecated( "Cabana::Grid::particleGridMigrate is now "
@@ -479,6 +479,182 @@ class DimBlockPartitioner : public BlockPartitioner<NumSpaceDim>
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Hierarchical block partitioner honoring node boundaries.
+  \tparam NumSpaceDim Spatial dimension.
+
+  Two-level decomposition: nodes get fat blocks and the ranks within each
+  node (e.g. one per GPU) split the node block, so the expensive inter-node
+  surface area is that of the coarse node grid rather than the flat rank
+  grid. Node membership comes from a shared-memory communicator split.
+  Build the grid on the communicator from createMappedComm() so the
+  Cartesian row-major rank numbering nests each node's ranks inside its
+  node block:
+
+      HierarchicalBlockPartitioner<3> partitioner( comm );
+      auto grid = createGlobalGrid( comm, mesh, periodic, partitioner,
+                                    [&]( MPI_Comm c )
+                                    { return partitioner.createMappedComm( c ); } );
+*/
+template <std::size_t NumSpaceDim>
+class HierarchicalBlockPartitioner : public BlockPartitioner<NumSpaceDim>
+{
+  public:
+    //! Spatial dimension.
+    static constexpr std::size_t num_space_dim = NumSpaceDim;
+
+    /*!
+      \brief Constructor.
+      \param comm The communicator that will be partitioned.
+    */
+    HierarchicalBlockPartitioner( MPI_Comm comm )
+    {
+        int rank;
+        MPI_Comm_rank( comm, &rank );
+        int comm_size;
+        MPI_Comm_size( comm, &comm_size );
+
+        // Group the ranks on this node.
+        MPI_Comm node_comm;
+        MPI_Comm_split_type( comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL,
+                             &node_comm );
+        int node_size;
+        MPI_Comm_rank( node_comm, &_node_rank );
+        MPI_Comm_size( node_comm, &node_size );
+
+        // The nested decomposition requires uniform node sizes.
+        int node_size_bounds[2] = { node_size, -node_size };
+        MPI_Allreduce( MPI_IN_PLACE, node_size_bounds, 2, MPI_INT, MPI_MAX,
+                       comm );
+        if ( node_size_bounds[0] != -node_size_bounds[1] )
+            throw std::runtime_error(
+                "HierarchicalBlockPartitioner requires uniform ranks per "
+                "node" );
+
+        // Number the nodes by an exclusive scan over the node leaders.
+        int is_leader = ( 0 == _node_rank ) ? 1 : 0;
+        _node_id = 0;
+        MPI_Exscan( &is_leader, &_node_id, 1, MPI_INT, MPI_SUM, comm );
+        MPI_Bcast( &_node_id, 1, MPI_INT, 0, node_comm );
+        MPI_Comm_free( &node_comm );
+
+        // Coarse grid over the nodes, fine grid within each node.
+        const int num_node = comm_size / node_size;
+        for ( std::size_t d = 0; d < NumSpaceDim; ++d )
+        {
+            _node_dims[d] = 0;
+            _local_dims[d] = 0;
+        }
+        MPI_Dims_create( num_node, NumSpaceDim, _node_dims.data() );
+        MPI_Dims_create( node_size, NumSpaceDim, _local_dims.data() );
+        for ( std::size_t d = 0; d < NumSpaceDim; ++d )
+            _ranks_per_dim[d] = _node_dims[d] * _local_dims[d];
+    }
+
+    /*!
+      \brief Get the MPI ranks per dimension.
+      \param comm MPI communicator.
+    */
+    std::array<int, NumSpaceDim>
+    ranksPerDimension( MPI_Comm comm,
+                       const std::array<int, NumSpaceDim>& ) const override
+    {
+        int comm_size;
+        MPI_Comm_size( comm, &comm_size );
+        int nrank = 1;
+        for ( std::size_t d = 0; d < num_space_dim; ++d )
+            nrank *= _ranks_per_dim[d];
+        if ( comm_size != nrank )
+            throw std::runtime_error(
+                "HierarchicalBlockPartitioner ranks do not match comm "
+                "size" );
+        return _ranks_per_dim;
+    }
+
+    //! Get the coarse grid of nodes per dimension.
+    std::array<int, NumSpaceDim> nodesPerDimension() const
+    {
+        return _node_dims;
+    }
+
+    //! Get the fine grid of ranks per dimension within a node.
+    std::array<int, NumSpaceDim> localRanksPerDimension() const
+    {
+        return _local_dims;
+    }
+
+    /*!
+      \brief Create a communicator whose rank order nests each node's ranks
+      inside its node block.
+      \param comm The communicator to reorder.
+      \return A new communicator (caller frees, safe after grid creation).
+
+      With this order the row-major Cartesian rank numbering used by
+      MPI_Cart_create places every rank of a node in the contiguous
+      sub-brick of that node's fat block, so intra-node neighbors exchange
+      through shared memory and the inter-node traffic is the coarse-grid
+      surface.
+    */
+    MPI_Comm createMappedComm( MPI_Comm comm ) const
+    {
+        // Decode the node and within-node coordinates (row-major, last
+        // dimension fastest, matching MPI_Cart_create).
+        std::array<int, NumSpaceDim> node_coord;
+        std::array<int, NumSpaceDim> local_coord;
+        int node_decode = _node_id;
+        int local_decode = _node_rank;
+        for ( std::size_t d = NumSpaceDim; d-- > 0; )
+        {
+            node_coord[d] = node_decode % _node_dims[d];
+            node_decode /= _node_dims[d];
+            local_coord[d] = local_decode % _local_dims[d];
+            local_decode /= _local_dims[d];
+        }
+
+        // Flatten the nested global coordinate into the row-major key.
+        int key = 0;
+        for ( std::size_t d = 0; d < NumSpaceDim; ++d )
+            key = key * _ranks_per_dim[d] +
+                  node_coord[d] * _local_dims[d] + local_coord[d];
+
+        MPI_Comm mapped_comm;
+        MPI_Comm_split( comm, 0, key, &mapped_comm );
+        return mapped_comm;
+    }
+
+    /*!
+      \brief Get the owned number of cells and the global cell offset of
+      the current MPI rank.
+      \param cart_comm The MPI Cartesian communicator for the partitioning.
+      \param global_cells_per_dim The number of global cells in each
+      dimension.
+      \param owned_num_cell (Return) The owned number of cells of the
+      current MPI rank in each dimension.
+      \param global_cell_offset (Return) The global cell offset of the
+      current MPI rank in each dimension
+    */
+    void ownedCellInfo(
+        MPI_Comm cart_comm,
+        const std::array<int, num_space_dim>& global_cells_per_dim,
+        std::array<int, num_space_dim>& owned_num_cell,
+        std::array<int, num_space_dim>& global_cell_offset ) const override
+    {
+        // The block sizing is the uniform average split of the flat
+        // product grid - only the rank-to-block mapping is hierarchical.
+        _uniform.ownedCellInfo( cart_comm, global_cells_per_dim,
+                                owned_num_cell, global_cell_offset );
+    }
+
+  private:
+    std::array<int, NumSpaceDim> _node_dims;
+    std::array<int, NumSpaceDim> _local_dims;
+    std::array<int, NumSpaceDim> _ranks_per_dim;
+    int _node_id;
+    int _node_rank;
+    DimBlockPartitioner<NumSpaceDim> _uniform;
+};
+
 //---------------------------------------------------------------------------//
 
 } // namespace Grid
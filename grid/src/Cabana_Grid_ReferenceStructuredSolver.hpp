@@ -378,9 +378,12 @@ class ReferenceConjugateGradient
             std::integral_constant<std::size_t, num_space_dim>{}, compute_q0,
             pTAp );
 
-        // Finish the global reduction on pTAp.
-        MPI_Allreduce( MPI_IN_PLACE, &pTAp, 1, MpiTraits<Scalar>::type(),
-                       MPI_SUM, local_grid->globalGrid().comm() );
+        // Start the global reduction on pTAp. It is completed in the first
+        // iteration, overlapped with the gather of r and q.
+        MPI_Request pTAp_request;
+        MPI_Iallreduce( MPI_IN_PLACE, &pTAp, 1, MpiTraits<Scalar>::type(),
+                        MPI_SUM, local_grid->globalGrid().comm(),
+                        &pTAp_request );
 
         // Iterate.
         bool converged = false;
@@ -389,9 +392,12 @@ class ReferenceConjugateGradient
         Scalar beta;
         while ( _residual_norm > _tol && _num_iter < _max_iter )
         {
-            // Gather r and q.
+            // Gather r and q while the pTAp reduction is in flight.
             _M_halo->gather( execution_space(), *_M_halo_vectors );
 
+            // Finish the overlapped global reduction on pTAp.
+            MPI_Wait( &pTAp_request, MPI_STATUS_IGNORE );
+
             // Kernel 1: Compute x, r, residual norm, and zTr
             alpha = zTr_old / pTAp;
             zTr_new = 0.0;
@@ -403,9 +409,20 @@ class ReferenceConjugateGradient
                 std::integral_constant<std::size_t, num_space_dim>{},
                 cg_kernel_1, zTr_new );
 
-            // Finish the global reduction on zTr and r_norm.
-            MPI_Allreduce( MPI_IN_PLACE, &zTr_new, 1, MpiTraits<Scalar>::type(),
-                           MPI_SUM, local_grid->globalGrid().comm() );
+            // Start the global reduction on zTr and overlap it with the
+            // gather of p and z that the next kernel needs.
+            MPI_Request zTr_request;
+            MPI_Iallreduce( MPI_IN_PLACE, &zTr_new, 1,
+                            MpiTraits<Scalar>::type(), MPI_SUM,
+                            local_grid->globalGrid().comm(), &zTr_request );
+
+            // Gather p and z while the reduction is in flight. If this
+            // iteration converges the gather is unused - a small price
+            // relative to serializing the reduction latency every iteration.
+            _A_halo->gather( execution_space(), *_A_halo_vectors );
+
+            // Finish the overlapped global reduction on zTr.
+            MPI_Wait( &zTr_request, MPI_STATUS_IGNORE );
 
             // Update residual norm
             _residual_norm = std::sqrt( fabs( zTr_new ) ) / b_norm[0];
@@ -426,10 +443,8 @@ class ReferenceConjugateGradient
                 break;
             }
 
-            // Gather p and z.
-            _A_halo->gather( execution_space(), *_A_halo_vectors );
-
-            // Kernel 2: Compute p, A*p, and p^T*A*p
+            // Kernel 2: Compute p, A*p, and p^T*A*p. The gather of p and z
+            // already completed while the zTr reduction was in flight.
             beta = zTr_new / zTr_old;
             pTAp = 0.0;
             auto cg_kernel_2 = createKernel2(
@@ -440,14 +455,21 @@ class ReferenceConjugateGradient
                 std::integral_constant<std::size_t, num_space_dim>{},
                 cg_kernel_2, pTAp );
 
-            // Finish the global reduction on pTAp.
-            MPI_Allreduce( MPI_IN_PLACE, &pTAp, 1, MpiTraits<Scalar>::type(),
-                           MPI_SUM, local_grid->globalGrid().comm() );
+            // Start the global reduction on pTAp. It is completed at the top
+            // of the next iteration, overlapped with the gather of r and q.
+            MPI_Iallreduce( MPI_IN_PLACE, &pTAp, 1, MpiTraits<Scalar>::type(),
+                            MPI_SUM, local_grid->globalGrid().comm(),
+                            &pTAp_request );
 
             // Update zTr
             zTr_old = zTr_new;
         }
 
+        // Complete any reduction still in flight if we left the loop without
+        // converging.
+        if ( !converged )
+            MPI_Wait( &pTAp_request, MPI_STATUS_IGNORE );
+
         // Output end state.
         if ( 1 <= _print_level && 0 == local_grid->globalGrid().blockId() )
             std::cout << "Finished in " << _num_iter
@@ -965,6 +987,192 @@ class ReferenceConjugateGradient
 
 //---------------------------------------------------------------------------//
 // Builders.
+//---------------------------------------------------------------------------//
+/*!
+  \brief Diagonal (Jacobi) preconditioner applied in reduced precision.
+
+  \tparam Scalar Solver scalar type.
+  \tparam EntityType The grid entity of the operator.
+  \tparam MeshType Mesh type.
+  \tparam MemorySpace Kokkos memory space.
+
+  The inverse diagonal is stored in single precision and the preconditioner
+  application z = M r reads it at half the bytes, widening the product back
+  to the solver scalar on store. Residuals and inner products stay in the
+  solver precision, so convergence behavior follows the usual
+  mixed-precision preconditioning theory: the preconditioner only steers
+  the search directions and its reduced precision does not limit the
+  achievable residual.
+*/
+template <class Scalar, class EntityType, class MeshType, class MemorySpace>
+class MixedPrecisionDiagonalPreconditioner
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = typename MemorySpace::memory_space;
+    //! Kokkos execution space.
+    using execution_space = typename memory_space::execution_space;
+    //! Reduced precision storage type.
+    using storage_type = float;
+
+    /*!
+      \brief Set the inverse diagonal from a solver-precision array.
+      \param inv_diagonal The inverse diagonal entries.
+    */
+    template <class Array_t>
+    void setInverseDiagonal( const Array_t& inv_diagonal )
+    {
+        auto ghosted_space =
+            inv_diagonal.layout()->indexSpace( Ghost(), Local() );
+        if ( _diag.extent( 0 ) != ghosted_space.extent( 0 ) )
+            _diag = Kokkos::View<storage_type****, memory_space>(
+                Kokkos::ViewAllocateWithoutInitializing( "mixed_inv_diag" ),
+                ghosted_space.extent( 0 ), ghosted_space.extent( 1 ),
+                ghosted_space.extent( 2 ), ghosted_space.extent( 3 ) );
+
+        auto diag = _diag;
+        auto values = inv_diagonal.view();
+        grid_parallel_for(
+            "mixed_precond_store", execution_space(), ghosted_space,
+            KOKKOS_LAMBDA( const int i, const int j, const int k,
+                           const int l ) {
+                diag( i, j, k, l ) =
+                    static_cast<storage_type>( values( i, j, k, l ) );
+            } );
+    }
+
+    /*!
+      \brief Apply the preconditioner: z = M r over the owned entities.
+      \param r The residual.
+      \param z The preconditioned residual, widened to the solver scalar.
+    */
+    template <class Array_t>
+    void apply( const Array_t& r, Array_t& z ) const
+    {
+        Kokkos::Profiling::ScopedRegion region(
+            "Cabana::Grid::MixedPrecisionDiagonalPreconditioner::apply" );
+
+        auto diag = _diag;
+        auto r_view = r.view();
+        auto z_view = z.view();
+        auto owned_space = r.layout()->localGrid()->indexSpace(
+            Own(), EntityType(), Local() );
+        grid_parallel_for(
+            "mixed_precond_apply", execution_space(),
+            appendDimension( owned_space, r.layout()->dofsPerEntity() ),
+            KOKKOS_LAMBDA( const int i, const int j, const int k,
+                           const int l ) {
+                z_view( i, j, k, l ) = static_cast<Scalar>(
+                    diag( i, j, k, l ) *
+                    static_cast<storage_type>( r_view( i, j, k, l ) ) );
+            } );
+    }
+
+  private:
+    Kokkos::View<storage_type****, memory_space> _diag;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Matrix-free constant-coefficient stencil apply operator.
+
+  \tparam Scalar Scalar type.
+  \tparam EntityType The grid entity of the operator.
+  \tparam MeshType Mesh type.
+  \tparam MemorySpace Kokkos memory space.
+  \tparam NumStencil Compile-time stencil size.
+
+  For constant-coefficient operators the general per-entity stencil value
+  array the reference solver applies gather-style wastes a full extra array
+  stream per sweep. This operator keeps the coefficients and compile-time
+  unrolled offsets in registers and reads only the input field: y = A x in
+  a single bandwidth-bound pass. Gather the input's halo before apply().
+*/
+template <class Scalar, class EntityType, class MeshType, class MemorySpace,
+          int NumStencil>
+class MatrixFreeStencilOperator
+{
+  public:
+    //! Scalar value type.
+    using value_type = Scalar;
+    //! Kokkos memory space.
+    using memory_space = typename MemorySpace::memory_space;
+    //! Kokkos execution space.
+    using execution_space = typename memory_space::execution_space;
+    //! Compile-time stencil size.
+    static constexpr int num_stencil = NumStencil;
+
+    /*!
+      \brief Constructor.
+      \param stencil The stencil offsets.
+      \param coefficients The uniform coefficient of each stencil entry.
+    */
+    MatrixFreeStencilOperator(
+        const std::array<std::array<int, 3>, NumStencil>& stencil,
+        const std::array<Scalar, NumStencil>& coefficients )
+    {
+        for ( int st = 0; st < NumStencil; ++st )
+        {
+            for ( int d = 0; d < 3; ++d )
+                _stencil[st][d] = stencil[st][d];
+            _coefficients[st] = coefficients[st];
+        }
+    }
+
+    /*!
+      \brief Apply the operator: y = A x over the owned entities.
+      \param x The input array. Its halo must be gathered.
+      \param y The output array.
+    */
+    template <class Array_t>
+    void apply( const Array_t& x, Array_t& y ) const
+    {
+        Kokkos::Profiling::ScopedRegion region(
+            "Cabana::Grid::MatrixFreeStencilOperator::apply" );
+
+        auto x_view = x.view();
+        auto y_view = y.view();
+        auto stencil = _stencil;
+        auto coefficients = _coefficients;
+        auto owned_space = x.layout()->localGrid()->indexSpace(
+            Own(), EntityType(), Local() );
+        grid_parallel_for(
+            "matrix_free_apply", execution_space(), owned_space,
+            KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+                Scalar result = 0.0;
+#if defined( KOKKOS_ENABLE_PRAGMA_UNROLL )
+#pragma unroll
+#endif
+                for ( int st = 0; st < NumStencil; ++st )
+                    result += coefficients[st] *
+                              x_view( i + stencil[st][0],
+                                      j + stencil[st][1],
+                                      k + stencil[st][2], 0 );
+                y_view( i, j, k, 0 ) = result;
+            } );
+    }
+
+  private:
+    Kokkos::Array<Kokkos::Array<int, 3>, NumStencil> _stencil;
+    Kokkos::Array<Scalar, NumStencil> _coefficients;
+};
+
+/*!
+  \brief Create a matrix-free constant-coefficient stencil operator.
+  \param stencil The stencil offsets.
+  \param coefficients The uniform coefficient of each stencil entry.
+  \return MatrixFreeStencilOperator.
+*/
+template <class Scalar, class EntityType, class MeshType, class MemorySpace,
+          int NumStencil>
+auto createMatrixFreeStencilOperator(
+    const std::array<std::array<int, 3>, NumStencil>& stencil,
+    const std::array<Scalar, NumStencil>& coefficients )
+{
+    return MatrixFreeStencilOperator<Scalar, EntityType, MeshType, MemorySpace,
+                                     NumStencil>( stencil, coefficients );
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Creation function for reference structured preconditioned block
@@ -386,6 +386,58 @@ class SparseDimPartitioner : public BlockPartitioner<NumSpaceDim>
         Kokkos::fence();
     }
 
+    /*!
+      \brief Fused tile activation and workload counting from particle
+      positions.
+      \param sparse_map The sparse map to register tiles in.
+      \param view particle positions view
+      \param particle_num total particle number
+      \param global_lower_corner the coordinate of the domain global lower
+      corner
+      \param dx cell dx size
+
+      Streams the particle positions once: each particle's tile is inserted
+      into the sparse map and its workload incremented in the same sweep,
+      replacing the separate registration and counting passes that each
+      re-read every position.
+    */
+    template <class SparseMapType, class ParticlePosViewType,
+              typename ArrayType, typename CellUnit>
+    void registerAndComputeLocalWorkLoad( SparseMapType& sparse_map,
+                                          const ParticlePosViewType& view,
+                                          int particle_num,
+                                          const ArrayType& global_lower_corner,
+                                          const CellUnit dx )
+    {
+        resetWorkload();
+        // make a local copy
+        auto workload = _workload_per_tile;
+        auto map = sparse_map;
+        Kokkos::Array<CellUnit, num_space_dim> lower_corner;
+        for ( std::size_t d = 0; d < num_space_dim; ++d )
+        {
+            lower_corner[d] = global_lower_corner[d];
+        }
+
+        Kokkos::parallel_for(
+            "register_and_compute_local_workload",
+            Kokkos::RangePolicy<execution_space>( 0, particle_num ),
+            KOKKOS_LAMBDA( const int i ) {
+                int ci = static_cast<int>(
+                    ( view( i, 0 ) - lower_corner[0] ) / dx - 0.5 );
+                int cj = static_cast<int>(
+                    ( view( i, 1 ) - lower_corner[1] ) / dx - 0.5 );
+                int ck = static_cast<int>(
+                    ( view( i, 2 ) - lower_corner[2] ) / dx - 0.5 );
+                map.insertCell( ci, cj, ck );
+                Kokkos::atomic_increment(
+                    &workload( ( ci >> cell_bits_per_tile_dim ) + 1,
+                               ( cj >> cell_bits_per_tile_dim ) + 1,
+                               ( ck >> cell_bits_per_tile_dim ) + 1 ) );
+            } );
+        Kokkos::fence();
+    }
+
     /*!
       \brief compute the workload in the current MPI rank from sparseMap
       (the workload of a tile is 1 if the tile is occupied, 0 otherwise)
@@ -607,6 +659,12 @@ class SparseDimPartitioner : public BlockPartitioner<NumSpaceDim>
                 Kokkos::HostSpace(), _rectangle_partition_dev );
             auto rec_partition = _rectangle_partition_dev;
 
+            // remember the current partition planes for incremental
+            // (movement-bounded) rebalancing
+            std::vector<int> old_partition( rank + 1 );
+            for ( int c = 0; c <= rank; ++c )
+                old_partition[c] = rec_mirror( c, di );
+
             SubWorkloadFunctor<partition_view, workload_view>
                 compute_sub_workload( _rectangle_partition_dev,
                                       _workload_prefix_sum );
@@ -722,10 +780,43 @@ class SparseDimPartitioner : public BlockPartitioner<NumSpaceDim>
                     }
                 } // end while (optimization for the current rank)
             }     // end for (all partition/rank in the optimized dimension)
+
+            // in incremental mode, bound how far each partition plane may
+            // move in one rebalance so the post-rebalance particle migration
+            // stays cheap; ordering of the planes is preserved
+            if ( _max_plane_shift > 0 )
+            {
+                for ( int c = 1; c < rank; ++c )
+                {
+                    const int low = old_partition[c] - _max_plane_shift;
+                    const int high = old_partition[c] + _max_plane_shift;
+                    int pos = rec_mirror( c, di );
+                    pos = pos < low ? low : ( pos > high ? high : pos );
+                    if ( pos <= rec_mirror( c - 1, di ) )
+                        pos = rec_mirror( c - 1, di ) + 1;
+                    if ( pos > rec_mirror( rank, di ) - ( rank - c ) )
+                        pos = rec_mirror( rank, di ) - ( rank - c );
+                    rec_mirror( c, di ) = pos;
+                }
+            }
+
             Kokkos::deep_copy( _rectangle_partition_dev, rec_mirror );
         } // end for (3 dimensions)
     }
 
+    /*!
+      \brief Set the maximum number of tiles any partition plane may move in
+      a single rebalance. Zero (the default) disables the bound and restores
+      the fully optimal partition search. Bounding the movement trades
+      partition optimality for drastically cheaper post-rebalance particle
+      migration when the workload drifts slowly.
+      \param max_shift Maximum per-rebalance plane movement in tiles.
+    */
+    void setMaxPlaneShift( const int max_shift )
+    {
+        _max_plane_shift = max_shift;
+    }
+
     /*!
       \brief compute the total workload on the current MPI rank
       \param cart_comm MPI cartesian communicator
@@ -881,6 +972,8 @@ class SparseDimPartitioner : public BlockPartitioner<NumSpaceDim>
     int _num_step_rebalance;
     // max_optimize iterations
     int _max_optimize_iteration;
+    // maximum per-rebalance partition plane movement in tiles (0 = unbounded)
+    int _max_plane_shift = 0;
 
     // represent the rectangle partition in each dimension
     // with form [0, p_1, ..., p_n, cell_num], n = rank num in current
@@ -376,6 +376,38 @@ class SparseHalo
         }
     }
 
+    //---------------------------------------------------------------------------//
+    /*!
+        \brief re-register valid halos only if the sparse map activation
+       changed since the last registration
+        \tparam ExecSpace execution space
+        \tparam SparseMapType sparse map type
+        \param comm MPI communicator
+        \param map sparse map
+        \return true if a re-registration was performed
+
+       Tile activation in the sparse map is monotonic between map clears, so
+       an unchanged valid-tile count means no tile changed activation state
+       since the last registration and the previous steering, valid counts,
+       and exchange pattern all remain correct. When false is returned the
+       caller can also reuse the collected neighbor counting (pass
+       is_neighbor_counting_collected = true to the scatter/gather) and skip
+       the count re-negotiation entirely - the win when well under a percent
+       of tiles change per step.
+    */
+    template <class ExecSpace, class SparseMapType>
+    bool updateRegistration( MPI_Comm comm, SparseMapType& map )
+    {
+        const unsigned long long tile_num = map.sizeTile();
+        if ( _registered_tile_num == tile_num )
+            return false;
+
+        clear( comm );
+        register_halo<ExecSpace>( map );
+        _registered_tile_num = tile_num;
+        return true;
+    }
+
     //---------------------------------------------------------------------------//
     /*!
         \brief clear guiding information in sparse halo,
@@ -386,6 +418,9 @@ class SparseHalo
     */
     void clear( MPI_Comm comm )
     {
+        // any previous registration is invalidated
+        _registered_tile_num = ~0ull;
+
         // clear counting
         for ( std::size_t i = 0; i < _valid_counting.size(); ++i )
             Kokkos::deep_copy( _valid_counting[i], 0 );
@@ -1271,6 +1306,10 @@ class SparseHalo
     // valid halo grid counting on corresponding neighbor ranks
     std::vector<counting_view> _neighbor_counting;
 
+    // valid tile count of the sparse map at the last registration (used by
+    // updateRegistration to skip redundant re-registration)
+    unsigned long long _registered_tile_num = ~0ull;
+
     // owned tile space
     std::vector<tile_index_space> _owned_tile_spaces;
     // ghosted tile space
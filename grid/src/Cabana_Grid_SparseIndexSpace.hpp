@@ -634,6 +634,17 @@ class SparseMap
         return _block_id_space.value_at( index );
     }
 
+    /*!
+      \brief (Device) Set the tile No. stored at a given hash table index.
+      \param index The index of pair in the hash table
+      \param value The tile No. to store
+    */
+    KOKKOS_INLINE_FUNCTION
+    void set_value_at( uint32_t index, const value_type value ) const
+    {
+        _block_id_space.set_value_at( index, value );
+    }
+
     /*!
       \brief (Device) Transfer tile hash key to tile ijk
       \param key Tile hash key
@@ -703,6 +714,324 @@ SparseMap<MemorySpace, CellPerTileDim, Hash, Key, Value> createSparseMap(
         pre_alloc_size );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief (Host) Bulk particle registration into a sparse map with team-level
+  tile deduplication.
+
+  \tparam ExecutionSpace Kokkos execution space.
+  \tparam SparseMapType The sparse map type.
+  \tparam PositionType Container type with view traits containing the point
+  coordinates. Will be indexed as (point,dim).
+  \tparam Scalar Mesh scalar type.
+
+  \param map The sparse map to register the points in.
+  \param positions The point coordinates.
+  \param num_point The number of points.
+  \param grid_min The global low corner of the grid.
+  \param inv_dx The inverse cell size.
+
+  One team stages the tile ids of a contiguous block of points in team
+  scratch and only the first owner of each distinct tile touches the hash
+  table, so points sharing a tile - the common case that makes per-thread
+  inserts collide heavily - produce a single insert per team. Spatially
+  coherent (e.g. cell-sorted) orderings benefit the most. Grow the table
+  with reserve() ahead of registration as with per-thread inserts.
+*/
+template <class ExecutionSpace, class SparseMapType, class PositionType,
+          class Scalar>
+void bulkInsertCells( ExecutionSpace, SparseMapType& map,
+                      const PositionType& positions,
+                      const std::size_t num_point,
+                      const Kokkos::Array<Scalar, 3>& grid_min,
+                      const Scalar inv_dx )
+{
+    Kokkos::Profiling::ScopedRegion region(
+        "Cabana::Grid::bulkInsertCells" );
+
+    constexpr int chunk = 128;
+    using team_policy_type =
+        Kokkos::TeamPolicy<ExecutionSpace, Kokkos::Schedule<Kokkos::Dynamic>>;
+    using scratch_tiles_type =
+        Kokkos::View<int* [3], typename ExecutionSpace::scratch_memory_space,
+                     Kokkos::MemoryUnmanaged>;
+
+    const int league_size = ( num_point + chunk - 1 ) / chunk;
+    auto team_policy =
+        team_policy_type( league_size, Kokkos::AUTO )
+            .set_scratch_size(
+                0, Kokkos::PerTeam( scratch_tiles_type::shmem_size( chunk ) ) );
+
+    Kokkos::parallel_for(
+        "Cabana::Grid::bulkInsertCells", team_policy,
+        KOKKOS_LAMBDA( const typename team_policy_type::member_type& team ) {
+            const std::size_t begin =
+                static_cast<std::size_t>( team.league_rank() ) * chunk;
+            const int n_local =
+                ( begin + chunk <= num_point )
+                    ? chunk
+                    : static_cast<int>( num_point - begin );
+
+            // Stage the tile ids of this block of points.
+            scratch_tiles_type tiles( team.team_scratch( 0 ), chunk );
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange( team, n_local ),
+                [&]( const int t )
+                {
+                    const std::size_t p = begin + t;
+                    for ( int d = 0; d < 3; ++d )
+                        tiles( t, d ) =
+                            static_cast<int>( Kokkos::floor(
+                                ( positions( p, d ) - grid_min[d] ) *
+                                inv_dx ) ) >>
+                            SparseMapType::cell_bits_per_tile_dim;
+                } );
+            team.team_barrier();
+
+            // Only the first owner of each distinct tile inserts it.
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange( team, n_local ),
+                [&]( const int t )
+                {
+                    for ( int m = 0; m < t; ++m )
+                        if ( tiles( m, 0 ) == tiles( t, 0 ) &&
+                             tiles( m, 1 ) == tiles( t, 1 ) &&
+                             tiles( m, 2 ) == tiles( t, 2 ) )
+                            return;
+                    map.insertTile( tiles( t, 0 ), tiles( t, 1 ),
+                                    tiles( t, 2 ) );
+                } );
+        } );
+    Kokkos::fence();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Flat open-addressing query table snapshot of a sparse map.
+
+  \tparam MemorySpace Kokkos memory space.
+  \tparam KeyType Tile hash key type.
+  \tparam ValueType Tile id type.
+
+  A read-optimized alternative backend for tile queries: power-of-two
+  capacity, linear probing over flat key/value arrays, and a load factor
+  fixed at build time (a perfect rehash of the current contents). Lookups
+  touch one or two consecutive cache lines instead of the
+  Kokkos::UnorderedMap probing chains, which dominates sparse G2P query
+  cost. The table is a snapshot - rebuild after registration changes.
+*/
+template <class MemorySpace, class KeyType, class ValueType>
+class FlatQueryTable
+{
+  public:
+    //! Invalid key sentinel.
+    static constexpr KeyType empty_key = ~static_cast<KeyType>( 0 );
+
+    //! Default constructor.
+    FlatQueryTable() = default;
+
+    /*!
+      \brief Build the table from a sparse map.
+      \param map The sparse map to snapshot.
+      \param load_factor Maximum fraction of slots occupied.
+    */
+    template <class ExecutionSpace, class SparseMapType>
+    void build( ExecutionSpace, const SparseMapType& map,
+                const double load_factor = 0.5 )
+    {
+        // Power-of-two capacity bounding the load factor.
+        std::size_t capacity = 16;
+        const std::size_t min_capacity =
+            static_cast<std::size_t>( map.sizeTile() / load_factor ) + 1;
+        while ( capacity < min_capacity )
+            capacity *= 2;
+        _mask = capacity - 1;
+
+        _keys = Kokkos::View<KeyType*, MemorySpace>(
+            Kokkos::ViewAllocateWithoutInitializing( "flat_table_keys" ),
+            capacity );
+        _values = Kokkos::View<ValueType*, MemorySpace>(
+            Kokkos::ViewAllocateWithoutInitializing( "flat_table_values" ),
+            capacity );
+        Kokkos::deep_copy( _keys, empty_key );
+
+        // Insert every valid tile with linear probing.
+        auto keys = _keys;
+        auto values = _values;
+        auto mask = _mask;
+        Kokkos::parallel_for(
+            "Cabana::Grid::FlatQueryTable::build",
+            Kokkos::RangePolicy<ExecutionSpace>( 0, map.capacity() ),
+            KOKKOS_LAMBDA( const int index ) {
+                if ( map.valid_at( index ) )
+                {
+                    const KeyType key = map.key_at( index );
+                    std::size_t slot = key & mask;
+                    while ( true )
+                    {
+                        if ( Kokkos::atomic_compare_exchange(
+                                 &keys( slot ), empty_key, key ) ==
+                             empty_key )
+                        {
+                            values( slot ) = map.value_at( index );
+                            break;
+                        }
+                        slot = ( slot + 1 ) & mask;
+                    }
+                }
+            } );
+        Kokkos::fence();
+    }
+
+    /*!
+      \brief (Device) Find the tile id of a tile key.
+      \param key The tile hash key.
+      \return The tile id, or ~0 when the tile is inactive.
+    */
+    KOKKOS_INLINE_FUNCTION
+    ValueType find( const KeyType key ) const
+    {
+        std::size_t slot = key & _mask;
+        while ( true )
+        {
+            const KeyType slot_key = _keys( slot );
+            if ( slot_key == key )
+                return _values( slot );
+            if ( slot_key == empty_key )
+                return ~static_cast<ValueType>( 0 );
+            slot = ( slot + 1 ) & _mask;
+        }
+    }
+
+    //! Get the table capacity.
+    std::size_t capacity() const { return _mask + 1; }
+
+  private:
+    Kokkos::View<KeyType*, MemorySpace> _keys;
+    Kokkos::View<ValueType*, MemorySpace> _values;
+    std::size_t _mask = 0;
+};
+
+/*!
+  \brief Build a flat open-addressing query table from a sparse map.
+  \param map The sparse map to snapshot.
+  \param load_factor Maximum fraction of slots occupied.
+  \return FlatQueryTable over the map's current contents.
+*/
+template <class ExecutionSpace, class SparseMapType>
+auto createFlatQueryTable( ExecutionSpace exec_space,
+                           const SparseMapType& map,
+                           const double load_factor = 0.5 )
+{
+    FlatQueryTable<typename SparseMapType::memory_space,
+                   typename SparseMapType::key_type,
+                   typename SparseMapType::value_type>
+        table;
+    table.build( exec_space, map, load_factor );
+    return table;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Compact list of the active tiles of a sparse map.
+
+  \tparam MemorySpace Kokkos memory space.
+
+  A flat array of the valid (key, tile id) pairs collected once per
+  activation state, so sweeps iterate exactly the active tiles instead of
+  probing the hash table per cell.
+*/
+template <class MemorySpace, class KeyType, class ValueType>
+struct ActiveTiles
+{
+    //! Tile hash keys of the active tiles.
+    Kokkos::View<KeyType*, MemorySpace> keys;
+    //! Registered tile ids of the active tiles.
+    Kokkos::View<ValueType*, MemorySpace> ids;
+    //! Number of active tiles.
+    std::size_t num_tile;
+};
+
+/*!
+  \brief Collect the active tiles of a sparse map.
+  \param map The sparse map. Rebuild the list when the activation state
+  changes.
+  \return ActiveTiles over the map's valid tiles.
+*/
+template <class ExecutionSpace, class SparseMapType>
+auto createActiveTiles( ExecutionSpace, const SparseMapType& map )
+{
+    using memory_space = typename SparseMapType::memory_space;
+    using key_type = typename SparseMapType::key_type;
+    using value_type = typename SparseMapType::value_type;
+
+    ActiveTiles<memory_space, key_type, value_type> tiles;
+    tiles.num_tile = map.sizeTile();
+    tiles.keys = Kokkos::View<key_type*, memory_space>(
+        Kokkos::ViewAllocateWithoutInitializing( "active_tile_keys" ),
+        tiles.num_tile );
+    tiles.ids = Kokkos::View<value_type*, memory_space>(
+        Kokkos::ViewAllocateWithoutInitializing( "active_tile_ids" ),
+        tiles.num_tile );
+
+    auto keys = tiles.keys;
+    auto ids = tiles.ids;
+    Kokkos::View<int, memory_space> counter( "active_tile_counter" );
+    Kokkos::parallel_for(
+        "Cabana::Grid::createActiveTiles",
+        Kokkos::RangePolicy<ExecutionSpace>( 0, map.capacity() ),
+        KOKKOS_LAMBDA( const int index ) {
+            if ( map.valid_at( index ) )
+            {
+                const int i = Kokkos::atomic_fetch_add( &counter(), 1 );
+                keys( i ) = map.key_at( index );
+                ids( i ) = map.value_at( index );
+            }
+        } );
+    Kokkos::fence();
+    return tiles;
+}
+
+/*!
+  \brief Execute a functor in parallel over the cells of every active tile
+  of a sparse map.
+
+  \param label Parallel region label.
+  \param exec_space Kokkos execution space instance.
+  \param tiles The active tile list from createActiveTiles().
+  \param cell_num_per_tile Number of cells per tile
+  (SparseMapType::cell_num_per_tile).
+  \param functor Invoked as functor( tile_id, cell_id ) with the registered
+  tile id and the local cell id inside the tile.
+
+  Dispatches exactly one team per active tile and vectorizes over the
+  tile's cells, so sparse sweeps never consult the hash table per cell and
+  never visit inactive tiles.
+*/
+template <class ExecutionSpace, class TilesType, class FunctorType>
+void sparse_parallel_for( const std::string& label,
+                          const ExecutionSpace& exec_space,
+                          const TilesType& tiles,
+                          const int cell_num_per_tile,
+                          const FunctorType& functor )
+{
+    Kokkos::Profiling::ScopedRegion region(
+        "Cabana::Grid::sparse_parallel_for" );
+
+    using team_policy_type =
+        Kokkos::TeamPolicy<ExecutionSpace, Kokkos::Schedule<Kokkos::Dynamic>>;
+    team_policy_type team_policy( exec_space, tiles.num_tile, Kokkos::AUTO );
+    auto ids = tiles.ids;
+    Kokkos::parallel_for(
+        label, team_policy,
+        KOKKOS_LAMBDA( const typename team_policy_type::member_type& team ) {
+            const auto tile_id = ids( team.league_rank() );
+            Kokkos::parallel_for(
+                Kokkos::TeamVectorRange( team, cell_num_per_tile ),
+                [&]( const int cell_id ) { functor( tile_id, cell_id ); } );
+        } );
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Block index space, mapping tile ijks to tile No. through a hash table
@@ -837,6 +1166,17 @@ class BlockMap
         return _tile_table.value_at( index );
     }
 
+    /*!
+      \brief (Device) set block id value at index
+      \param index index value in kokkos unordered map
+      \param value block id value to store
+    */
+    KOKKOS_INLINE_FUNCTION
+    void set_value_at( uint32_t index, const value_type value ) const
+    {
+        _tile_table.value_at( index ) = value;
+    }
+
     /*!
       \brief (Device) Valid tile number inside current block (MPI rank)
     */
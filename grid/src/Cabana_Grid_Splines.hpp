@@ -451,6 +451,318 @@ struct Spline<3>
     }
 };
 
+//---------------------------------------------------------------------------//
+//! Quartic. Defined on the dual grid.
+template <>
+struct Spline<4>
+{
+    //! Order.
+    static constexpr int order = 4;
+
+    //! The number of non-zero knots in the spline.
+    static constexpr int num_knot = 5;
+
+    /*!
+      \brief Map a physical location to the logical space of the dual grid in a
+      single dimension.
+      \param xp The coordinate to map to the logical space.
+      \param rdx The inverse of the physical distance between grid locations.
+      \param low_x The physical location of the low corner of the dual grid.
+      \return The coordinate in the logical dual grid space.
+
+      \note Casting this result to an integer yields the index at the center
+      of the stencil.
+      \note A quartic spline uses the dual grid.
+    */
+    template <class Scalar>
+    KOKKOS_INLINE_FUNCTION static Scalar
+    mapToLogicalGrid( const Scalar xp, const Scalar rdx, const Scalar low_x )
+    {
+        return ( xp - low_x ) * rdx + 0.5;
+    }
+
+    /*!
+      \brief Get the logical space stencil offsets of the spline. The stencil
+      defines the offsets into a grid field about a logical coordinate.
+      \param indices The stencil index offsets.
+    */
+    KOKKOS_INLINE_FUNCTION
+    static void offsets( int indices[num_knot] )
+    {
+        indices[0] = -2;
+        indices[1] = -1;
+        indices[2] = 0;
+        indices[3] = 1;
+        indices[4] = 2;
+    }
+
+    /*!
+      \brief Compute the stencil indices for a given logical space location.
+      \param x0 The coordinate at which to evaluate the spline stencil.
+      \param indices The indices of the stencil.
+    */
+    template <class Scalar>
+    KOKKOS_INLINE_FUNCTION static void stencil( const Scalar x0,
+                                                int indices[num_knot] )
+    {
+        indices[0] = static_cast<int>( x0 ) - 2;
+        indices[1] = indices[0] + 1;
+        indices[2] = indices[1] + 1;
+        indices[3] = indices[2] + 1;
+        indices[4] = indices[3] + 1;
+    }
+
+    /*!
+       \brief Calculate the value of the spline at all knots.
+       \param x0 The coordinate at which to evaluate the spline in the logical
+       grid space.
+       \param values Basis values at the knots. Ordered from lowest to highest
+       in terms of knot location.
+    */
+    template <typename Scalar>
+    KOKKOS_INLINE_FUNCTION static void value( const Scalar x0,
+                                              Scalar values[num_knot] )
+    {
+        // Constants
+        Scalar one_24th = 1.0 / 24.0;
+        Scalar one_96th = 1.0 / 96.0;
+
+        // Knot at i - 2
+        Scalar xn = x0 - static_cast<int>( x0 ) + 1.5;
+        Scalar xf = 2.5 - xn;
+        values[0] = xf * xf * xf * xf * one_24th;
+
+        // Knot at i - 1
+        xn -= 1.0;
+        Scalar xn2 = xn * xn;
+        values[1] = ( 55.0 + 20.0 * xn - 120.0 * xn2 + 80.0 * xn * xn2 -
+                      16.0 * xn2 * xn2 ) *
+                    one_96th;
+
+        // Knot at i
+        xn -= 1.0;
+        xn2 = xn * xn;
+        values[2] = 115.0 / 192.0 - 0.625 * xn2 + 0.25 * xn2 * xn2;
+
+        // Knot at i + 1
+        xn -= 1.0;
+        xn2 = xn * xn;
+        values[3] = ( 55.0 - 20.0 * xn - 120.0 * xn2 - 80.0 * xn * xn2 -
+                      16.0 * xn2 * xn2 ) *
+                    one_96th;
+
+        // Knot at i + 2
+        xn -= 1.0;
+        xf = 2.5 + xn;
+        values[4] = xf * xf * xf * xf * one_24th;
+    }
+
+    /*!
+      \brief Calculate the value of the gradient of the spline in the
+      physical frame.
+      \param x0 The coordinate at which to evaluate the spline in the logical
+      grid space.
+      \param rdx The inverse of the physical distance between grid locations.
+      \param gradients Basis gradient values at the knots in the physical
+      frame. Ordered from lowest to highest in terms of knot location.
+    */
+    template <typename Scalar>
+    KOKKOS_INLINE_FUNCTION static void
+    gradient( const Scalar x0, const Scalar rdx, Scalar gradients[num_knot] )
+    {
+        // Constants
+        Scalar one_sixth = 1.0 / 6.0;
+        Scalar one_96th = 1.0 / 96.0;
+
+        // Knot at i - 2
+        Scalar xn = x0 - static_cast<int>( x0 ) + 1.5;
+        Scalar xf = 2.5 - xn;
+        gradients[0] = -xf * xf * xf * one_sixth * rdx;
+
+        // Knot at i - 1
+        xn -= 1.0;
+        Scalar xn2 = xn * xn;
+        gradients[1] = ( 20.0 - 240.0 * xn + 240.0 * xn2 - 64.0 * xn * xn2 ) *
+                       one_96th * rdx;
+
+        // Knot at i
+        xn -= 1.0;
+        gradients[2] = ( -1.25 * xn + xn * xn * xn ) * rdx;
+
+        // Knot at i + 1
+        xn -= 1.0;
+        xn2 = xn * xn;
+        gradients[3] = ( -20.0 - 240.0 * xn - 240.0 * xn2 - 64.0 * xn * xn2 ) *
+                       one_96th * rdx;
+
+        // Knot at i + 2
+        xn -= 1.0;
+        xf = 2.5 + xn;
+        gradients[4] = xf * xf * xf * one_sixth * rdx;
+    }
+};
+
+//---------------------------------------------------------------------------//
+//! Quintic. Defined on the primal grid.
+template <>
+struct Spline<5>
+{
+    //! Order.
+    static constexpr int order = 5;
+
+    //! The number of non-zero knots in the spline.
+    static constexpr int num_knot = 6;
+
+    /*!
+      \brief Map a physical location to the logical space of the primal grid in
+      a single dimension. \param xp The coordinate to map to the logical space.
+      \param rdx The inverse of the physical distance between grid locations.
+      \param low_x The physical location of the low corner of the primal
+      grid.
+      \return The coordinate in the logical primal grid space.
+
+      \note Casting this result to an integer yields the index at the center
+      of the stencil.
+      \note A quintic spline uses the primal grid.
+    */
+    template <class Scalar>
+    KOKKOS_INLINE_FUNCTION static Scalar
+    mapToLogicalGrid( const Scalar xp, const Scalar rdx, const Scalar low_x )
+    {
+        return ( xp - low_x ) * rdx;
+    }
+
+    /*!
+      \brief Get the logical space stencil offsets of the spline. The stencil
+      defines the offsets into a grid field about a logical coordinate.
+      \param indices The stencil index offsets.
+    */
+    KOKKOS_INLINE_FUNCTION
+    static void offsets( int indices[num_knot] )
+    {
+        indices[0] = -2;
+        indices[1] = -1;
+        indices[2] = 0;
+        indices[3] = 1;
+        indices[4] = 2;
+        indices[5] = 3;
+    }
+
+    /*!
+      \brief Compute the stencil indices for a given logical space location.
+      \param x0 The coordinate at which to evaluate the spline stencil.
+      \param indices The indices of the stencil.
+    */
+    template <class Scalar>
+    KOKKOS_INLINE_FUNCTION static void stencil( const Scalar x0,
+                                                int indices[num_knot] )
+    {
+        indices[0] = static_cast<int>( x0 ) - 2;
+        indices[1] = indices[0] + 1;
+        indices[2] = indices[1] + 1;
+        indices[3] = indices[2] + 1;
+        indices[4] = indices[3] + 1;
+        indices[5] = indices[4] + 1;
+    }
+
+    /*!
+       \brief Calculate the value of the spline at all knots.
+       \param x0 The coordinate at which to evaluate the spline in the logical
+       grid space.
+       \param values Basis values at the knots. Ordered from lowest to highest
+       in terms of knot location.
+    */
+    template <typename Scalar>
+    KOKKOS_INLINE_FUNCTION static void value( const Scalar x0,
+                                              Scalar values[num_knot] )
+    {
+        // Constants
+        Scalar one_120th = 1.0 / 120.0;
+
+        auto quintic = []( const Scalar t )
+        { return t * t * t * t * t; };
+
+        // Knot at i - 2
+        Scalar xn = x0 - static_cast<int>( x0 ) + 2.0;
+        values[0] = quintic( 3.0 - xn ) * one_120th;
+
+        // Knot at i - 1
+        xn -= 1.0;
+        values[1] =
+            ( quintic( 3.0 - xn ) - 6.0 * quintic( 2.0 - xn ) ) * one_120th;
+
+        // Knot at i
+        xn -= 1.0;
+        values[2] = ( quintic( 3.0 - xn ) - 6.0 * quintic( 2.0 - xn ) +
+                      15.0 * quintic( 1.0 - xn ) ) *
+                    one_120th;
+
+        // Knot at i + 1
+        xn -= 1.0;
+        values[3] = ( quintic( 3.0 + xn ) - 6.0 * quintic( 2.0 + xn ) +
+                      15.0 * quintic( 1.0 + xn ) ) *
+                    one_120th;
+
+        // Knot at i + 2
+        xn -= 1.0;
+        values[4] =
+            ( quintic( 3.0 + xn ) - 6.0 * quintic( 2.0 + xn ) ) * one_120th;
+
+        // Knot at i + 3
+        xn -= 1.0;
+        values[5] = quintic( 3.0 + xn ) * one_120th;
+    }
+
+    /*!
+      \brief Calculate the value of the gradient of the spline in the
+      physical frame.
+      \param x0 The coordinate at which to evaluate the spline in the logical
+      grid space.
+      \param rdx The inverse of the physical distance between grid locations.
+      \param gradients Basis gradient values at the knots in the physical
+      frame. Ordered from lowest to highest in terms of knot location.
+    */
+    template <typename Scalar>
+    KOKKOS_INLINE_FUNCTION static void
+    gradient( const Scalar x0, const Scalar rdx, Scalar gradients[num_knot] )
+    {
+        // Constants
+        Scalar one_24th = 1.0 / 24.0;
+
+        auto quartic = []( const Scalar t ) { return t * t * t * t; };
+
+        // Knot at i - 2
+        Scalar xn = x0 - static_cast<int>( x0 ) + 2.0;
+        gradients[0] = -quartic( 3.0 - xn ) * one_24th * rdx;
+
+        // Knot at i - 1
+        xn -= 1.0;
+        gradients[1] = ( -quartic( 3.0 - xn ) + 6.0 * quartic( 2.0 - xn ) ) *
+                       one_24th * rdx;
+
+        // Knot at i
+        xn -= 1.0;
+        gradients[2] = ( -quartic( 3.0 - xn ) + 6.0 * quartic( 2.0 - xn ) -
+                         15.0 * quartic( 1.0 - xn ) ) *
+                       one_24th * rdx;
+
+        // Knot at i + 1
+        xn -= 1.0;
+        gradients[3] = ( quartic( 3.0 + xn ) - 6.0 * quartic( 2.0 + xn ) +
+                         15.0 * quartic( 1.0 + xn ) ) *
+                       one_24th * rdx;
+
+        // Knot at i + 2
+        xn -= 1.0;
+        gradients[4] = ( quartic( 3.0 + xn ) - 6.0 * quartic( 2.0 + xn ) ) *
+                       one_24th * rdx;
+
+        // Knot at i + 3
+        xn -= 1.0;
+        gradients[5] = quartic( 3.0 + xn ) * one_24th * rdx;
+    }
+};
+
 //---------------------------------------------------------------------------//
 // Spline Data
 //---------------------------------------------------------------------------//
@@ -856,6 +1168,135 @@ KOKKOS_INLINE_FUNCTION void evaluateSpline(
     setSplineData( SplinePhysicalDistance(), data, low_x, p, dx );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Lane-batched spline data with structure-of-arrays weight storage.
+
+  \tparam Scalar Scalar type.
+  \tparam Order Spline order.
+  \tparam NumSpaceDim Spatial dimension.
+  \tparam VectorLength Number of SIMD lanes batched per evaluation,
+  matching the AoSoA vector length when used with SimdPolicy tiling.
+  \tparam EntityType Entity type the spline interpolates to.
+
+  The per-particle SplineData is an AoS-style struct, which defeats
+  compiler vectorization across particles on CPU backends. Here every
+  member is stored with the lane index innermost, so the lane loops in
+  evaluateSplineBatch vectorize and downstream deposition reads
+  contiguous per-knot lanes.
+*/
+template <typename Scalar, int Order, std::size_t NumSpaceDim,
+          int VectorLength, class EntityType>
+struct SplineDataBatch
+{
+    //! Spline scalar type.
+    using scalar_type = Scalar;
+    //! Spline order.
+    static constexpr int order = Order;
+    //! Spline type.
+    using spline_type = Spline<Order>;
+    //! The number of non-zero knots in the spline.
+    static constexpr int num_knot = spline_type::num_knot;
+    //! Entity type.
+    using entity_type = EntityType;
+    //! Spatial dimension.
+    static constexpr std::size_t num_space_dim = NumSpaceDim;
+    //! Number of SIMD lanes.
+    static constexpr int vector_length = VectorLength;
+
+    //! Physical cell size (uniform across lanes).
+    Scalar dx[NumSpaceDim];
+    //! Logical positions, lane innermost.
+    Scalar x[NumSpaceDim][VectorLength];
+    //! Local interpolation stencils, lane innermost.
+    int s[NumSpaceDim][num_knot][VectorLength];
+    //! Weight values, lane innermost.
+    Scalar w[NumSpaceDim][num_knot][VectorLength];
+    //! Weight physical gradients, lane innermost.
+    Scalar g[NumSpaceDim][num_knot][VectorLength];
+    //! Physical distances, lane innermost.
+    Scalar d[NumSpaceDim][num_knot][VectorLength];
+};
+
+/*!
+  \brief Evaluate splines for a batch of SIMD lanes at once.
+
+  \param local_mesh The local mesh.
+  \param p Particle positions with the lane index innermost:
+  p[dim][lane].
+  \param num_lane Number of active lanes (the last struct of an AoSoA may
+  be partially full).
+  \param data Lane-batched spline data to fill.
+
+  The inner loops run over the lane index with all spline arithmetic
+  inlined and structure-of-arrays storage on both sides, so CPU backends
+  vectorize across particles; use from a simd_parallel_for by evaluating
+  once per struct index with the struct's lanes.
+*/
+template <typename Scalar, int Order, std::size_t NumSpaceDim,
+          int VectorLength, class EntityType, class MemorySpace>
+KOKKOS_INLINE_FUNCTION void evaluateSplineBatch(
+    const LocalMesh<MemorySpace, UniformMesh<Scalar, NumSpaceDim>>& local_mesh,
+    const Scalar p[NumSpaceDim][VectorLength], const int num_lane,
+    SplineDataBatch<Scalar, Order, NumSpaceDim, VectorLength, EntityType>&
+        data )
+{
+    using sd_type =
+        SplineDataBatch<Scalar, Order, NumSpaceDim, VectorLength, EntityType>;
+
+    // Get the low corner of the mesh and the cell size (uniform mesh, so
+    // these are lane-invariant).
+    Scalar low_x[NumSpaceDim];
+    Scalar low_x_p1[NumSpaceDim];
+    int low_id[NumSpaceDim];
+    int low_id_p1[NumSpaceDim];
+    for ( std::size_t d = 0; d < NumSpaceDim; ++d )
+    {
+        low_id[d] = 0;
+        low_id_p1[d] = 1;
+    }
+    local_mesh.coordinates( EntityType(), low_id, low_x );
+    local_mesh.coordinates( EntityType(), low_id_p1, low_x_p1 );
+
+    Scalar rdx[NumSpaceDim];
+    for ( std::size_t d = 0; d < NumSpaceDim; ++d )
+    {
+        data.dx[d] = low_x_p1[d] - low_x[d];
+        rdx[d] = 1.0 / data.dx[d];
+    }
+
+    // Per-lane spline arithmetic with the lane loop innermost. Scalar
+    // temporaries are scattered to the lane-innermost batch storage so
+    // both the math and the stores vectorize.
+    for ( std::size_t d = 0; d < NumSpaceDim; ++d )
+    {
+        for ( int a = 0; a < num_lane; ++a )
+        {
+            const Scalar xl = sd_type::spline_type::mapToLogicalGrid(
+                p[d][a], rdx[d], low_x[d] );
+            data.x[d][a] = xl;
+
+            int sl[sd_type::num_knot];
+            sd_type::spline_type::stencil( xl, sl );
+
+            Scalar wl[sd_type::num_knot];
+            sd_type::spline_type::value( xl, wl );
+
+            Scalar gl[sd_type::num_knot];
+            sd_type::spline_type::gradient( xl, rdx[d], gl );
+
+            const Scalar offset = low_x[d] - p[d][a];
+            for ( int k = 0; k < sd_type::num_knot; ++k )
+            {
+                data.s[d][k][a] = sl[k];
+                data.w[d][k][a] = wl[k];
+                data.g[d][k][a] = gl[k];
+                data.d[d][k][a] = offset + sl[k] * data.dx[d];
+            }
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 
 } // namespace Grid
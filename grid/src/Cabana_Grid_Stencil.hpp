@@ -0,0 +1,207 @@
+/****************************************************************************
+ * Copyright (c) 2018-2023 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_Grid_Stencil.hpp
+  \brief Compile-time stencil description and tuned sweeps.
+*/
+#ifndef CABANA_GRID_STENCIL_HPP
+#define CABANA_GRID_STENCIL_HPP
+
+#include <Cabana_Grid_Array.hpp>
+#include <Cabana_Grid_Halo.hpp>
+#include <Cabana_Grid_IndexSpace.hpp>
+#include <Cabana_Grid_Types.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <memory>
+#include <type_traits>
+
+namespace Cabana
+{
+namespace Grid
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Compile-time stencil point with logical index offsets as template
+  parameters.
+*/
+template <int I, int J, int K = 0>
+struct StencilPoint
+{
+    //! I logical offset.
+    static constexpr int i = I;
+    //! J logical offset.
+    static constexpr int j = J;
+    //! K logical offset.
+    static constexpr int k = K;
+
+    //! Infinity norm of the offsets.
+    static constexpr int reach = ( I < 0 ? -I : I ) > ( J < 0 ? -J : J )
+                                     ? ( ( I < 0 ? -I : I ) >
+                                                 ( K < 0 ? -K : K )
+                                             ? ( I < 0 ? -I : I )
+                                             : ( K < 0 ? -K : K ) )
+                                     : ( ( J < 0 ? -J : J ) >
+                                                 ( K < 0 ? -K : K )
+                                             ? ( J < 0 ? -J : J )
+                                             : ( K < 0 ? -K : K ) );
+};
+
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+template <class... Points>
+struct StencilReach;
+
+template <class Point>
+struct StencilReach<Point>
+{
+    static constexpr int value = Point::reach;
+};
+
+template <class Point, class... Points>
+struct StencilReach<Point, Points...>
+{
+    static constexpr int tail = StencilReach<Points...>::value;
+    static constexpr int value = Point::reach > tail ? Point::reach : tail;
+};
+} // namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Compile-time stencil: a pack of offset points with runtime
+  coefficients.
+
+  \tparam Scalar Coefficient type.
+  \tparam Points StencilPoint pack describing the offsets.
+
+  The offsets are template parameters so the generated sweep unrolls the
+  point loop completely, and the stencil declares its halo width so the
+  ghost exchange it needs can be built from the operator itself.
+  Coefficients are stored at runtime (non-type floating-point template
+  parameters would need a newer language standard) but live in a
+  fixed-size array the compiler keeps in registers.
+*/
+template <class Scalar, class... Points>
+struct Stencil
+{
+    //! Coefficient type.
+    using scalar_type = Scalar;
+    //! Number of stencil points.
+    static constexpr std::size_t num_point = sizeof...( Points );
+    //! Halo width required by the stencil offsets.
+    static constexpr int halo_width = Impl::StencilReach<Points...>::value;
+
+    //! The coefficient of each point, in pack order.
+    Kokkos::Array<Scalar, num_point> coefficients;
+
+    //! Evaluate the stencil for one entity of a rank-4 (3d) view.
+    template <class DstView, class SrcView>
+    KOKKOS_INLINE_FUNCTION void apply( const DstView& dst,
+                                       const SrcView& src, const int i,
+                                       const int j, const int k,
+                                       const int l ) const
+    {
+        applyImpl( dst, src, i, j, k, l,
+                   std::make_index_sequence<num_point>{} );
+    }
+
+  private:
+    template <class DstView, class SrcView, std::size_t... N>
+    KOKKOS_INLINE_FUNCTION void
+    applyImpl( const DstView& dst, const SrcView& src, const int i,
+               const int j, const int k, const int l,
+               std::index_sequence<N...> ) const
+    {
+        dst( i, j, k, l ) =
+            ( ( coefficients[N] *
+                src( i + Points::i, j + Points::j, k + Points::k, l ) ) +
+              ... );
+    }
+};
+
+/*!
+  \brief Create a stencil from its point offsets and coefficients.
+  \param coefficients The coefficient of each point, in point order.
+  \return Stencil with the given compile-time offsets.
+*/
+template <class... Points, class Scalar>
+constexpr auto
+makeStencil( const Kokkos::Array<Scalar, sizeof...( Points )>& coefficients )
+{
+    return Stencil<Scalar, Points...>{ coefficients };
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create the halo the stencil needs for its ghost exchange.
+  \param stencil The stencil declaring its width.
+  \param arrays The arrays the stencil will be applied to.
+  \return Shared pointer to a Halo of the stencil-declared width with the
+  full node pattern (general stencils touch corners).
+*/
+template <class Scalar, class... Points, class... ArrayTypes>
+auto createStencilHalo( const Stencil<Scalar, Points...>&,
+                        const ArrayTypes&... arrays )
+{
+    return createHalo( NodeHaloPattern<3>(),
+                       Stencil<Scalar, Points...>::halo_width, arrays... );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Apply a compile-time stencil over the owned entities of an array.
+
+  \param stencil The stencil to apply.
+  \param dst The array receiving the result. Must share the layout of the
+  source and must not alias it.
+  \param src The source array. Ghosts must be current over the stencil
+  halo width (gather through createStencilHalo()).
+
+  One library-tuned sweep serves every operator expressed this way: the
+  point loop is fully unrolled from the compile-time offsets, the
+  multidimensional policy uses the library tiling, and the per-entity
+  work is pure FMA on the coefficient array.
+*/
+template <class Scalar, class... Points, class DstArray_t, class SrcArray_t>
+void applyStencil( const Stencil<Scalar, Points...>& stencil,
+                   DstArray_t& dst, const SrcArray_t& src )
+{
+    static_assert( is_array<DstArray_t>::value,
+                   "Cabana::Grid::Array required" );
+    static_assert( is_array<SrcArray_t>::value,
+                   "Cabana::Grid::Array required" );
+    static_assert( 3 == DstArray_t::num_space_dim,
+                   "Stencil sweeps are three dimensional" );
+
+    auto own_space =
+        dst.layout()->indexSpace( Own(), Local() );
+    auto dst_view = dst.view();
+    auto src_view = src.view();
+    Kokkos::parallel_for(
+        "Cabana::Grid::applyStencil",
+        createExecutionPolicy( own_space,
+                               typename DstArray_t::execution_space() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k, const int l ) {
+            stencil.apply( dst_view, src_view, i, j, k, l );
+        } );
+}
+
+//---------------------------------------------------------------------------//
+
+} // namespace Grid
+} // namespace Cabana
+
+#endif // end CABANA_GRID_STENCIL_HPP
@@ -13,6 +13,7 @@
 #include <Cabana_Grid_GlobalGrid.hpp>
 #include <Cabana_Grid_GlobalMesh.hpp>
 #include <Cabana_Grid_Partitioner.hpp>
+#include <Cabana_Grid_Stencil.hpp>
 #include <Cabana_Grid_Types.hpp>
 
 #include <Kokkos_Core.hpp>
@@ -230,6 +231,115 @@ void arrayTest()
         EXPECT_EQ( view.extent( i ), space.extent( i ) );
 }
 
+//---------------------------------------------------------------------------//
+void componentLayoutTest()
+{
+    // Let MPI compute the partitioning for this test.
+    Cabana::Grid::DimBlockPartitioner<3> partitioner;
+
+    // Create the global grid.
+    double cell_size = 0.23;
+    std::array<int, 3> global_num_cell = { 37, 15, 20 };
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    std::array<double, 3> global_low_corner = { 1.2, 3.3, -2.8 };
+    std::array<double, 3> global_high_corner = {
+        global_low_corner[0] + cell_size * global_num_cell[0],
+        global_low_corner[1] + cell_size * global_num_cell[1],
+        global_low_corner[2] + cell_size * global_num_cell[2] };
+    auto global_mesh = Cabana::Grid::createUniformGlobalMesh(
+        global_low_corner, global_high_corner, global_num_cell );
+    auto global_grid = Cabana::Grid::createGlobalGrid(
+        MPI_COMM_WORLD, global_mesh, is_dim_periodic, partitioner );
+
+    // Create interleaved and planar arrays over the same layout.
+    int halo_width = 2;
+    int dofs_per_cell = 4;
+    auto cell_layout = Cabana::Grid::createArrayLayout( global_grid, halo_width,
+                                                        dofs_per_cell, Cell() );
+    auto interleaved =
+        Cabana::Grid::createArray<double, Cabana::Grid::InterleavedComponents,
+                                  TEST_MEMSPACE>( "interleaved", cell_layout );
+    auto planar =
+        Cabana::Grid::createArray<double, Cabana::Grid::PlanarComponents,
+                                  TEST_MEMSPACE>( "planar", cell_layout );
+
+    // The layouts place the component dimension at opposite strides.
+    EXPECT_EQ( interleaved->view().stride( 3 ), 1 );
+    EXPECT_EQ( planar->view().stride( 0 ), 1 );
+
+    // Convert between the layouts and check values survive.
+    Cabana::Grid::ArrayOp::assign( *interleaved, 5.34, Ghost() );
+    Cabana::Grid::ArrayOp::copyComponentLayout( *planar, *interleaved,
+                                                Ghost() );
+
+    auto host_view = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), planar->view() );
+    auto space = cell_layout->indexSpace( Ghost(), Local() );
+    for ( long i = 0; i < space.extent( 0 ); ++i )
+        for ( long j = 0; j < space.extent( 1 ); ++j )
+            for ( long k = 0; k < space.extent( 2 ); ++k )
+                for ( long l = 0; l < space.extent( 3 ); ++l )
+                    EXPECT_DOUBLE_EQ( host_view( i, j, k, l ), 5.34 );
+}
+
+//---------------------------------------------------------------------------//
+void stencilTest()
+{
+    // Let MPI compute the partitioning for this test.
+    Cabana::Grid::DimBlockPartitioner<3> partitioner;
+
+    // Create the global grid.
+    double cell_size = 0.23;
+    std::array<int, 3> global_num_cell = { 20, 17, 22 };
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    std::array<double, 3> global_low_corner = { 1.2, 3.3, -2.8 };
+    std::array<double, 3> global_high_corner = {
+        global_low_corner[0] + cell_size * global_num_cell[0],
+        global_low_corner[1] + cell_size * global_num_cell[1],
+        global_low_corner[2] + cell_size * global_num_cell[2] };
+    auto global_mesh = Cabana::Grid::createUniformGlobalMesh(
+        global_low_corner, global_high_corner, global_num_cell );
+    auto global_grid = Cabana::Grid::createGlobalGrid(
+        MPI_COMM_WORLD, global_mesh, is_dim_periodic, partitioner );
+
+    int halo_width = 2;
+    auto cell_layout = Cabana::Grid::createArrayLayout( global_grid,
+                                                        halo_width, 1,
+                                                        Cell() );
+    auto src =
+        Cabana::Grid::createArray<double, TEST_MEMSPACE>( "src", cell_layout );
+    auto dst =
+        Cabana::Grid::createArray<double, TEST_MEMSPACE>( "dst", cell_layout );
+
+    // A 7-point stencil declared at compile time.
+    using C = Cabana::Grid::StencilPoint<0, 0, 0>;
+    using XL = Cabana::Grid::StencilPoint<-1, 0, 0>;
+    using XH = Cabana::Grid::StencilPoint<1, 0, 0>;
+    using YL = Cabana::Grid::StencilPoint<0, -1, 0>;
+    using YH = Cabana::Grid::StencilPoint<0, 1, 0>;
+    using ZL = Cabana::Grid::StencilPoint<0, 0, -1>;
+    using ZH = Cabana::Grid::StencilPoint<0, 0, 1>;
+    auto stencil =
+        Cabana::Grid::makeStencil<C, XL, XH, YL, YH, ZL, ZH>(
+            Kokkos::Array<double, 7>{ -6.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 } );
+    EXPECT_EQ( decltype( stencil )::halo_width, 1 );
+
+    // The declared halo keeps the ghosts current for the sweep.
+    auto halo = Cabana::Grid::createStencilHalo( stencil, *src );
+    Cabana::Grid::ArrayOp::assign( *src, 2.5, Ghost() );
+    halo->gather( TEST_EXECSPACE(), *src );
+    Cabana::Grid::applyStencil( stencil, *dst, *src );
+
+    // A constant field is in the Laplacian null space.
+    auto host_view = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), dst->view() );
+    auto own_space = cell_layout->indexSpace( Own(), Local() );
+    for ( long i = own_space.min( 0 ); i < own_space.max( 0 ); ++i )
+        for ( long j = own_space.min( 1 ); j < own_space.max( 1 ); ++j )
+            for ( long k = own_space.min( 2 ); k < own_space.max( 2 ); ++k )
+                EXPECT_DOUBLE_EQ( host_view( i, j, k, 0 ), 0.0 );
+}
+
 //---------------------------------------------------------------------------//
 void arrayOpTest()
 {
@@ -337,6 +447,19 @@ void arrayOpTest()
         EXPECT_FLOAT_EQ( dots[n],
                          ( 3.0 * scales[n] + 1.0 ) * 0.5 * total_num_cell );
 
+    // Compute a batch of dot products in one reduction and allreduce.
+    using array_type = std::remove_reference_t<decltype( *array )>;
+    std::vector<std::pair<const array_type*, const array_type*>> dot_pairs = {
+        { array.get(), array_2.get() }, { array_2.get(), array_2.get() } };
+    std::vector<std::vector<double>> batched_dots(
+        2, std::vector<double>( dofs_per_cell ) );
+    Cabana::Grid::ArrayOp::dot( dot_pairs, batched_dots );
+    for ( int n = 0; n < dofs_per_cell; ++n )
+    {
+        EXPECT_FLOAT_EQ( batched_dots[0][n], dots[n] );
+        EXPECT_FLOAT_EQ( batched_dots[1][n], 0.25 * total_num_cell );
+    }
+
     // Compute the two-norm of the array components
     std::vector<double> norm_2( dofs_per_cell );
     Cabana::Grid::ArrayOp::norm2( *array, norm_2 );
@@ -362,6 +485,42 @@ void arrayOpTest()
     Cabana::Grid::ArrayOp::normInf( *array, norm_inf );
     for ( int n = 0; n < dofs_per_cell; ++n )
         EXPECT_FLOAT_EQ( norm_inf[n], fabs( large_vals[n] ) );
+
+    // Device-resident norms: the unfenced local reduction plus the batched
+    // cross-rank fold matches the host-returning variants.
+    Kokkos::View<double*, TEST_MEMSPACE> device_norms( "device_norms",
+                                                       dofs_per_cell );
+    Cabana::Grid::ArrayOp::norm1Local( TEST_EXECSPACE{}, *array,
+                                       device_norms );
+    Cabana::Grid::ArrayOp::reduceNorms(
+        TEST_EXECSPACE{}, device_norms,
+        array->layout()->localGrid()->globalGrid().comm(), MPI_SUM );
+    auto norms_host = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                           device_norms );
+    std::vector<double> norm_1_check( dofs_per_cell );
+    Cabana::Grid::ArrayOp::norm1( *array, norm_1_check );
+    for ( int n = 0; n < dofs_per_cell; ++n )
+        EXPECT_FLOAT_EQ( norms_host( n ), norm_1_check[n] );
+
+    Cabana::Grid::ArrayOp::normInfLocal( TEST_EXECSPACE{}, *array,
+                                         device_norms );
+    Cabana::Grid::ArrayOp::reduceNorms(
+        TEST_EXECSPACE{}, device_norms,
+        array->layout()->localGrid()->globalGrid().comm(), MPI_MAX );
+    Kokkos::deep_copy( norms_host, device_norms );
+    for ( int n = 0; n < dofs_per_cell; ++n )
+        EXPECT_FLOAT_EQ( norms_host( n ), fabs( large_vals[n] ) );
+
+    Cabana::Grid::ArrayOp::norm2Local( TEST_EXECSPACE{}, *array,
+                                       device_norms );
+    Cabana::Grid::ArrayOp::reduceNorms(
+        TEST_EXECSPACE{}, device_norms,
+        array->layout()->localGrid()->globalGrid().comm(), MPI_SUM );
+    Kokkos::deep_copy( norms_host, device_norms );
+    std::vector<double> norm_2_check( dofs_per_cell );
+    Cabana::Grid::ArrayOp::norm2( *array, norm_2_check );
+    for ( int n = 0; n < dofs_per_cell; ++n )
+        EXPECT_FLOAT_EQ( std::sqrt( norms_host( n ) ), norm_2_check[n] );
 #endif
 
     // Check the copy.
@@ -418,6 +577,22 @@ void arrayOpTest()
                 for ( long l = 0; l < ghosted_space.extent( 3 ); ++l )
                     EXPECT_DOUBLE_EQ( host_view( i, j, k, l ),
                                       ( 3.0 + 1.0 + 6.0 ) * scales[l] );
+
+    // Do a fused arbitrary-length chain update.
+    Cabana::Grid::ArrayOp::assign( *array, 1.0, Ghost() );
+    Cabana::Grid::ArrayOp::assign( *array_2, 0.5, Ghost() );
+    Cabana::Grid::ArrayOp::assign( *array_3, 1.5, Ghost() );
+    using array_type = std::remove_reference_t<decltype( *array )>;
+    std::vector<std::pair<const array_type*, double>> terms = {
+        { array_2.get(), 2.0 }, { array_3.get(), 4.0 } };
+    Cabana::Grid::ArrayOp::update( *array, 3.0, terms, Ghost() );
+    Kokkos::deep_copy( host_view, array->view() );
+    for ( long i = 0; i < ghosted_space.extent( Dim::I ); ++i )
+        for ( long j = 0; j < ghosted_space.extent( Dim::J ); ++j )
+            for ( long k = 0; k < ghosted_space.extent( Dim::K ); ++k )
+                for ( long l = 0; l < ghosted_space.extent( 3 ); ++l )
+                    EXPECT_DOUBLE_EQ( host_view( i, j, k, l ),
+                                      3.0 + 1.0 + 6.0 );
 }
 
 //---------------------------------------------------------------------------//
@@ -491,6 +666,8 @@ TEST( Array, 3d )
 {
     layoutTest();
     arrayTest();
+    componentLayoutTest();
+    stencilTest();
     arrayOpTest();
 }
 TEST( Array, Boundary3d )
@@ -616,6 +616,46 @@ TEST( GlobalGrid, 2d )
 
 TEST( GlobalGrid, 3dSparse ) { sparseGridTest3d(); }
 
+TEST( GlobalGrid, NodeGroupedMapping )
+{
+    // Create a grid with the node-grouped rank mapping and check that the
+    // decomposition covers the same global problem.
+    DimBlockPartitioner<3> partitioner;
+    double cell_size = 0.23;
+    std::array<int, 3> global_num_cell = { 101, 85, 99 };
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    std::array<double, 3> global_low_corner = { 1.2, 3.3, -2.8 };
+    std::array<double, 3> global_high_corner = {
+        global_low_corner[0] + cell_size * global_num_cell[0],
+        global_low_corner[1] + cell_size * global_num_cell[1],
+        global_low_corner[2] + cell_size * global_num_cell[2] };
+    auto global_mesh = createUniformGlobalMesh(
+        global_low_corner, global_high_corner, global_num_cell );
+    auto global_grid =
+        createGlobalGrid( MPI_COMM_WORLD, global_mesh, is_dim_periodic,
+                          partitioner, NodeGroupedMapping() );
+
+    // The mapped grid spans the same communicator size and global cells.
+    int world_size;
+    MPI_Comm_size( MPI_COMM_WORLD, &world_size );
+    int grid_size;
+    MPI_Comm_size( global_grid->comm(), &grid_size );
+    EXPECT_EQ( grid_size, world_size );
+    for ( int d = 0; d < 3; ++d )
+        EXPECT_EQ( global_grid->globalNumEntity( Cell(), d ),
+                   global_num_cell[d] );
+
+    // Every cell is owned by exactly one rank.
+    long own_cells = 1;
+    for ( int d = 0; d < 3; ++d )
+        own_cells *= global_grid->ownedNumCell( d );
+    long total_cells = 0;
+    MPI_Allreduce( &own_cells, &total_cells, 1, MPI_LONG, MPI_SUM,
+                   global_grid->comm() );
+    EXPECT_EQ( total_cells, (long)global_num_cell[0] * global_num_cell[1] *
+                                global_num_cell[2] );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
@@ -133,6 +133,36 @@ void testConversion3d( const std::array<bool, 3>& is_dim_periodic )
                 if ( local_grid->neighborRank( i, j, k ) >= 0 )
                     check_results( local_grid->sharedIndexSpace(
                         Cabana::Grid::Ghost(), EntityType(), i, j, k ) );
+
+    // The batched conversion and the cached per-dimension plan both match
+    // the per-index conversion over the owned space.
+    auto batch = Cabana::Grid::IndexConversion::batchedL2G<TEST_MEMSPACE>(
+        TEST_EXECSPACE{}, l2g, own_local_space );
+    auto ghost_space = local_grid->indexSpace(
+        Cabana::Grid::Ghost(), EntityType(), Cabana::Grid::Local() );
+    auto plan = Cabana::Grid::IndexConversion::createL2GPlan<TEST_MEMSPACE>(
+        TEST_EXECSPACE{}, l2g, ghost_space );
+    auto plan_batch = Cabana::Grid::IndexConversion::batchedL2G<TEST_MEMSPACE>(
+        TEST_EXECSPACE{}, plan, own_local_space );
+
+    auto batch_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), batch );
+    auto plan_batch_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), plan_batch );
+    long n = 0;
+    for ( int i = own_local_space.min( Dim::I );
+          i < own_local_space.max( Dim::I ); ++i )
+        for ( int j = own_local_space.min( Dim::J );
+              j < own_local_space.max( Dim::J ); ++j )
+            for ( int k = own_local_space.min( Dim::K );
+                  k < own_local_space.max( Dim::K ); ++k, ++n )
+                for ( int d = 0; d < 3; ++d )
+                {
+                    EXPECT_EQ( batch_host( n, d ),
+                               l2g_view_host( i, j, k, d ) );
+                    EXPECT_EQ( plan_batch_host( n, d ),
+                               l2g_view_host( i, j, k, d ) );
+                }
 }
 
 //---------------------------------------------------------------------------//
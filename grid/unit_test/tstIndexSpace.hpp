@@ -584,6 +584,60 @@ void inRangeTest()
     EXPECT_FALSE( space.inRange( i8 ) );
 }
 
+//---------------------------------------------------------------------------//
+void copyRegionTest()
+{
+    // Copy a thin y-z face between two rank-3 views.
+    int size_i = 10;
+    int size_j = 12;
+    int size_k = 14;
+    Kokkos::View<double***, TEST_MEMSPACE> src( "src", size_i, size_j,
+                                                size_k );
+    Kokkos::View<double***, TEST_MEMSPACE> dst( "dst", size_i, size_j,
+                                                size_k );
+    Kokkos::deep_copy( src, 1.0 );
+
+    IndexSpace<3> src_space( { 2, 0, 0 }, { 4, size_j, size_k } );
+    IndexSpace<3> dst_space( { 7, 0, 0 }, { 9, size_j, size_k } );
+    copyRegion( dst, dst_space, src, src_space );
+
+    auto dst_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), dst );
+    for ( int i = 0; i < size_i; ++i )
+        for ( int j = 0; j < size_j; ++j )
+            for ( int k = 0; k < size_k; ++k )
+            {
+                if ( dst_space.min( 0 ) <= i && i < dst_space.max( 0 ) )
+                    EXPECT_DOUBLE_EQ( dst_mirror( i, j, k ), 1.0 );
+                else
+                    EXPECT_DOUBLE_EQ( dst_mirror( i, j, k ), 0.0 );
+            }
+
+    // Copy a strided interior block.
+    Kokkos::deep_copy( dst, 0.0 );
+    IndexSpace<3> src_block( { 0, 3, 5 }, { 2, 6, 9 } );
+    IndexSpace<3> dst_block( { 5, 6, 2 }, { 7, 9, 6 } );
+    copyRegion( dst, dst_block, src, src_block );
+
+    Kokkos::deep_copy( dst_mirror, dst );
+    for ( int i = 0; i < size_i; ++i )
+        for ( int j = 0; j < size_j; ++j )
+            for ( int k = 0; k < size_k; ++k )
+            {
+                if ( dst_block.min( 0 ) <= i && i < dst_block.max( 0 ) &&
+                     dst_block.min( 1 ) <= j && j < dst_block.max( 1 ) &&
+                     dst_block.min( 2 ) <= k && k < dst_block.max( 2 ) )
+                    EXPECT_DOUBLE_EQ( dst_mirror( i, j, k ), 1.0 );
+                else
+                    EXPECT_DOUBLE_EQ( dst_mirror( i, j, k ), 0.0 );
+            }
+
+    // Mismatched extents throw.
+    IndexSpace<3> bad_space( { 0, 0, 0 }, { 1, size_j, size_k } );
+    EXPECT_THROW( copyRegion( dst, dst_space, src, bad_space ),
+                  std::runtime_error );
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
@@ -597,6 +651,7 @@ TEST( IndexSpace, Test )
     rangeAppendTest();
     comparisonTest();
     defaultConstructorTest();
+    copyRegionTest();
 }
 
 //---------------------------------------------------------------------------//
@@ -3307,6 +3307,53 @@ void notPeriodicTest2d()
     MPI_Comm_free( &serial_comm );
 }
 
+void batchedSharedSpacesTest()
+{
+    // Create a periodic 3d local grid.
+    DimBlockPartitioner<3> partitioner;
+    double cell_size = 0.23;
+    std::array<int, 3> global_num_cell = { 47, 38, 53 };
+    std::array<double, 3> global_low_corner = { 1.2, 3.3, -2.8 };
+    std::array<double, 3> global_high_corner = {
+        global_low_corner[0] + cell_size * global_num_cell[0],
+        global_low_corner[1] + cell_size * global_num_cell[1],
+        global_low_corner[2] + cell_size * global_num_cell[2] };
+    auto global_mesh = createUniformGlobalMesh(
+        global_low_corner, global_high_corner, global_num_cell );
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+    int halo_width = 2;
+    auto local_grid = createLocalGrid( global_grid, halo_width );
+
+    // All 26 neighbors are valid in a fully periodic decomposition.
+    auto batch = neighborSharedIndexSpaces<TEST_MEMSPACE>( *local_grid, Own(),
+                                                           Cell() );
+    EXPECT_EQ( batch.num_neighbor, 26 );
+
+    // The batched spaces match the per-neighbor queries.
+    int n = 0;
+    for ( int k = -1; k < 2; ++k )
+        for ( int j = -1; j < 2; ++j )
+            for ( int i = -1; i < 2; ++i )
+            {
+                if ( 0 == i && 0 == j && 0 == k )
+                    continue;
+                std::array<int, 3> ijk = { i, j, k };
+                auto space =
+                    local_grid->sharedIndexSpace( Own(), Cell(), ijk );
+                auto batch_space = batch.indexSpace( n );
+                EXPECT_EQ( batch.ranks_host( n ),
+                           local_grid->neighborRank( ijk ) );
+                for ( int d = 0; d < 3; ++d )
+                {
+                    EXPECT_EQ( batch_space.min( d ), space.min( d ) );
+                    EXPECT_EQ( batch_space.max( d ), space.max( d ) );
+                }
+                ++n;
+            }
+}
+
 void mutabilityTest()
 {
     // Let MPI compute the partitioning for this test.
@@ -3356,6 +3403,8 @@ TEST( LocalGrid, 2d )
 
 TEST( LocalGrid, Mutability ) { mutabilityTest(); }
 
+TEST( LocalGrid, BatchedSharedIndexSpaces ) { batchedSharedSpacesTest(); }
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
@@ -573,6 +573,23 @@ void nonUniformTest3d( const std::array<int, 3>& ranks_per_dim,
     // Test the local mesh.
     uniformLocalMeshTest3d( local_mesh, *local_grid, low_corner, cell_size,
                             halo_width );
+
+    // Check the per-cell measure cache against the width-product measure.
+    local_mesh.cacheCellMeasures();
+    EXPECT_TRUE( local_mesh.cellMeasuresCached() );
+    auto cell_space = local_grid->indexSpace( Ghost(), Cell(), Local() );
+    int num_wrong = 0;
+    Kokkos::parallel_reduce(
+        "check_cell_measure_cache",
+        createExecutionPolicy( cell_space, TEST_EXECSPACE() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k, int& update ) {
+            int idx[3] = { i, j, k };
+            if ( local_mesh.cellMeasure( idx ) !=
+                 local_mesh.measure( Cell(), idx ) )
+                ++update;
+        },
+        num_wrong );
+    EXPECT_EQ( num_wrong, 0 );
 }
 
 //---------------------------------------------------------------------------//
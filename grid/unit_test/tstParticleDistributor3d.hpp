@@ -439,6 +439,55 @@ TEST( ParticleDistributor, LocalOnly3d )
 }
 //---------------------------------------------------------------------------//
 
+//---------------------------------------------------------------------------//
+TEST( ParticleDistributor, MigrationController3d )
+{
+    // Let MPI compute the partitioning for this test.
+    int comm_size;
+    MPI_Comm_size( MPI_COMM_WORLD, &comm_size );
+    std::array<int, 3> ranks_per_dim = { 0, 0, 0 };
+    MPI_Dims_create( comm_size, 3, ranks_per_dim.data() );
+    Cabana::Grid::ManualBlockPartitioner<3> partitioner( ranks_per_dim );
+    std::array<bool, 3> is_periodic = { true, true, true };
+    double cell_size = 0.23;
+    auto global_grid = createGrid( partitioner, is_periodic, cell_size );
+
+    const int halo_width = 2;
+    auto block = Cabana::Grid::createLocalGrid( global_grid, halo_width );
+    auto local_mesh =
+        Cabana::Grid::createLocalMesh<Kokkos::HostSpace>( *block );
+
+    // One particle at the center of the local domain.
+    using MemberTypes = Cabana::MemberTypes<double[3], int>;
+    Cabana::AoSoA<MemberTypes, TEST_MEMSPACE> particles( "particles", 1 );
+    auto particles_host =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), particles );
+    auto coords_host = Cabana::slice<0>( particles_host );
+    for ( int d = 0; d < 3; ++d )
+        coords_host( 0, d ) =
+            0.5 * ( local_mesh.lowCorner( Cabana::Grid::Own(), d ) +
+                    local_mesh.highCorner( Cabana::Grid::Own(), d ) );
+    Cabana::deep_copy( particles, particles_host );
+    auto coords = Cabana::slice<0>( particles );
+
+    auto controller = Cabana::Grid::createMigrationController(
+        *block, coords, halo_width );
+    EXPECT_DOUBLE_EQ( controller.slack(), halo_width * cell_size );
+
+    // Small bounded motion cannot require migration - no kernels run.
+    EXPECT_TRUE( controller.advance( 0.1 * cell_size ) );
+    EXPECT_FALSE( controller.needsMigration( coords ) );
+    EXPECT_FALSE( controller.migrateIfNeeded( *block, coords, particles,
+                                              halo_width ) );
+
+    // Accumulated bound past the slack falls back to the exact check,
+    // which tightens the bound from the true (zero) displacement.
+    for ( int s = 0; s < 30; ++s )
+        controller.advance( 0.1 * cell_size );
+    EXPECT_FALSE( controller.needsMigration( coords ) );
+    EXPECT_TRUE( controller.advance( 0.1 * cell_size ) );
+}
+
 //---------------------------------------------------------------------------//
 TEST( ParticleDistributor, RemoveOutsideDomain3d )
 {
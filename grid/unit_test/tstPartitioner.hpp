@@ -237,6 +237,38 @@ TEST( Partitioner, OwnedCellInfo3d )
     testManualPartitioner3d();
 }
 
+TEST( Partitioner, Hierarchical3d )
+{
+    // The two-level grid covers the communicator and partitions the cells
+    // completely.
+    Cabana::Grid::HierarchicalBlockPartitioner<3> partitioner(
+        MPI_COMM_WORLD );
+    std::array<int, 3> global_num_cell = { 104, 55, 97 };
+    auto ranks_per_dim =
+        partitioner.ranksPerDimension( MPI_COMM_WORLD, global_num_cell );
+    auto node_dims = partitioner.nodesPerDimension();
+    auto local_dims = partitioner.localRanksPerDimension();
+    int comm_size;
+    MPI_Comm_size( MPI_COMM_WORLD, &comm_size );
+    int nrank = 1;
+    for ( int d = 0; d < 3; ++d )
+    {
+        EXPECT_EQ( ranks_per_dim[d], node_dims[d] * local_dims[d] );
+        nrank *= ranks_per_dim[d];
+    }
+    EXPECT_EQ( nrank, comm_size );
+
+    // The nested-order communicator permutes without changing the size.
+    MPI_Comm mapped_comm = partitioner.createMappedComm( MPI_COMM_WORLD );
+    int mapped_size;
+    MPI_Comm_size( mapped_comm, &mapped_size );
+    EXPECT_EQ( mapped_size, comm_size );
+    MPI_Comm_free( &mapped_comm );
+
+    // Block sizing matches the flat uniform split.
+    owned_cell_info_test_3d( partitioner );
+}
+
 TEST( Partitioner, OwnedCellInfo2d )
 {
     testBlockPartitioner2d();
@@ -281,4 +281,118 @@ TEST( Splines, Cubic )
     EXPECT_FLOAT_EQ( field_grad, grid_deriv( xp ) );
 }
 
+//---------------------------------------------------------------------------//
+TEST( Splines, Quartic )
+{
+    // Check partition of unity for the quartic spline.
+    double xp = -1.4;
+    double low_x = -3.43;
+    double dx = 0.27;
+    double rdx = 1.0 / dx;
+    double values[5];
+
+    double x0 = Spline<4>::mapToLogicalGrid( xp, rdx, low_x );
+    Spline<4>::value( x0, values );
+    double sum = 0.0;
+    for ( auto x : values )
+        sum += x;
+    EXPECT_FLOAT_EQ( sum, 1.0 );
+
+    xp = 2.1789;
+    x0 = Spline<4>::mapToLogicalGrid( xp, rdx, low_x );
+    Spline<4>::value( x0, values );
+    sum = 0.0;
+    for ( auto x : values )
+        sum += x;
+    EXPECT_FLOAT_EQ( sum, 1.0 );
+
+    // Check the stencil by putting a point in the center of a dual cell (on
+    // a node).
+    int node_id = 4;
+    xp = low_x + ( node_id + 0.25 ) * dx;
+    x0 = Spline<4>::mapToLogicalGrid( xp, rdx, low_x );
+    int stencil[5];
+    Spline<4>::stencil( x0, stencil );
+    EXPECT_EQ( stencil[0], node_id - 2 );
+    EXPECT_EQ( stencil[1], node_id - 1 );
+    EXPECT_EQ( stencil[2], node_id );
+    EXPECT_EQ( stencil[3], node_id + 1 );
+    EXPECT_EQ( stencil[4], node_id + 2 );
+
+    // Check the interpolation of a linear function.
+    auto grid_func = [=]( const double x ) { return 4.32 * x - 0.31; };
+    double field[Spline<4>::num_knot];
+    for ( int n = 0; n < 5; ++n )
+        field[n] = grid_func( low_x + ( node_id - 2 + n ) * dx );
+    Spline<4>::value( x0, values );
+    double field_xp = 0.0;
+    for ( int n = 0; n < 5; ++n )
+        field_xp += field[n] * values[n];
+    EXPECT_FLOAT_EQ( field_xp, grid_func( xp ) );
+
+    // Check the derivative of a function.
+    Spline<4>::gradient( x0, rdx, values );
+    double field_grad = 0.0;
+    for ( int n = 0; n < 5; ++n )
+        field_grad += field[n] * values[n];
+    EXPECT_FLOAT_EQ( field_grad, 4.32 );
+}
+
+//---------------------------------------------------------------------------//
+TEST( Splines, Quintic )
+{
+    // Check partition of unity for the quintic spline.
+    double xp = -1.4;
+    double low_x = -3.43;
+    double dx = 0.27;
+    double rdx = 1.0 / dx;
+    double values[6];
+
+    double x0 = Spline<5>::mapToLogicalGrid( xp, rdx, low_x );
+    Spline<5>::value( x0, values );
+    double sum = 0.0;
+    for ( auto x : values )
+        sum += x;
+    EXPECT_FLOAT_EQ( sum, 1.0 );
+
+    xp = 2.1789;
+    x0 = Spline<5>::mapToLogicalGrid( xp, rdx, low_x );
+    Spline<5>::value( x0, values );
+    sum = 0.0;
+    for ( auto x : values )
+        sum += x;
+    EXPECT_FLOAT_EQ( sum, 1.0 );
+
+    // Check the stencil by putting a point in a primal cell.
+    int cell_id = 4;
+    xp = low_x + ( cell_id + 0.75 ) * dx;
+    x0 = Spline<5>::mapToLogicalGrid( xp, rdx, low_x );
+    int stencil[6];
+    Spline<5>::stencil( x0, stencil );
+    EXPECT_EQ( stencil[0], cell_id - 2 );
+    EXPECT_EQ( stencil[1], cell_id - 1 );
+    EXPECT_EQ( stencil[2], cell_id );
+    EXPECT_EQ( stencil[3], cell_id + 1 );
+    EXPECT_EQ( stencil[4], cell_id + 2 );
+    EXPECT_EQ( stencil[5], cell_id + 3 );
+
+    // Check the interpolation of a linear function.
+    auto grid_func = [=]( const double x ) { return 4.32 * x - 0.31; };
+    double field[Spline<5>::num_knot];
+    for ( int n = 0; n < 6; ++n )
+        field[n] = grid_func( low_x + ( cell_id - 2 + n ) * dx );
+    Spline<5>::value( x0, values );
+    double field_xp = 0.0;
+    for ( int n = 0; n < 6; ++n )
+        field_xp += field[n] * values[n];
+    EXPECT_FLOAT_EQ( field_xp, grid_func( xp ) );
+
+    // Check the derivative of a function.
+    Spline<5>::gradient( x0, rdx, values );
+    double field_grad = 0.0;
+    for ( int n = 0; n < 6; ++n )
+        field_grad += field[n] * values[n];
+    EXPECT_FLOAT_EQ( field_grad, 4.32 );
+}
+
 } // end namespace Test